@@ -1469,6 +1469,11 @@ struct k_timer {
 	/* user-specific data, also used to support legacy features */
 	void *user_data;
 
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* ticks by which expiration may be delayed */
+	k_ticks_t slack;
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_timer)
 
 #ifdef CONFIG_OBJ_CORE_TIMER
@@ -1713,6 +1718,25 @@ static inline void *z_impl_k_timer_user_data_get(const struct k_timer *timer)
 	return timer->user_data;
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/**
+ * @brief Set the slack of a timer.
+ *
+ * This routine allows the expirations of @a timer to be delayed by up
+ * to @a slack, so that they can be handled together with other timeouts
+ * expiring at about the same time instead of waking the system up on
+ * their own.  Expirations never happen early, and periodic timers do not
+ * drift as the period is always counted from the nominal expiration
+ * time.  The new slack applies from the next start or expiration of the
+ * timer.
+ *
+ * @param timer     Address of timer.
+ * @param slack     Maximum expiration delay, must be a relative timeout
+ *                  (K_NO_WAIT to disable slack).
+ */
+__syscall void k_timer_slack_set(struct k_timer *timer, k_timeout_t slack);
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 /** @} */
 
 /**
@@ -2385,8 +2409,203 @@ static inline uint32_t k_event_test(struct k_event *event, uint32_t events_mask)
 
 /** @} */
 
+#if defined(CONFIG_MPMC_QUEUE) || defined(__DOXYGEN__)
+
+/**
+ * @defgroup mpmc_apis MPMC Queue APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+/* A ring cell.  The sequence number is stored relative to the index of
+ * the cell, so that a zeroed ring is an empty ring and K_MPMC_DEFINE()
+ * needs no run-time initialization.
+ */
+struct z_mpmc_cell {
+	atomic_t seq;
+	void *data;
+};
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Bounded lock-free multi-producer, multi-consumer queue.
+ *
+ * Items are passed by pointer through a ring of cells with per-cell
+ * sequence numbers, so that producers and consumers only contend on
+ * an atomic increment of their respective position.  The spinlock
+ * and wait queues are only used by threads that have to block because
+ * the queue is empty or full, and by the threads waking them.
+ */
+struct k_mpmc {
+	/** @cond INTERNAL_HIDDEN */
+	struct z_mpmc_cell *cells;
+	uint32_t mask;
+	atomic_t enqueue_pos;
+	atomic_t dequeue_pos;
+
+	/* Number of threads about to pend or pending in each wait queue,
+	 * so that the fast paths only take the lock when there is a
+	 * thread to wake, as with a futex.
+	 */
+	atomic_t get_waiters;
+	atomic_t put_waiters;
+
+	struct k_spinlock lock;
+	_wait_q_t get_wait_q;
+	_wait_q_t put_wait_q;
+	/** @endcond */
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+#define Z_MPMC_INITIALIZER(obj, cell_buf, capacity) \
+	{ \
+	.cells = (cell_buf), \
+	.mask = (capacity) - 1U, \
+	.get_wait_q = Z_WAIT_Q_INIT(&(obj).get_wait_q), \
+	.put_wait_q = Z_WAIT_Q_INIT(&(obj).put_wait_q), \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Statically define and initialize an MPMC queue.
+ *
+ * The queue can be accessed outside the module where it is defined
+ * using:
+ *
+ * @code extern struct k_mpmc <name>; @endcode
+ *
+ * @param name Name of the MPMC queue.
+ * @param capacity Maximum number of queued items, a power of two
+ *                 and at least 2.
+ */
+#define K_MPMC_DEFINE(name, capacity) \
+	static struct z_mpmc_cell _k_mpmc_cells_##name[capacity]; \
+	struct k_mpmc name = \
+		Z_MPMC_INITIALIZER(name, _k_mpmc_cells_##name, capacity); \
+	BUILD_ASSERT(((capacity) >= 2U) && \
+		     (((capacity) & ((capacity) - 1U)) == 0U), \
+		     "MPMC queue capacity must be a power of two, at least 2")
+
+/**
+ * @brief Initialize an MPMC queue.
+ *
+ * @param mpmc Address of the MPMC queue.
+ * @param cells Array of @a capacity cells used as the ring.
+ * @param capacity Maximum number of queued items, a power of two
+ *                 and at least 2.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @a capacity is not a power of two of at least 2.
+ */
+int k_mpmc_init(struct k_mpmc *mpmc, struct z_mpmc_cell *cells,
+		uint32_t capacity);
+
+/**
+ * @brief Add an item to an MPMC queue.
+ *
+ * Unlike with a k_queue, the item is not modified, and can be any
+ * pointer but NULL.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param mpmc Address of the MPMC queue.
+ * @param data Item to add.
+ * @param timeout Waiting period for the queue to have room, or one of
+ *                the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 on success.
+ * @retval -ENOMSG if the queue is full and @a timeout is K_NO_WAIT.
+ * @retval -EAGAIN if the waiting period timed out.
+ */
+int k_mpmc_put(struct k_mpmc *mpmc, void *data, k_timeout_t timeout);
+
+/**
+ * @brief Get an item from an MPMC queue.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param mpmc Address of the MPMC queue.
+ * @param timeout Waiting period for an item, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @return The item, or NULL if the waiting period timed out or the
+ *         wait was cancelled with k_mpmc_cancel_wait().
+ */
+void *k_mpmc_get(struct k_mpmc *mpmc, k_timeout_t timeout);
+
+/**
+ * @brief Cancel waiting on an MPMC queue.
+ *
+ * The first thread waiting in k_mpmc_get(), if any, returns NULL.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param mpmc Address of the MPMC queue.
+ */
+void k_mpmc_cancel_wait(struct k_mpmc *mpmc);
+
+/**
+ * @brief Peek at the oldest item of an MPMC queue.
+ *
+ * The item may already have been removed by another consumer by the
+ * time this returns.
+ *
+ * @param mpmc Address of the MPMC queue.
+ *
+ * @return Oldest item, or NULL if the queue is empty.
+ */
+void *k_mpmc_peek_head(struct k_mpmc *mpmc);
+
+/**
+ * @brief Peek at the newest item of an MPMC queue.
+ *
+ * The item may already have been removed by another consumer by the
+ * time this returns.
+ *
+ * @param mpmc Address of the MPMC queue.
+ *
+ * @return Newest item, or NULL if the queue is empty.
+ */
+void *k_mpmc_peek_tail(struct k_mpmc *mpmc);
+
+/**
+ * @brief Query an MPMC queue to see if it has items available.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param mpmc Address of the MPMC queue.
+ *
+ * @return Non-zero if the queue is empty.
+ * @return 0 if an item is available.
+ */
+int k_mpmc_is_empty(struct k_mpmc *mpmc);
+
+/** @} */
+
+#endif /* CONFIG_MPMC_QUEUE */
+
 struct k_fifo {
 	struct k_queue _queue;
+#ifdef CONFIG_FIFO_MPMC
+	struct k_mpmc *_mpmc;
+#endif
 #ifdef CONFIG_OBJ_CORE_FIFO
 	struct k_obj_core  obj_core;
 #endif
@@ -2400,6 +2619,21 @@ struct k_fifo {
 	._queue = Z_QUEUE_INITIALIZER(obj._queue) \
 	}
 
+#ifdef CONFIG_FIFO_MPMC
+/* Evaluates @a mpmc_op on FIFOs backed by an MPMC queue, and
+ * @a queue_op on the others.
+ */
+#define Z_FIFO_BACKEND(fifo, queue_op, mpmc_op) \
+	(((fifo)->_mpmc != NULL) ? (mpmc_op) : (queue_op))
+#define Z_FIFO_MPMC_SET(fifo, mpmc) ((fifo)->_mpmc = (mpmc))
+
+int z_mpmc_fifo_put(struct k_mpmc *mpmc, void *data);
+void z_mpmc_fifo_put_list(struct k_mpmc *mpmc, void *head, void *tail);
+#else
+#define Z_FIFO_BACKEND(fifo, queue_op, mpmc_op) (queue_op)
+#define Z_FIFO_MPMC_SET(fifo, mpmc) ((void)0)
+#endif /* CONFIG_FIFO_MPMC */
+
 /**
  * INTERNAL_HIDDEN @endcond
  */
@@ -2421,11 +2655,45 @@ struct k_fifo {
 	({                                                   \
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_fifo, init, fifo); \
 	k_queue_init(&(fifo)->_queue);                       \
+	Z_FIFO_MPMC_SET(fifo, NULL);                         \
 	K_OBJ_CORE_INIT(K_OBJ_CORE(fifo), _obj_type_fifo);   \
 	K_OBJ_CORE_LINK(K_OBJ_CORE(fifo));                   \
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_fifo, init, fifo);  \
 	})
 
+#if defined(CONFIG_FIFO_MPMC) || defined(__DOXYGEN__)
+/**
+ * @brief Initialize a FIFO queue backed by an MPMC queue.
+ *
+ * The FIFO passes its items through @a mpmc instead of a linked list,
+ * which lets producers and consumers on different CPUs proceed
+ * without taking a lock.  Such a FIFO holds at most as many items as
+ * @a mpmc can, and does not use the first word of the items.  It
+ * differs from a regular FIFO in that:
+ *
+ * - k_fifo_put() waits for room when called from a thread, and fails
+ *   with -ENOMEM on a full FIFO when called from an ISR, in which case
+ *   the item is not added and still belongs to the caller;
+ * - k_fifo_alloc_put() does not allocate, and fails with -ENOMEM on a
+ *   full FIFO;
+ * - k_fifo_put_list() and k_fifo_put_slist() add items one by one, so
+ *   items from other producers may be interleaved with the list, and
+ *   must not be called from an ISR without room for the whole list;
+ * - it cannot be used with k_poll().
+ *
+ * MPMC backed FIFOs are not available with CONFIG_USERSPACE, as the
+ * FIFO macros read the backend of the FIFO in the caller's context.
+ *
+ * @param fifo Address of the FIFO queue.
+ * @param mpmc Initialized MPMC queue, not used for anything else.
+ */
+#define k_fifo_init_mpmc(fifo, mpmc)                         \
+	({                                                   \
+	k_fifo_init(fifo);                                   \
+	Z_FIFO_MPMC_SET(fifo, mpmc);                         \
+	})
+#endif /* CONFIG_FIFO_MPMC */
+
 /**
  * @brief Cancel waiting on a FIFO queue.
  *
@@ -2440,7 +2708,8 @@ struct k_fifo {
 #define k_fifo_cancel_wait(fifo) \
 	({ \
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_fifo, cancel_wait, fifo); \
-	k_queue_cancel_wait(&(fifo)->_queue); \
+	Z_FIFO_BACKEND(fifo, k_queue_cancel_wait(&(fifo)->_queue), \
+		       k_mpmc_cancel_wait((fifo)->_mpmc)); \
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_fifo, cancel_wait, fifo); \
 	})
 
@@ -2455,12 +2724,19 @@ struct k_fifo {
  *
  * @param fifo Address of the FIFO.
  * @param data Address of the data item.
+ *
+ * @retval 0 on success
+ * @retval -ENOMEM if @a fifo is backed by an MPMC queue that is full, and
+ *         the caller cannot wait for room (ISR or pre-kernel context)
  */
 #define k_fifo_put(fifo, data) \
 	({ \
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_fifo, put, fifo, data); \
-	k_queue_append(&(fifo)->_queue, data); \
+	int fp_ret = Z_FIFO_BACKEND(fifo, \
+		(k_queue_append(&(fifo)->_queue, data), 0), \
+		z_mpmc_fifo_put((fifo)->_mpmc, data)); \
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_fifo, put, fifo, data); \
+	fp_ret; \
 	})
 
 /**
@@ -2482,7 +2758,9 @@ struct k_fifo {
 #define k_fifo_alloc_put(fifo, data) \
 	({ \
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_fifo, alloc_put, fifo, data); \
-	int fap_ret = k_queue_alloc_append(&(fifo)->_queue, data); \
+	int fap_ret = Z_FIFO_BACKEND(fifo, \
+		k_queue_alloc_append(&(fifo)->_queue, data), \
+		((k_mpmc_put((fifo)->_mpmc, data, K_NO_WAIT) == 0) ? 0 : -ENOMEM)); \
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_fifo, alloc_put, fifo, data, fap_ret); \
 	fap_ret; \
 	})
@@ -2504,7 +2782,8 @@ struct k_fifo {
 #define k_fifo_put_list(fifo, head, tail) \
 	({ \
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_fifo, put_list, fifo, head, tail); \
-	k_queue_append_list(&(fifo)->_queue, head, tail); \
+	Z_FIFO_BACKEND(fifo, (void)k_queue_append_list(&(fifo)->_queue, head, tail), \
+		       z_mpmc_fifo_put_list((fifo)->_mpmc, head, tail)); \
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_fifo, put_list, fifo, head, tail); \
 	})
 
@@ -2524,7 +2803,8 @@ struct k_fifo {
 #define k_fifo_put_slist(fifo, list) \
 	({ \
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_fifo, put_slist, fifo, list); \
-	k_queue_merge_slist(&(fifo)->_queue, list); \
+	Z_FIFO_BACKEND(fifo, (void)k_queue_merge_slist(&(fifo)->_queue, list), \
+		       z_mpmc_fifo_put_list((fifo)->_mpmc, (list)->head, (list)->tail)); \
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_fifo, put_slist, fifo, list); \
 	})
 
@@ -2548,7 +2828,8 @@ struct k_fifo {
 #define k_fifo_get(fifo, timeout) \
 	({ \
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_fifo, get, fifo, timeout); \
-	void *fg_ret = k_queue_get(&(fifo)->_queue, timeout); \
+	void *fg_ret = Z_FIFO_BACKEND(fifo, k_queue_get(&(fifo)->_queue, timeout), \
+				      k_mpmc_get((fifo)->_mpmc, timeout)); \
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_fifo, get, fifo, timeout, fg_ret); \
 	fg_ret; \
 	})
@@ -2567,7 +2848,8 @@ struct k_fifo {
  * @return 0 if data is available.
  */
 #define k_fifo_is_empty(fifo) \
-	k_queue_is_empty(&(fifo)->_queue)
+	Z_FIFO_BACKEND(fifo, k_queue_is_empty(&(fifo)->_queue), \
+		       k_mpmc_is_empty((fifo)->_mpmc))
 
 /**
  * @brief Peek element at the head of a FIFO queue.
@@ -2585,7 +2867,8 @@ struct k_fifo {
 #define k_fifo_peek_head(fifo) \
 	({ \
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_fifo, peek_head, fifo); \
-	void *fph_ret = k_queue_peek_head(&(fifo)->_queue); \
+	void *fph_ret = Z_FIFO_BACKEND(fifo, k_queue_peek_head(&(fifo)->_queue), \
+				       k_mpmc_peek_head((fifo)->_mpmc)); \
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_fifo, peek_head, fifo, fph_ret); \
 	fph_ret; \
 	})
@@ -2604,7 +2887,8 @@ struct k_fifo {
 #define k_fifo_peek_tail(fifo) \
 	({ \
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_fifo, peek_tail, fifo); \
-	void *fpt_ret = k_queue_peek_tail(&(fifo)->_queue); \
+	void *fpt_ret = Z_FIFO_BACKEND(fifo, k_queue_peek_tail(&(fifo)->_queue), \
+				       k_mpmc_peek_tail((fifo)->_mpmc)); \
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_fifo, peek_tail, fifo, fpt_ret); \
 	fpt_ret; \
 	})
@@ -2622,6 +2906,25 @@ struct k_fifo {
 	STRUCT_SECTION_ITERABLE(k_fifo, name) = \
 		Z_FIFO_INITIALIZER(name)
 
+#if defined(CONFIG_FIFO_MPMC) || defined(__DOXYGEN__)
+/**
+ * @brief Statically define and initialize a FIFO queue backed by an
+ * MPMC queue.
+ *
+ * See k_fifo_init_mpmc() for how such a FIFO differs from a regular one.
+ *
+ * @param name Name of the FIFO queue.
+ * @param capacity Maximum number of queued items, a power of two
+ *                 and at least 2.
+ */
+#define K_FIFO_MPMC_DEFINE(name, capacity) \
+	K_MPMC_DEFINE(_k_fifo_mpmc_##name, capacity); \
+	STRUCT_SECTION_ITERABLE(k_fifo, name) = { \
+		._queue = Z_QUEUE_INITIALIZER(name._queue), \
+		._mpmc = &_k_fifo_mpmc_##name, \
+	}
+#endif /* CONFIG_FIFO_MPMC */
+
 /** @} */
 
 struct k_lifo {
@@ -2923,6 +3226,11 @@ struct k_mutex {
 	/** Original thread priority */
 	int owner_orig_prio;
 
+#ifdef CONFIG_SYNC_FAST_PATH
+	/** Owner thread pointer, with bit 0 set when there may be waiters */
+	atomic_t lock_word;
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mutex)
 
 #ifdef CONFIG_OBJ_CORE_MUTEX
@@ -2939,6 +3247,7 @@ struct k_mutex {
 	.owner = NULL, \
 	.lock_count = 0, \
 	.owner_orig_prio = K_LOWEST_APPLICATION_THREAD_PRIO, \
+	IF_ENABLED(CONFIG_SYNC_FAST_PATH, (.lock_word = ATOMIC_INIT(0),)) \
 	}
 
 /**
@@ -3108,9 +3417,21 @@ __syscall int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
  * @cond INTERNAL_HIDDEN
  */
 
+#ifdef CONFIG_SYNC_FAST_PATH
+/* Semaphore count value meaning "zero, and the wait queue may be
+ * non-empty", which makes k_sem_give() take the locked path.
+ */
+#define Z_SEM_WAITERS ((atomic_val_t)-1)
+#endif
+
 struct k_sem {
 	_wait_q_t wait_q;
+#ifdef CONFIG_SYNC_FAST_PATH
+	/* Count, or Z_SEM_WAITERS when zero and threads may be waiting */
+	atomic_t count;
+#else
 	unsigned int count;
+#endif
 	unsigned int limit;
 
 	Z_DECL_POLL_EVENT
@@ -3122,11 +3443,15 @@ struct k_sem {
 #endif
 };
 
+/* UINT_MAX stands for no limit, which is K_SEM_MAX_LIMIT with the fast path */
+#define Z_SEM_LIMIT(count_limit) \
+	(((count_limit) == UINT_MAX) ? K_SEM_MAX_LIMIT : (count_limit))
+
 #define Z_SEM_INITIALIZER(obj, initial_count, count_limit) \
 	{ \
 	.wait_q = Z_WAIT_Q_INIT(&(obj).wait_q), \
 	.count = (initial_count), \
-	.limit = (count_limit), \
+	.limit = Z_SEM_LIMIT(count_limit), \
 	Z_POLL_EVENT_OBJ_INIT(obj) \
 	}
 
@@ -3148,7 +3473,11 @@ struct k_sem {
  * counting purposes.
  *
  */
+#ifdef CONFIG_SYNC_FAST_PATH
+#define K_SEM_MAX_LIMIT (UINT_MAX - 1U)
+#else
 #define K_SEM_MAX_LIMIT UINT_MAX
+#endif
 
 /**
  * @brief Initialize a semaphore.
@@ -3157,7 +3486,8 @@ struct k_sem {
  *
  * @param sem Address of the semaphore.
  * @param initial_count Initial semaphore count.
- * @param limit Maximum permitted semaphore count.
+ * @param limit Maximum permitted semaphore count. UINT_MAX is accepted
+ *              and treated as K_SEM_MAX_LIMIT.
  *
  * @see K_SEM_MAX_LIMIT
  *
@@ -3227,7 +3557,13 @@ __syscall unsigned int k_sem_count_get(struct k_sem *sem);
  */
 static inline unsigned int z_impl_k_sem_count_get(struct k_sem *sem)
 {
+#ifdef CONFIG_SYNC_FAST_PATH
+	atomic_val_t count = atomic_get(&sem->count);
+
+	return (count == Z_SEM_WAITERS) ? 0U : (unsigned int)count;
+#else
 	return sem->count;
+#endif
 }
 
 /**
@@ -3245,8 +3581,8 @@ static inline unsigned int z_impl_k_sem_count_get(struct k_sem *sem)
 	STRUCT_SECTION_ITERABLE(k_sem, name) = \
 		Z_SEM_INITIALIZER(name, initial_count, count_limit); \
 	BUILD_ASSERT(((count_limit) != 0) && \
-		     ((initial_count) <= (count_limit)) && \
-			 ((count_limit) <= K_SEM_MAX_LIMIT));
+		     ((initial_count) <= Z_SEM_LIMIT(count_limit)) && \
+			 (Z_SEM_LIMIT(count_limit) <= K_SEM_MAX_LIMIT));
 
 /** @} */
 
@@ -3536,6 +3872,26 @@ int k_work_queue_unplug(struct k_work_q *queue);
 void k_work_init_delayable(struct k_work_delayable *dwork,
 			   k_work_handler_t handler);
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/** @brief Set the slack of a delayable work item.
+ *
+ * Allow the submission of a scheduled delayable work item to be delayed by
+ * up to @p slack, so that its timeout can be handled together with other
+ * timeouts expiring at about the same time instead of waking the system up
+ * on its own.  The work item is never submitted before its delay elapsed.
+ * The new slack applies from the next time the item is scheduled.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param slack the maximum submission delay, must be a relative timeout
+ * (K_NO_WAIT to disable slack).
+ */
+void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+				k_timeout_t slack);
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 /**
  * @brief Get the parent delayable work structure from a work pointer.
  *
@@ -3909,6 +4265,11 @@ struct k_work_delayable {
 
 	/* The queue to which the work should be submitted. */
 	struct k_work_q *queue;
+
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* Ticks by which the submission may be delayed. */
+	k_ticks_t slack;
+#endif
 };
 
 #define Z_WORK_DELAYABLE_INITIALIZER(work_handler) { \
@@ -4083,6 +4444,198 @@ static inline k_tid_t k_work_queue_thread_get(struct k_work_q *queue)
 
 /** @} */
 
+#ifdef CONFIG_WORK_POOL
+
+/**
+ * @defgroup work_pool_apis Work Pool APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/** Submit a work item to a pool without a CPU preference. */
+#define K_WORK_POOL_ANY_CPU (-1)
+
+/** @brief Statistics of a work pool worker. */
+struct k_work_pool_stats {
+	/** Number of work items run by the worker */
+	uint64_t executed;
+	/** Number of those taken from another worker */
+	uint64_t stolen;
+	/** Number of work items currently queued to the worker */
+	uint32_t depth;
+	/** Maximum value of depth since the last reset */
+	uint32_t max_depth;
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+struct k_work_pool;
+
+struct k_work_pool_worker {
+	/* The thread that animates the worker. */
+	struct k_thread thread;
+
+	struct k_work_pool *pool;
+
+	/* Chase-Lev deque: only the worker pushes and pops at the
+	 * bottom, other workers steal from the top.
+	 */
+	atomic_t top;
+	atomic_t bottom;
+	atomic_ptr_t slots[CONFIG_WORK_POOL_DEQUE_SIZE];
+
+	/* Items submitted from outside the worker, and their number,
+	 * protected by the pool lock.
+	 */
+	sys_slist_t inbox;
+	uint32_t inbox_len;
+
+	/* Item being run, and that item again if it was resubmitted while
+	 * it ran, protected by the pool lock.  Only this worker may run
+	 * it again, so that the handler is never re-entered.
+	 */
+	struct k_work *running;
+	struct k_work *requeued;
+
+	/* Given to wake up the idle worker. */
+	struct k_sem wake;
+
+	struct k_work_pool_stats stats;
+
+	uint8_t id;
+
+#ifdef CONFIG_OBJ_CORE_WORK_POOL
+	struct k_obj_core obj_core;
+#endif
+};
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/** @brief A pool of worker threads processing k_work items. */
+struct k_work_pool {
+	/* Protects the work item flags and the worker inboxes. */
+	struct k_spinlock lock;
+
+	struct k_work_pool_worker *workers;
+	struct z_thread_stack_element *stacks;
+	size_t stack_size;
+	uint8_t num_workers;
+	bool no_yield;
+
+	/* Bitmap of idle workers. */
+	atomic_t idle;
+};
+
+/**
+ * @brief Statically define a work pool.
+ *
+ * The pool must still be started with k_work_pool_start().
+ *
+ * @param name Name of the work pool.
+ * @param n_workers Number of workers, usually CONFIG_MP_MAX_NUM_CPUS.
+ * @param stack_sz Stack size of each worker thread, in bytes.
+ */
+#define K_WORK_POOL_DEFINE(name, n_workers, stack_sz)			\
+	static K_THREAD_STACK_ARRAY_DEFINE(_wpstacks_##name,		\
+					   n_workers, stack_sz);	\
+	static struct k_work_pool_worker _wpworkers_##name[n_workers];	\
+	struct k_work_pool name = {					\
+		.workers = _wpworkers_##name,				\
+		.stacks = &(_wpstacks_##name[0][0]),			\
+		.stack_size = stack_sz,					\
+		.num_workers = n_workers,				\
+	}
+
+/**
+ * @brief Start the workers of a work pool.
+ *
+ * Worker N is pinned to CPU N when CONFIG_SCHED_CPU_MASK is enabled and
+ * the pool has no more workers than there are CPUs.  The name, no_yield
+ * and essential settings of @p cfg apply to all workers.
+ *
+ * @param pool Work pool defined with K_WORK_POOL_DEFINE().
+ * @param prio Priority of the worker threads.
+ * @param cfg Optional configuration, may be NULL.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the pool has no or more than 32 workers.
+ */
+int k_work_pool_start(struct k_work_pool *pool, int prio,
+		      const struct k_work_queue_config *cfg);
+
+/**
+ * @brief Submit a work item to a work pool, preferably to run on a CPU.
+ *
+ * The item is queued to the worker of @p cpu, or to the worker of the
+ * submitting CPU with K_WORK_POOL_ANY_CPU, where it runs unless an idle
+ * worker steals it first.  Items submitted from a work item handler
+ * running in the pool are queued to the local worker without locking.
+ *
+ * The work item is any struct k_work initialized with k_work_init().
+ * As with k_work_submit(), submitting an item that is already queued
+ * has no effect, and an item resubmitted while it runs is queued to run
+ * again on the worker running it, so that its handler never runs on two
+ * workers at once.  A work item must not be submitted to a pool and a
+ * work queue at the same time, and k_work_cancel() and k_work_flush()
+ * cannot be used on pool items.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool Work pool.
+ * @param work Work item.
+ * @param cpu Preferred CPU, or K_WORK_POOL_ANY_CPU.
+ *
+ * @retval 0 if the work item was already queued.
+ * @retval 1 if the work item was queued.
+ * @retval 2 if the work item was running and was queued to the worker
+ * running it.
+ * @retval -EBUSY if the work item is being canceled.
+ */
+int k_work_pool_submit_to_cpu(struct k_work_pool *pool, struct k_work *work,
+			      int cpu);
+
+/**
+ * @brief Submit a work item to a work pool.
+ *
+ * Equivalent to k_work_pool_submit_to_cpu() with K_WORK_POOL_ANY_CPU.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool Work pool.
+ * @param work Work item.
+ *
+ * @return as with k_work_pool_submit_to_cpu().
+ */
+static inline int k_work_pool_submit(struct k_work_pool *pool,
+				     struct k_work *work)
+{
+	return k_work_pool_submit_to_cpu(pool, work, K_WORK_POOL_ANY_CPU);
+}
+
+/**
+ * @brief Get the statistics of a work pool worker.
+ *
+ * The same statistics are reported through the object core framework
+ * with CONFIG_OBJ_CORE_STATS_WORK_POOL.
+ *
+ * @param pool Work pool.
+ * @param worker Index of the worker.
+ * @param stats Storage for the statistics.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p worker is out of range.
+ */
+int k_work_pool_stats_get(struct k_work_pool *pool, unsigned int worker,
+			  struct k_work_pool_stats *stats);
+
+/** @} */
+
+#endif /* CONFIG_WORK_POOL */
+
 struct k_work_user;
 
 /**
@@ -4438,6 +4991,19 @@ struct k_msgq {
 	/** Number of used messages */
 	uint32_t used_msgs;
 
+#if defined(CONFIG_MSGQ_CLAIM) || defined(__DOXYGEN__)
+	/** Slot claimed by a producer, or NULL */
+	char *put_claim;
+	/** Number of slots from the producer's claimed slot to the write pointer */
+	uint32_t put_claim_len;
+	/** Slot claimed by a consumer, or NULL */
+	char *get_claim;
+	/** Number of slots from the consumer's claimed slot to the read pointer */
+	uint32_t get_claim_len;
+	/** Wait queue of the threads waiting for a claim to end */
+	_wait_q_t claim_wait_q;
+#endif
+
 	Z_DECL_POLL_EVENT
 
 	/** Message queue */
@@ -4454,6 +5020,13 @@ struct k_msgq {
  */
 
 
+#ifdef CONFIG_MSGQ_CLAIM
+#define Z_MSGQ_CLAIM_INIT(obj) \
+	.claim_wait_q = Z_WAIT_Q_INIT(&obj.claim_wait_q),
+#else
+#define Z_MSGQ_CLAIM_INIT(obj)
+#endif
+
 #define Z_MSGQ_INITIALIZER(obj, q_buffer, q_msg_size, q_max_msgs) \
 	{ \
 	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
@@ -4464,6 +5037,7 @@ struct k_msgq {
 	.read_ptr = q_buffer, \
 	.write_ptr = q_buffer, \
 	.used_msgs = 0, \
+	Z_MSGQ_CLAIM_INIT(obj) \
 	Z_POLL_EVENT_OBJ_INIT(obj) \
 	}
 
@@ -4648,6 +5222,9 @@ __syscall int k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx);
  * buffer. Any threads that are blocked waiting to send a message to the
  * message queue are unblocked and see an -ENOMSG error code.
  *
+ * A slot claimed with k_msgq_put_claim() stays claimed, and the message
+ * committed in it is kept.
+ *
  * @param msgq Address of the message queue.
  */
 __syscall void k_msgq_purge(struct k_msgq *msgq);
@@ -4678,7 +5255,12 @@ __syscall void  k_msgq_get_attrs(struct k_msgq *msgq,
 
 static inline uint32_t z_impl_k_msgq_num_free_get(struct k_msgq *msgq)
 {
+#ifdef CONFIG_MSGQ_CLAIM
+	return msgq->max_msgs - msgq->used_msgs - msgq->put_claim_len -
+	       msgq->get_claim_len;
+#else
 	return msgq->max_msgs - msgq->used_msgs;
+#endif
 }
 
 /**
@@ -4697,6 +5279,97 @@ static inline uint32_t z_impl_k_msgq_num_used_get(struct k_msgq *msgq)
 	return msgq->used_msgs;
 }
 
+#if defined(CONFIG_MSGQ_CLAIM) || defined(__DOXYGEN__)
+
+/**
+ * @brief Claim a free slot of a message queue to write a message in place.
+ *
+ * This routine reserves the next slot of the message queue's ring buffer
+ * and returns its address in @a slot, so that the message can be written
+ * there directly instead of being copied by k_msgq_put().  The message
+ * is queued when the slot is committed with k_msgq_put_commit().
+ *
+ * Only one slot may be claimed by producers at a time: other calls wait
+ * until it is committed.  Messages put by k_msgq_put() in the meantime
+ * are queued after the claimed slot, and are only received once it has
+ * been committed.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note Not available to user mode threads.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Set to the address of the claimed slot, which is
+ *             msg_size bytes long.
+ * @param timeout Waiting period to claim a slot, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Slot claimed.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_msgq_put_claim(struct k_msgq *msgq, void **slot, k_timeout_t timeout);
+
+/**
+ * @brief Queue the message written in a claimed slot of a message queue.
+ *
+ * The message is given to the receivers in the same way as a message
+ * put with k_msgq_put(), including k_poll() notifications.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Slot returned by k_msgq_put_claim().
+ *
+ * @retval 0 Message queued.
+ * @retval -EINVAL @a slot is not the slot claimed by a producer.
+ */
+int k_msgq_put_commit(struct k_msgq *msgq, void *slot);
+
+/**
+ * @brief Claim the oldest message of a message queue to read it in place.
+ *
+ * This routine removes the oldest message from the message queue, as
+ * k_msgq_get() does, but returns its address in the ring buffer in
+ * @a slot instead of copying it.  The slot is not reused for new messages
+ * until it is released with k_msgq_get_release().
+ *
+ * Only one message may be claimed by consumers at a time: other calls
+ * wait until it is released.  Messages received by k_msgq_get() in the
+ * meantime do not make room for new messages until then.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note Not available to user mode threads.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Set to the address of the message.
+ * @param timeout Waiting period to receive a message, or one of the
+ *                special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message claimed.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_msgq_get_claim(struct k_msgq *msgq, void **slot, k_timeout_t timeout);
+
+/**
+ * @brief Release a message claimed from a message queue.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Slot returned by k_msgq_get_claim().
+ *
+ * @retval 0 Slot released.
+ * @retval -EINVAL @a slot is not the slot claimed by a consumer.
+ */
+int k_msgq_get_release(struct k_msgq *msgq, void *slot);
+
+#endif /* CONFIG_MSGQ_CLAIM */
+
 /** @} */
 
 /**
@@ -5018,6 +5691,72 @@ __syscall int k_pipe_get(struct k_pipe *pipe, void *data,
 			 size_t bytes_to_read, size_t *bytes_read,
 			 size_t min_xfer, k_timeout_t timeout);
 
+/** Buffer of a scatter/gather pipe transfer */
+struct k_pipe_vec {
+	/** Address of the buffer */
+	void *data;
+	/** Size of the buffer (in bytes) */
+	size_t len;
+};
+
+/**
+ * @brief Write data gathered from several buffers to a pipe.
+ *
+ * This routine works like k_pipe_put(), writing the contents of the
+ * buffers described by @a vec one after the other, as a single write of
+ * their total size. The buffers must stay valid until the routine returns.
+ *
+ * @note Only available with CONFIG_PIPES_VEC. From user mode, at most
+ * CONFIG_PIPES_VEC_MAX buffers can be passed.
+ *
+ * @param pipe Address of the pipe.
+ * @param vec Array of buffers to write data from.
+ * @param vec_cnt Number of buffers in @a vec.
+ * @param bytes_written Address of area to hold the number of bytes written.
+ * @param min_xfer Minimum number of bytes to write.
+ * @param timeout Waiting period to wait for the data to be written,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 At least @a min_xfer bytes of data were written.
+ * @retval -EINVAL invalid parameters supplied
+ * @retval -EIO Returned without waiting; zero data bytes were written.
+ * @retval -EAGAIN Waiting period timed out; between zero and @a min_xfer
+ *                 minus one data bytes were written.
+ */
+__syscall int k_pipe_put_vec(struct k_pipe *pipe,
+			     const struct k_pipe_vec *vec, size_t vec_cnt,
+			     size_t *bytes_written, size_t min_xfer,
+			     k_timeout_t timeout);
+
+/**
+ * @brief Read data from a pipe, scattering it to several buffers.
+ *
+ * This routine works like k_pipe_get(), filling the buffers described by
+ * @a vec one after the other, as a single read of their total size. The
+ * buffers must stay valid until the routine returns.
+ *
+ * @note Only available with CONFIG_PIPES_VEC. From user mode, at most
+ * CONFIG_PIPES_VEC_MAX buffers can be passed.
+ *
+ * @param pipe Address of the pipe.
+ * @param vec Array of buffers to place the data read from the pipe.
+ * @param vec_cnt Number of buffers in @a vec.
+ * @param bytes_read Address of area to hold the number of bytes read.
+ * @param min_xfer Minimum number of data bytes to read.
+ * @param timeout Waiting period to wait for the data to be read,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 At least @a min_xfer bytes of data were read.
+ * @retval -EINVAL invalid parameters supplied
+ * @retval -EIO Returned without waiting; zero data bytes were read.
+ * @retval -EAGAIN Waiting period timed out; between zero and @a min_xfer
+ *                 minus one data bytes were read.
+ */
+__syscall int k_pipe_get_vec(struct k_pipe *pipe,
+			     const struct k_pipe_vec *vec, size_t vec_cnt,
+			     size_t *bytes_read, size_t min_xfer,
+			     k_timeout_t timeout);
+
 /**
  * @brief Query the number of bytes that may be read from @a pipe.
  *
@@ -5312,10 +6051,68 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
 
 /* kernel synchronized heap struct */
 
+#if defined(CONFIG_HEAP_MAGAZINES) || defined(__DOXYGEN__)
+
+/* Smallest magazine size class, in bytes */
+#define Z_HEAP_MAG_MIN_SIZE 16U
+
+/* Number of power of two size classes served by the magazines */
+#define Z_HEAP_MAG_CLASSES \
+	(LOG2(CONFIG_HEAP_MAGAZINE_MAX_SIZE) - LOG2(Z_HEAP_MAG_MIN_SIZE) + 1)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_HEAP_MAGAZINE_MAX_SIZE),
+	     "CONFIG_HEAP_MAGAZINE_MAX_SIZE must be a power of two");
+
+/**
+ * @brief k_heap magazine cache statistics
+ */
+struct k_heap_cache_stats {
+	/** Allocations served from a magazine */
+	uint64_t alloc_hits;
+	/** Cacheable allocations that found their magazine empty */
+	uint64_t alloc_misses;
+	/** Frees kept in a magazine */
+	uint64_t free_hits;
+	/** Batches of blocks taken from the heap */
+	uint64_t refills;
+	/** Batches of blocks returned to the heap */
+	uint64_t flushes;
+	/** Bytes currently held in the magazines */
+	size_t cached_bytes;
+};
+
+/* A stack of free blocks of one size class */
+struct z_heap_magazine {
+	uint8_t rounds;
+	void *objs[CONFIG_HEAP_MAGAZINE_ROUNDS];
+};
+
+struct z_heap_cache_cpu {
+	struct k_spinlock lock;
+	struct z_heap_magazine mags[Z_HEAP_MAG_CLASSES];
+	struct k_heap_cache_stats stats;
+};
+
+/**
+ * @brief Per-CPU magazine cache of a k_heap
+ *
+ * Must be attached to a single heap with k_heap_cache_attach().
+ */
+struct k_heap_cache {
+	struct z_heap_cache_cpu cpus[CONFIG_MP_MAX_NUM_CPUS];
+	/* Threads about to pend on the heap, see kheap.c */
+	atomic_t waiters;
+};
+
+#endif /* CONFIG_HEAP_MAGAZINES */
+
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_HEAP_MAGAZINES
+	struct k_heap_cache *cache;
+#endif
 };
 
 /**
@@ -5419,10 +6216,59 @@ void *k_heap_realloc(struct k_heap *h, void *ptr, size_t bytes, k_timeout_t time
  */
 void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 
+#if defined(CONFIG_HEAP_MAGAZINES) || defined(__DOXYGEN__)
+
+/**
+ * @brief Attach a per-CPU magazine cache to a k_heap
+ *
+ * Once attached, allocations of up to CONFIG_HEAP_MAGAZINE_MAX_SIZE
+ * bytes with no more than pointer alignment are rounded up to a power
+ * of two and served from the calling CPU's magazines when possible,
+ * without taking the heap lock.  Blocks are moved between the
+ * magazines and the heap in batches.
+ *
+ * Must be called before the heap is used by more than one thread.  A
+ * cache cannot be detached.
+ *
+ * @param h Heap to attach the cache to
+ * @param cache Zero-initialized cache object
+ */
+void k_heap_cache_attach(struct k_heap *h, struct k_heap_cache *cache);
+
+/**
+ * @brief Return all blocks held by a heap's magazines to the heap
+ *
+ * This is done automatically before an allocation from the heap fails
+ * or blocks.  No effect if no cache is attached.
+ *
+ * @param h Heap whose cache to flush
+ */
+void k_heap_cache_flush(struct k_heap *h);
+
+/**
+ * @brief Get the statistics of a heap's magazine cache
+ *
+ * @param h Heap whose cache to query
+ * @param stats Sum of the statistics of all CPUs
+ *
+ * @retval 0 on success
+ * @retval -EINVAL no cache is attached to the heap
+ */
+int k_heap_cache_stats_get(struct k_heap *h, struct k_heap_cache_stats *stats);
+
+#endif /* CONFIG_HEAP_MAGAZINES */
+
 /* Hand-calculated minimum heap sizes needed to return a successful
  * 1-byte allocation.  See details in lib/os/heap.[ch]
  */
+#ifdef CONFIG_SYS_HEAP_TLSF
+/* Plus the TLSF bucket bitmap and the additional free list heads */
+#define Z_HEAP_MIN_SIZE (((sizeof(void *) > 4) ? 56 : 44) +		\
+			 (32U << CONFIG_SYS_HEAP_TLSF_SL_BITS) / 8U +	\
+			 (2U << CONFIG_SYS_HEAP_TLSF_SL_BITS) * 4U)
+#else
 #define Z_HEAP_MIN_SIZE ((sizeof(void *) > 4) ? 56 : 44)
+#endif
 
 /**
  * @brief Define a static k_heap in the specified linker section
@@ -5888,6 +6734,88 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+#if defined(CONFIG_POLL_SET) || defined(__DOXYGEN__)
+
+/**
+ * @brief Persistent poll set
+ *
+ * Events are registered with their objects once, when added to the set,
+ * instead of on every k_poll() call. An event whose object becomes ready
+ * is moved to the ready list of the set, so waiting on the set costs time
+ * proportional to the number of ready events, not of registered ones.
+ */
+struct k_poll_set {
+	/** @cond INTERNAL_HIDDEN */
+	struct z_poller poller;
+	sys_dlist_t ready;
+	sys_dlist_t returned;
+	_wait_q_t wait_q;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * @param set Address of the poll set.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add an event to a poll set.
+ *
+ * The event is registered with its object until removed with
+ * k_poll_set_remove(). It must have been initialized with
+ * k_poll_event_init() or K_POLL_EVENT_INITIALIZER(), must stay valid while
+ * it is in the set, and cannot be passed to k_poll() or to another set at
+ * the same time.
+ *
+ * @param set Address of the poll set.
+ * @param event Event to add.
+ *
+ * @retval 0 Event added.
+ * @retval -EBUSY Event is already registered.
+ */
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove an event from a poll set.
+ *
+ * @param set Address of the poll set.
+ * @param event Event to remove.
+ *
+ * @retval 0 Event removed.
+ * @retval -EINVAL Event is not in @a set.
+ */
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to be ready.
+ *
+ * This routine returns the events of @a set that are ready, in the order
+ * they became ready, waiting for at least one of them if needed. Their
+ * @a state field tells what happened, like with k_poll().
+ *
+ * Events are level triggered: the events returned by one call are armed
+ * again by the next call on the same set, which returns them again right
+ * away if their condition is still met. The caller is thus expected to
+ * consume the objects of the returned events (take the semaphore, get the
+ * data, reset the signal) before waiting again, and a set is meant to be
+ * waited on by a single thread.
+ *
+ * @param set Address of the poll set.
+ * @param events Array receiving the addresses of the ready events.
+ * @param max_events Size of @a events, must be greater than zero.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of events stored in @a events (greater than zero)
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **events,
+		    int max_events, k_timeout_t timeout);
+
+#endif /* CONFIG_POLL_SET */
+
 /** @} */
 
 /**
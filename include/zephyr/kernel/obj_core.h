@@ -59,6 +59,8 @@
 #define K_OBJ_TYPE_THREAD_ID     K_OBJ_TYPE_ID_GEN("THRD")
 /** Timer object type */
 #define K_OBJ_TYPE_TIMER_ID      K_OBJ_TYPE_ID_GEN("TIMR")
+/** Work pool worker object type */
+#define K_OBJ_TYPE_WORK_POOL_ID  K_OBJ_TYPE_ID_GEN("WPOL")
 
 struct k_obj_type;
 struct k_obj_core;
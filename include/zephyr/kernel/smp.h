@@ -8,6 +8,7 @@
 #define ZEPHYR_INCLUDE_KERNEL_SMP_H_
 
 #include <stdbool.h>
+#include <stdint.h>
 
 typedef void (*smp_init_fn)(void *arg);
 
@@ -68,4 +69,42 @@ void k_smp_cpu_start(int id, smp_init_fn fn, void *arg);
 void k_smp_cpu_resume(int id, smp_init_fn fn, void *arg,
 		      bool reinit_timer, bool invoke_sched);
 
+/**
+ * @brief Scheduler IPI statistics of a CPU.
+ *
+ * The counters wrap around on overflow.
+ */
+struct k_ipi_stats {
+	/** IPIs sent to the CPU */
+	uint32_t sent;
+	/** IPI requests for the CPU that were folded into an IPI
+	 *  already pending or not handled yet, instead of being sent
+	 */
+	uint32_t coalesced;
+	/** IPIs handled by the CPU */
+	uint32_t received;
+};
+
+/**
+ * @brief Get the scheduler IPI statistics of a CPU.
+ *
+ * Broadcast IPIs count as sent to every CPU but the sender.
+ *
+ * @note Only available with CONFIG_SCHED_IPI_STATS.
+ *
+ * @param id ID of the CPU.
+ * @param stats Filled with the statistics of the CPU.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @a id is not a valid CPU ID.
+ */
+int k_ipi_stats_get(int id, struct k_ipi_stats *stats);
+
+/**
+ * @brief Reset the scheduler IPI statistics of all CPUs.
+ *
+ * @note Only available with CONFIG_SCHED_IPI_STATS.
+ */
+void k_ipi_stats_reset(void);
+
 #endif /* ZEPHYR_INCLUDE_KERNEL_SMP_H_ */
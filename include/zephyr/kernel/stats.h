@@ -10,6 +10,20 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#if defined(CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS) || defined(__DOXYGEN__)
+/** Number of buckets of a duration histogram */
+#define K_USAGE_HIST_BUCKETS CONFIG_SCHED_USAGE_HISTOGRAM_BUCKETS
+
+/**
+ * Histogram of durations in cycles, with log2 buckets: bucket 0 counts
+ * the durations of 0 and 1 cycle, bucket i those of 2^i to 2^(i+1) - 1
+ * cycles, and the last bucket all the longer ones as well.
+ */
+struct k_usage_hist {
+	uint32_t  buckets[K_USAGE_HIST_BUCKETS];  /**< \# of durations */
+};
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS */
+
 /**
  * Structure used to track internal statistics about both thread
  * and CPU usage.
@@ -27,6 +41,15 @@ struct k_cycle_stats {
 	uint32_t  num_windows;  /**< \# of usage windows */
 	/** @} */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#if defined(CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS) || defined(__DOXYGEN__)
+	/**
+	 * @name Fields available when CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS is selected.
+	 * @{
+	 */
+	struct k_usage_hist  sched_delay;  /**< delays from ready to running */
+	struct k_usage_hist  run_slice;    /**< lengths of usage windows */
+	/** @} */
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS */
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
@@ -47,11 +47,18 @@ struct k_thread;
  * CONFIG_PIPES has been selected.
  */
 
+struct k_pipe_vec;
+
 struct _pipe_desc {
 	sys_dnode_t      node;
 	unsigned char   *buffer;         /* Position in src/dest buffer */
 	size_t           bytes_to_xfer;  /* # bytes left to transfer */
 	struct k_thread *thread;         /* Back pointer to pended thread */
+#ifdef CONFIG_PIPES_VEC
+	const struct k_pipe_vec *vec;    /* Next buffers, NULL if only one */
+	size_t           vec_cnt;        /* # of next buffers */
+	size_t           buffer_bytes;   /* # bytes left in current buffer */
+#endif /* CONFIG_PIPES_VEC */
 };
 
 /* can be used for creating 'dummy' threads, e.g. for pending on objects */
@@ -145,6 +152,11 @@ struct _thread_base {
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	struct k_cycle_stats  usage;   /* Track thread usage statistics */
 #endif /* CONFIG_SCHED_THREAD_USAGE */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS
+	uint32_t  usage_ready0;   /* When made ready, 0 once running */
+	uint32_t  usage_pend0;    /* When pended on a wait queue */
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS */
 };
 
 typedef struct _thread_base _thread_base_t;
@@ -331,6 +343,9 @@ struct k_thread {
 
 	/** current syscall frame pointer */
 	void *syscall_frame;
+
+	/** index of the thread in kernel object permissions, or -1 */
+	int perms_index;
 #endif /* CONFIG_USERSPACE */
 
 
@@ -348,6 +363,11 @@ struct k_thread {
 	/** resource pool */
 	struct k_heap *resource_pool;
 
+#if defined(CONFIG_SYS_ARENA_THREAD)
+	/** scratch arena, see sys_arena_thread_assign() */
+	struct sys_arena *scratch_arena;
+#endif /* CONFIG_SYS_ARENA_THREAD */
+
 #if defined(CONFIG_THREAD_LOCAL_STORAGE)
 	/* Pointer to arch-specific TLS area */
 	uintptr_t tls;
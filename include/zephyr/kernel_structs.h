@@ -175,6 +175,15 @@ struct _cpu {
 	uint8_t swap_ok;
 #endif
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	/* Scheduler IPIs sent to, coalesced for and handled by this CPU */
+	struct {
+		atomic_t sent;
+		atomic_t coalesced;
+		atomic_t received;
+	} ipi_stats;
+#endif
+
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	/*
 	 * [usage0] is used as a timestamp to mark the beginning of an
@@ -184,6 +193,11 @@ struct _cpu {
 
 	uint32_t usage0;
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS
+	/* Beginning of the execution window, regardless of [usage0] updates */
+	uint32_t window0;
+#endif
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	struct k_cycle_stats *usage;
 #endif
@@ -242,6 +256,10 @@ struct z_kernel {
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
 	/* Identify CPUs to send IPIs to at the next scheduling point */
 	atomic_t pending_ipi;
+#ifdef CONFIG_IPI_COALESCE
+	/* CPUs sent an IPI they did not handle yet */
+	atomic_t ipi_in_flight;
+#endif
 #endif
 };
 
@@ -272,6 +290,9 @@ bool z_smp_cpu_mobile(void);
 
 typedef struct {
 	struct _priq_rb waitq;
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS
+	struct k_usage_hist blocked;  /* Time spent by threads waiting */
+#endif
 } _wait_q_t;
 
 /* defined in kernel/priority_queues.c */
@@ -283,6 +304,9 @@ bool z_priq_rb_lessthan(struct rbnode *a, struct rbnode *b);
 
 typedef struct {
 	sys_dlist_t waitq;
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS
+	struct k_usage_hist blocked;  /* Time spent by threads waiting */
+#endif
 } _wait_q_t;
 
 #define Z_WAIT_Q_INIT(wait_q) { SYS_DLIST_STATIC_INIT(&(wait_q)->waitq) }
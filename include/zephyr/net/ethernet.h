@@ -199,6 +199,12 @@ enum ethernet_hw_caps {
 
 	/** TX-Injection supported */
 	ETHERNET_TXINJECTION_MODE	= BIT(20),
+
+	/** TCP segmentation offload (TSO) supported */
+	ETHERNET_HW_TX_TCP_SEG		= BIT(21),
+
+	/** TCP receive coalescing (LRO) supported */
+	ETHERNET_HW_RX_TCP_COALESCE	= BIT(22),
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -152,6 +152,13 @@ int net_send_data(struct net_pkt *pkt);
 #define NET_TC_COUNT 0
 #endif /* CONFIG_NET_TC_TX_COUNT && CONFIG_NET_TC_RX_COUNT */
 
+/* Number of RX queues of the best effort traffic class */
+#if defined(CONFIG_NET_TC_RX_FLOW_QUEUES)
+#define NET_TC_RX_FLOW_COUNT CONFIG_NET_TC_RX_FLOW_QUEUES
+#else
+#define NET_TC_RX_FLOW_COUNT 1
+#endif
+
 /* @endcond */
 
 /**
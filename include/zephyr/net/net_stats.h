@@ -302,6 +302,16 @@ struct net_stats_tc {
 };
 
 
+/**
+ * @brief RX flow queue statistics
+ */
+struct net_stats_rx_flow {
+	/** Number of packets steered to this queue */
+	net_stats_t pkts;
+	/** Number of bytes steered to this queue */
+	net_stats_t bytes;
+};
+
 /**
  * @brief Power management statistics
  */
@@ -378,6 +388,11 @@ struct net_stats {
 	struct net_stats_tc tc;
 #endif
 
+#if NET_TC_RX_FLOW_COUNT > 1
+	/** Statistics of the RX queues of the best effort traffic class */
+	struct net_stats_rx_flow rx_flow[NET_TC_RX_FLOW_COUNT];
+#endif
+
 #if defined(CONFIG_NET_PKT_TXTIME_STATS)
 	/** Network packet TX time statistics */
 	struct net_stats_tx_time tx_time;
@@ -1194,6 +1194,8 @@ struct ifreq {
 #define TCP_KEEPINTVL 3
 /** Number of keepalives before dropping connection */
 #define TCP_KEEPCNT 4
+/** Congestion control algorithm, by name ("reno", "cubic" or "bbr") */
+#define TCP_CONGESTION 5
 
 /** @} */
 
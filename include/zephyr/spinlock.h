@@ -35,6 +35,26 @@ struct z_spinlock_key {
 	int key;
 };
 
+/* Queue node of an MCS spinlock */
+struct z_mcs_node {
+	atomic_ptr_t next;
+	atomic_t locked;
+};
+
+/**
+ * @brief Spinlock contention statistics
+ *
+ * Gathered for MCS spinlocks with CONFIG_MCS_SPINLOCK_STATS.
+ */
+struct k_spinlock_stats {
+	/** Number of times the lock was taken */
+	uint64_t acquisitions;
+	/** Number of times the lock was found held and had to be waited for */
+	uint64_t contended;
+	/** Number of iterations of the busy loops waiting for the lock */
+	uint64_t spins;
+};
+
 /**
  * @brief Kernel Spin Lock
  *
@@ -63,6 +83,27 @@ struct k_spinlock {
 	atomic_t tail;
 #else
 	atomic_t locked;
+#ifdef CONFIG_MCS_SPINLOCKS
+	/*
+	 * MCS spinlocks are a queue of per-CPU nodes, each waiter
+	 * spinning on its own node until its predecessor hands the lock
+	 * over. The lock is held while the queue is not empty.
+	 */
+	atomic_ptr_t mcs_tail;
+	/* Node of the CPU holding the lock */
+	struct z_mcs_node *mcs_owner;
+	/* Node of a CPU out of queue nodes, which takes the lock when the
+	 * queue is empty instead of queuing
+	 */
+	struct z_mcs_node mcs_fallback;
+#ifndef CONFIG_MCS_SPINLOCKS_ALL
+	/* Set by K_SPINLOCK_MCS_INIT for locks to queue their waiters */
+	bool mcs;
+#endif /* CONFIG_MCS_SPINLOCKS_ALL */
+#ifdef CONFIG_MCS_SPINLOCK_STATS
+	struct k_spinlock_stats stats;
+#endif /* CONFIG_MCS_SPINLOCK_STATS */
+#endif /* CONFIG_MCS_SPINLOCKS */
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 
@@ -100,6 +141,49 @@ struct k_spinlock {
  */
 };
 
+/**
+ * @brief Spinlock static initializer queuing its waiters
+ *
+ * With CONFIG_MCS_SPINLOCKS, a spinlock initialized with this is an MCS
+ * lock: the CPUs waiting for it are queued in FIFO order and each one
+ * spins on its own cache line, instead of all of them polling the lock.
+ * This scales better for locks contended by many CPUs, at the cost of a
+ * slower uncontended path. Without CONFIG_MCS_SPINLOCKS, or if
+ * CONFIG_MCS_SPINLOCKS_ALL makes every spinlock an MCS one, this is the
+ * same as a zero-initialized spinlock.
+ */
+#if defined(CONFIG_MCS_SPINLOCKS) && !defined(CONFIG_MCS_SPINLOCKS_ALL)
+#define K_SPINLOCK_MCS_INIT { .mcs = true }
+#else
+#define K_SPINLOCK_MCS_INIT {}
+#endif
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+#ifdef CONFIG_SMP
+static ALWAYS_INLINE bool z_spin_is_mcs(struct k_spinlock *l)
+{
+	ARG_UNUSED(l);
+#if defined(CONFIG_MCS_SPINLOCKS_ALL)
+	return true;
+#elif defined(CONFIG_MCS_SPINLOCKS)
+	return l->mcs;
+#else
+	return false;
+#endif
+}
+
+void z_mcs_lock(struct k_spinlock *l);
+bool z_mcs_trylock(struct k_spinlock *l);
+void z_mcs_unlock(struct k_spinlock *l);
+#endif /* CONFIG_SMP */
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
 /* There's a spinlock validation framework available when asserts are
  * enabled.  It adds a relatively hefty overhead (about 3k or so) to
  * kernel code size, don't use on platforms known to be small.
@@ -203,8 +287,12 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 		arch_spin_relax();
 	}
 #else
-	while (!atomic_cas(&l->locked, 0, 1)) {
-		arch_spin_relax();
+	if (z_spin_is_mcs(l)) {
+		z_mcs_lock(l);
+	} else {
+		while (!atomic_cas(&l->locked, 0, 1)) {
+			arch_spin_relax();
+		}
 	}
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
@@ -258,7 +346,11 @@ static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *
 		goto busy;
 	}
 #else
-	if (!atomic_cas(&l->locked, 0, 1)) {
+	if (z_spin_is_mcs(l)) {
+		if (!z_mcs_trylock(l)) {
+			goto busy;
+		}
+	} else if (!atomic_cas(&l->locked, 0, 1)) {
 		goto busy;
 	}
 #endif /* CONFIG_TICKET_SPINLOCKS */
@@ -325,7 +417,11 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 	 * a memory barrier when used like this, and we don't have a
 	 * Zephyr framework for that.
 	 */
-	atomic_clear(&l->locked);
+	if (z_spin_is_mcs(l)) {
+		z_mcs_unlock(l);
+	} else {
+		atomic_clear(&l->locked);
+	}
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 	arch_irq_unlock(key.key);
@@ -350,6 +446,9 @@ static ALWAYS_INLINE bool z_spin_is_locked(struct k_spinlock *l)
 
 	return !atomic_cas(&l->tail, ticket_val, ticket_val);
 #else
+	if (z_spin_is_mcs(l)) {
+		return atomic_ptr_get(&l->mcs_tail) != NULL;
+	}
 	return l->locked;
 #endif /* CONFIG_TICKET_SPINLOCKS */
 }
@@ -366,7 +465,11 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 #ifdef CONFIG_TICKET_SPINLOCKS
 	atomic_inc(&l->owner);
 #else
-	atomic_clear(&l->locked);
+	if (z_spin_is_mcs(l)) {
+		z_mcs_unlock(l);
+	} else {
+		atomic_clear(&l->locked);
+	}
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 }
@@ -439,6 +542,26 @@ static ALWAYS_INLINE void z_spin_onexit(__maybe_unused k_spinlock_key_t *k)
 	for (k_spinlock_key_t __i K_SPINLOCK_ONEXIT = {}, __key = k_spin_lock(lck); !__i.key;      \
 	     k_spin_unlock(lck, __key), __i.key = 1)
 
+#if defined(CONFIG_MCS_SPINLOCK_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the contention statistics of a spinlock
+ *
+ * Statistics are only gathered for MCS spinlocks, see
+ * @ref K_SPINLOCK_MCS_INIT. They are all zero for other spinlocks.
+ *
+ * @param l A pointer to the spinlock
+ * @param stats Where to store the statistics
+ */
+void k_spin_stats_get(struct k_spinlock *l, struct k_spinlock_stats *stats);
+
+/**
+ * @brief Reset the contention statistics of a spinlock
+ *
+ * @param l A pointer to the spinlock
+ */
+void k_spin_stats_reset(struct k_spinlock *l);
+#endif /* CONFIG_MCS_SPINLOCK_STATS */
+
 /** @} */
 
 #ifdef __cplusplus
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_ARENA_H_
+#define ZEPHYR_INCLUDE_SYS_ARENA_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @defgroup sys_arena_apis Arena Allocator APIs
+ * @ingroup datastructure_apis
+ *
+ * @brief Bump-pointer arena allocator.
+ *
+ * An arena hands out memory from a single buffer by advancing an
+ * offset, and gives it all back at once with sys_arena_reset(), or
+ * back to an earlier point with sys_arena_rewind().  There is no
+ * per-object free, locking, or header, which suits code that builds
+ * many short-lived objects for the duration of a request and drops
+ * them together at its end.
+ *
+ * An arena is not synchronized: it must be owned by a single thread at
+ * a time, or protected by the caller.
+ *
+ * @{
+ */
+
+/** Default alignment of arena allocations, as for k_heap_alloc() */
+#define SYS_ARENA_ALIGN sizeof(void *)
+
+/**
+ * @brief A bump-pointer arena
+ */
+struct sys_arena {
+	/** @cond INTERNAL_HIDDEN */
+	uint8_t *base;
+	size_t size;
+	size_t used;
+	size_t max_used;
+	struct k_heap *heap;
+	/** @endcond */
+};
+
+/**
+ * @brief Arena checkpoint, as returned by sys_arena_checkpoint()
+ */
+typedef size_t sys_arena_mark_t;
+
+/**
+ * @brief Statically define and initialize an arena.
+ *
+ * The arena can be accessed outside the module where it is defined
+ * using:
+ *
+ * @code extern struct sys_arena <name>; @endcode
+ *
+ * @param name Name of the arena.
+ * @param size8 Size of the arena buffer in bytes.
+ */
+#define SYS_ARENA_DEFINE(name, size8) \
+	static uint8_t __noinit __aligned(SYS_ARENA_ALIGN) \
+		_sys_arena_data_##name[size8]; \
+	struct sys_arena name = { \
+		.base = _sys_arena_data_##name, \
+		.size = size8 \
+	}
+
+/**
+ * @brief Initialize an arena over a buffer.
+ *
+ * @param arena Address of the arena.
+ * @param buf Arena buffer.
+ * @param size Size of the buffer in bytes.
+ */
+void sys_arena_init(struct sys_arena *arena, void *buf, size_t size);
+
+/**
+ * @brief Initialize an arena over a block allocated from a k_heap.
+ *
+ * The block is returned to the heap by sys_arena_release().
+ *
+ * @param arena Address of the arena.
+ * @param heap Heap from which to allocate the arena buffer.
+ * @param size Size of the arena buffer in bytes.
+ * @param timeout How long to wait for the heap, or K_NO_WAIT.
+ *
+ * @retval 0 on success.
+ * @retval -ENOMEM if the buffer could not be allocated.
+ */
+int sys_arena_init_from_heap(struct sys_arena *arena, struct k_heap *heap,
+			     size_t size, k_timeout_t timeout);
+
+/**
+ * @brief Release the buffer of an arena.
+ *
+ * Returns the buffer to its heap if it came from one.  All memory
+ * allocated from the arena becomes invalid, and the arena must be
+ * initialized again before being used.
+ *
+ * @param arena Address of the arena.
+ */
+void sys_arena_release(struct sys_arena *arena);
+
+/**
+ * @brief Allocate aligned memory from an arena.
+ *
+ * @param arena Address of the arena.
+ * @param align Alignment in bytes, must be a power of two.
+ * @param bytes Number of bytes requested.
+ *
+ * @return Pointer to the memory, or NULL if the arena is exhausted.
+ */
+static inline void *sys_arena_aligned_alloc(struct sys_arena *arena,
+					    size_t align, size_t bytes)
+{
+	__ASSERT((align & (align - 1)) == 0, "align must be a power of 2");
+
+	uintptr_t base = (uintptr_t)arena->base;
+	size_t off = ((base + arena->used + align - 1) & ~(uintptr_t)(align - 1)) - base;
+
+	if ((off > arena->size) || (bytes > arena->size - off)) {
+		return NULL;
+	}
+
+	arena->used = off + bytes;
+	arena->max_used = MAX(arena->max_used, arena->used);
+
+	return arena->base + off;
+}
+
+/**
+ * @brief Allocate memory from an arena.
+ *
+ * The memory is aligned on SYS_ARENA_ALIGN.
+ *
+ * @param arena Address of the arena.
+ * @param bytes Number of bytes requested.
+ *
+ * @return Pointer to the memory, or NULL if the arena is exhausted.
+ */
+static inline void *sys_arena_alloc(struct sys_arena *arena, size_t bytes)
+{
+	return sys_arena_aligned_alloc(arena, SYS_ARENA_ALIGN, bytes);
+}
+
+/**
+ * @brief Take a checkpoint of an arena.
+ *
+ * Checkpoints nest: rewinding to a checkpoint frees everything
+ * allocated since, including later checkpoints, which must not be
+ * used afterwards.
+ *
+ * @param arena Address of the arena.
+ *
+ * @return Checkpoint to pass to sys_arena_rewind().
+ */
+static inline sys_arena_mark_t sys_arena_checkpoint(const struct sys_arena *arena)
+{
+	return arena->used;
+}
+
+/**
+ * @brief Free everything allocated from an arena since a checkpoint.
+ *
+ * @param arena Address of the arena.
+ * @param mark Checkpoint returned by sys_arena_checkpoint().
+ */
+static inline void sys_arena_rewind(struct sys_arena *arena, sys_arena_mark_t mark)
+{
+	__ASSERT(mark <= arena->used, "checkpoint was already rewound");
+
+	arena->used = mark;
+}
+
+/**
+ * @brief Free everything allocated from an arena.
+ *
+ * @param arena Address of the arena.
+ */
+static inline void sys_arena_reset(struct sys_arena *arena)
+{
+	arena->used = 0;
+}
+
+/**
+ * @brief Get the number of bytes in use in an arena.
+ *
+ * This includes alignment padding.
+ *
+ * @param arena Address of the arena.
+ *
+ * @return Bytes in use.
+ */
+static inline size_t sys_arena_used_get(const struct sys_arena *arena)
+{
+	return arena->used;
+}
+
+/**
+ * @brief Get the most bytes ever in use in an arena.
+ *
+ * Useful to size the arena of a given workload.
+ *
+ * @param arena Address of the arena.
+ *
+ * @return High watermark in bytes.
+ */
+static inline size_t sys_arena_max_used_get(const struct sys_arena *arena)
+{
+	return arena->max_used;
+}
+
+#if defined(CONFIG_SYS_ARENA_THREAD) || defined(__DOXYGEN__)
+
+/**
+ * @brief Assign a scratch arena to a thread.
+ *
+ * A thread has no scratch arena by default, and threads do not
+ * inherit the scratch arena of their parent.  An arena must not be
+ * the scratch arena of more than one thread at a time.
+ *
+ * @param thread Target thread.
+ * @param arena Arena to use as the thread's scratch arena, or NULL.
+ */
+static inline void sys_arena_thread_assign(struct k_thread *thread,
+					   struct sys_arena *arena)
+{
+	thread->scratch_arena = arena;
+}
+
+/**
+ * @brief Get the scratch arena of the current thread.
+ *
+ * Only usable from supervisor threads.
+ *
+ * @return The current thread's scratch arena, or NULL if none.
+ */
+static inline struct sys_arena *sys_arena_scratch_get(void)
+{
+	return k_current_get()->scratch_arena;
+}
+
+#endif /* CONFIG_SYS_ARENA_THREAD */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_ARENA_H_ */
@@ -128,6 +128,11 @@ static int event_walk_op(struct k_thread *thread, void *data)
 	return 0;
 }
 
+static struct k_thread *next_event_thread(struct k_thread *thread)
+{
+	return thread->next_event_link;
+}
+
 static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 				  uint32_t events_mask)
 {
@@ -153,23 +158,17 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	 * is done in three steps:
 	 *
 	 * 1. Walk the waitq and create a linked list of threads to unpend.
-	 * 2. Unpend each of the threads in the linked list
-	 * 3. Ready each of the threads in the linked list
+	 * 2. Set the return values of the threads in the linked list
+	 * 3. Unpend and ready all of them at once
 	 */
 
 	z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
 
-	if (data.head != NULL) {
-		thread = data.head;
-		struct k_thread *next;
-		do {
-			arch_thread_return_value_set(thread, 0);
-			thread->events = events;
-			next = thread->next_event_link;
-			z_sched_wake_thread(thread, false);
-			thread = next;
-		} while (thread != NULL);
+	for (thread = data.head; thread != NULL; thread = thread->next_event_link) {
+		arch_thread_return_value_set(thread, 0);
+		thread->events = events;
 	}
+	z_sched_wake_threads(data.head, next_event_thread);
 
 	z_reschedule(&event->lock, key);
 
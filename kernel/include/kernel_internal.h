@@ -169,6 +169,9 @@ void z_mem_domain_init_thread(struct k_thread *thread);
 /* Memory domain teardown hook, called from z_thread_abort() */
 void z_mem_domain_exit_thread(struct k_thread *thread);
 
+/* Caches the permission index of a thread, called from z_setup_new_thread() */
+void z_thread_perms_index_init(struct k_thread *thread);
+
 /* This spinlock:
  *
  * - Protects the full set of active k_mem_domain objects and their contents
@@ -197,27 +197,30 @@ void z_sched_wake_thread(struct k_thread *thread, bool is_timeout);
 /**
  * Wake up all threads pending on the provided wait queue
  *
- * Convenience function to invoke z_sched_wake() on all threads in the queue
- * until there are no more to wake up.
+ * Equivalent to invoking z_sched_wake() until the queue is empty, but
+ * all threads are made ready under a single hold of the scheduler lock,
+ * with a single ready queue cache update and at most one IPI per CPU.
  *
- * @param wait_q Wait queue to wake up the highest prio thread
- * @param swap_retval Swap return value for woken thread
+ * @param wait_q Wait queue to wake up all threads of
+ * @param swap_retval Swap return value for woken threads
  * @param swap_data Data return value to supplement swap_retval. May be NULL.
- * @retval true If any threads were woken up
- * @retval false If the wait_q was empty
+ * @return Number of threads removed from the wait queue, zero if it was empty
  */
-static inline bool z_sched_wake_all(_wait_q_t *wait_q, int swap_retval,
-				    void *swap_data)
-{
-	bool woken = false;
+int z_sched_wake_all(_wait_q_t *wait_q, int swap_retval, void *swap_data);
 
-	while (z_sched_wake(wait_q, swap_retval, swap_data)) {
-		woken = true;
-	}
-
-	/* True if we woke at least one thread up */
-	return woken;
-}
+/**
+ * Wake up a list of threads
+ *
+ * Batched equivalent of calling z_sched_wake_thread(thread, false) on
+ * @a first and each thread returned by @a next, until it returns NULL.
+ * The threads must already have their return values set.  @a next is
+ * called with the scheduler lock held, before the thread is woken.
+ *
+ * @param first First thread to wake up, may be NULL.
+ * @param next Returns the thread following the given one in the list.
+ */
+void z_sched_wake_threads(struct k_thread *first,
+			  struct k_thread *(*next)(struct k_thread *thread));
 
 /**
  * Atomically put the current thread to sleep on a wait queue, with timeout
@@ -295,6 +298,48 @@ void z_sched_cpu_usage(uint8_t core_id, struct k_thread_runtime_stats *stats);
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS
+/**
+ * @brief Mark the time @a thread gets ready, for its scheduling delay
+ */
+void z_sched_usage_ready(struct k_thread *thread);
+
+/**
+ * @brief Mark the time @a thread gets pended
+ */
+void z_sched_usage_pend(struct k_thread *thread);
+
+/**
+ * @brief Account for the time @a thread was pended on @a wait_q
+ */
+void z_sched_usage_unpend(struct k_thread *thread, _wait_q_t *wait_q);
+#else
+static inline void z_sched_usage_ready(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+}
+
+static inline void z_sched_usage_pend(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+}
+
+static inline void z_sched_usage_unpend(struct k_thread *thread,
+					_wait_q_t *wait_q)
+{
+	ARG_UNUSED(thread);
+	ARG_UNUSED(wait_q);
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS */
+
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+/*
+ * Statistics of kernel objects registering the histogram of their wait
+ * queue, see CONFIG_OBJ_CORE_STATS_WAIT.
+ */
+extern struct k_obj_core_stats_desc z_waitq_stats_desc;
+#endif /* CONFIG_OBJ_CORE_STATS_WAIT */
+
 static inline void z_sched_usage_switch(struct k_thread *thread)
 {
 	ARG_UNUSED(thread);
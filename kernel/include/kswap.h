@@ -249,6 +249,7 @@ static inline void z_dummy_thread_init(struct k_thread *dummy_thread)
 #endif /* CONFIG_THREAD_STACK_INFO */
 #ifdef CONFIG_USERSPACE
 	dummy_thread->mem_domain_info.mem_domain = &k_mem_domain_default;
+	dummy_thread->perms_index = -1;
 #endif /* CONFIG_USERSPACE */
 #if (K_HEAP_MEM_POOL_SIZE > 0)
 	k_thread_system_pool_assign(dummy_thread);
@@ -161,12 +161,47 @@ static ALWAYS_INLINE struct prio_info get_prio_info(int8_t old_prio)
 	return ret;
 }
 
+#ifdef CONFIG_SCHED_DEADLINE
+/* With deadlines, each level is kept sorted by deadline.  Walk it
+ * from the tail: a thread being readied usually has the latest
+ * deadline of its level (periodic EDF work re-arms deadlines in the
+ * future), so in the common case this is O(1).  Equal deadlines stay
+ * in FIFO order.
+ */
+static ALWAYS_INLINE void z_priq_mq_level_add(sys_dlist_t *l,
+					      struct k_thread *thread)
+{
+	sys_dnode_t *n;
+
+	for (n = sys_dlist_peek_tail(l); n != NULL; n = sys_dlist_peek_prev(l, n)) {
+		struct k_thread *t = CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
+
+		if (z_sched_prio_cmp(thread, t) <= 0) {
+			sys_dnode_t *succ = sys_dlist_peek_next(l, n);
+
+			if (succ == NULL) {
+				sys_dlist_append(l, &thread->base.qnode_dlist);
+			} else {
+				sys_dlist_insert(succ, &thread->base.qnode_dlist);
+			}
+			return;
+		}
+	}
+
+	sys_dlist_prepend(l, &thread->base.qnode_dlist);
+}
+#endif /* CONFIG_SCHED_DEADLINE */
+
 static ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq,
 					struct k_thread *thread)
 {
 	struct prio_info pos = get_prio_info(thread->base.prio);
 
+#ifdef CONFIG_SCHED_DEADLINE
+	z_priq_mq_level_add(&pq->queues[pos.offset_prio], thread);
+#else
 	sys_dlist_append(&pq->queues[pos.offset_prio], &thread->base.qnode_dlist);
+#endif /* CONFIG_SCHED_DEADLINE */
 	pq->bitmask[pos.idx] |= BIT(pos.bit);
 }
 
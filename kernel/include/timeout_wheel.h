@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_KERNEL_INCLUDE_TIMEOUT_WHEEL_H_
+#define ZEPHYR_KERNEL_INCLUDE_TIMEOUT_WHEEL_H_
+
+/**
+ * @file
+ * @brief Hierarchical timing wheel backend for the kernel timeout queue
+ *
+ * With CONFIG_TIMEOUT_QUEUE_WHEEL the dticks field of a queued
+ * struct _timeout holds its absolute expiry tick instead of the delta
+ * to the previous timeout.  The wheel is positioned at a "base" tick
+ * (the kernel's curr_tick) and no queued timeout may expire before it.
+ *
+ * None of these functions do any locking; they must be called with
+ * the timeout lock held.
+ */
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Queue a timeout whose absolute expiry tick is in to->dticks */
+void z_timeout_wheel_add(struct _timeout *to);
+
+/* Dequeue a timeout previously queued with z_timeout_wheel_add() */
+void z_timeout_wheel_remove(struct _timeout *to);
+
+/* Earliest expiring timeout (first queued on ties), or NULL if empty */
+struct _timeout *z_timeout_wheel_first(void);
+
+/* Move the wheel base forward, cascading timeouts as needed */
+void z_timeout_wheel_advance(uint64_t tick);
+
+/* Reposition the wheel at an arbitrary tick, shifting every queued
+ * timeout so that its distance from the base is preserved.  O(N),
+ * only used when the tick count is forcibly set.
+ */
+void z_timeout_wheel_rebase(uint64_t tick);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_KERNEL_INCLUDE_TIMEOUT_WHEEL_H_ */
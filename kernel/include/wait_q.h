@@ -31,6 +31,9 @@ static inline void z_waitq_init(_wait_q_t *w)
 			.lessthan_fn = z_priq_rb_lessthan
 		}
 	};
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS
+	w->blocked = (struct k_usage_hist) {};
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS */
 }
 
 static inline struct k_thread *z_waitq_head(_wait_q_t *w)
@@ -47,6 +50,9 @@ static inline struct k_thread *z_waitq_head(_wait_q_t *w)
 static inline void z_waitq_init(_wait_q_t *w)
 {
 	sys_dlist_init(&w->waitq);
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS
+	w->blocked = (struct k_usage_hist) {};
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS */
 }
 
 static inline struct k_thread *z_waitq_head(_wait_q_t *w)
@@ -4,6 +4,7 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/kernel/smp.h>
 #include <kswap.h>
 #include <ksched.h>
 #include <ipi.h>
@@ -13,57 +14,151 @@ extern void z_trace_sched_ipi(void);
 #endif
 
 
+#ifdef CONFIG_SCHED_IPI_STATS
+static void ipi_stats_inc(uint32_t cpu_bitmap, bool sent)
+{
+	while (cpu_bitmap != 0U) {
+		struct _cpu *cpu = &_kernel.cpus[u32_count_trailing_zeros(cpu_bitmap)];
+
+		atomic_inc(sent ? &cpu->ipi_stats.sent : &cpu->ipi_stats.coalesced);
+		cpu_bitmap &= cpu_bitmap - 1U;
+	}
+}
+
+int k_ipi_stats_get(int id, struct k_ipi_stats *stats)
+{
+	if ((id < 0) || (id >= arch_num_cpus())) {
+		return -EINVAL;
+	}
+
+	stats->sent = (uint32_t)atomic_get(&_kernel.cpus[id].ipi_stats.sent);
+	stats->coalesced = (uint32_t)atomic_get(&_kernel.cpus[id].ipi_stats.coalesced);
+	stats->received = (uint32_t)atomic_get(&_kernel.cpus[id].ipi_stats.received);
+
+	return 0;
+}
+
+void k_ipi_stats_reset(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		atomic_clear(&_kernel.cpus[i].ipi_stats.sent);
+		atomic_clear(&_kernel.cpus[i].ipi_stats.coalesced);
+		atomic_clear(&_kernel.cpus[i].ipi_stats.received);
+	}
+}
+#else
+#define ipi_stats_inc(cpu_bitmap, sent) do { } while (false)
+#endif /* CONFIG_SCHED_IPI_STATS */
+
 void flag_ipi(uint32_t ipi_mask)
 {
 #if defined(CONFIG_SCHED_IPI_SUPPORTED)
 	if (arch_num_cpus() > 1) {
-		atomic_or(&_kernel.pending_ipi, (atomic_val_t)ipi_mask);
+		atomic_val_t old;
+
+		old = atomic_or(&_kernel.pending_ipi, (atomic_val_t)ipi_mask);
+		ipi_stats_inc(ipi_mask & (uint32_t)old, false);
 	}
 #endif /* CONFIG_SCHED_IPI_SUPPORTED */
 }
 
-/* Create a bitmask of CPUs that need an IPI. Note: sched_spinlock is held. */
-atomic_val_t ipi_mask_create(struct k_thread *thread)
+/* True if <thread> is worth an IPI to CPU <i>, which is executing
+ * <cpu_thread>.
+ */
+static bool ipi_cpu_wanted(struct k_thread *thread, uint32_t i,
+			   struct k_thread *cpu_thread)
 {
-	if (!IS_ENABLED(CONFIG_IPI_OPTIMIZE)) {
-		return (CONFIG_MP_MAX_NUM_CPUS > 1) ? IPI_ALL_CPUS_MASK : 0;
+	/*
+	 * An IPI absolutely does not need to be sent if ...
+	 * 1. the CPU is not active, or
+	 * 2. <thread> can not execute on the target CPU
+	 * ... and might not need to be sent if ...
+	 * 3. the target CPU's active thread is not preemptible, or
+	 * 4. the target CPU's active thread has a higher priority
+	 *    (Items 3 & 4 may be overridden by a metaIRQ thread)
+	 */
+
+#if defined(CONFIG_SCHED_CPU_MASK)
+	if ((thread->base.cpu_mask & BIT(i)) == 0) {
+		return false;
 	}
+#else
+	ARG_UNUSED(i);
+#endif
 
-	uint32_t  ipi_mask = 0;
+	return (cpu_thread != NULL) &&
+	       (((z_sched_prio_cmp(cpu_thread, thread) < 0) &&
+		 (thread_is_preemptible(cpu_thread))) ||
+		thread_is_metairq(thread));
+}
+
+#ifdef CONFIG_IPI_TARGETED
+/* Only one CPU can run <thread>: pick the CPU executing the least
+ * important thread.  CPUs already due to reschedule are avoided, as
+ * they are expected to pick up a thread made ready before this one.
+ * When the current CPU is the pick, no IPI is needed at all.
+ */
+static atomic_val_t ipi_target_select(struct k_thread *thread)
+{
 	uint32_t  num_cpus = (uint32_t)arch_num_cpus();
 	uint32_t  id = _current_cpu->id;
-	struct k_thread *cpu_thread;
-	bool   executable_on_cpu = true;
+	uint32_t  signalled = (uint32_t)atomic_get(&_kernel.pending_ipi);
+	struct k_thread *target_thread = NULL;
+	uint32_t  target = num_cpus;
+	bool   target_signalled = true;
+
+#ifdef CONFIG_IPI_COALESCE
+	signalled |= (uint32_t)atomic_get(&_kernel.ipi_in_flight);
+#endif
+	signalled &= ~BIT(id);
 
 	for (uint32_t i = 0; i < num_cpus; i++) {
-		if (id == i) {
+		struct k_thread *cpu_thread = _kernel.cpus[i].current;
+		bool is_signalled = (signalled & BIT(i)) != 0U;
+
+		if (!ipi_cpu_wanted(thread, i, cpu_thread)) {
 			continue;
 		}
 
-		/*
-		 * An IPI absolutely does not need to be sent if ...
-		 * 1. the CPU is not active, or
-		 * 2. <thread> can not execute on the target CPU
-		 * ... and might not need to be sent if ...
-		 * 3. the target CPU's active thread is not preemptible, or
-		 * 4. the target CPU's active thread has a higher priority
-		 *    (Items 3 & 4 may be overridden by a metaIRQ thread)
-		 */
+		if ((target_thread == NULL) ||
+		    (target_signalled && !is_signalled) ||
+		    ((target_signalled == is_signalled) &&
+		     (z_sched_prio_cmp(cpu_thread, target_thread) < 0))) {
+			target = i;
+			target_thread = cpu_thread;
+			target_signalled = is_signalled;
+		}
+	}
 
-#if defined(CONFIG_SCHED_CPU_MASK)
-		executable_on_cpu = ((thread->base.cpu_mask & BIT(i)) != 0);
-#endif
+	return ((target == num_cpus) || (target == id)) ? 0 : BIT(target);
+}
+#endif /* CONFIG_IPI_TARGETED */
 
-		cpu_thread = _kernel.cpus[i].current;
-		if ((cpu_thread != NULL) &&
-		    (((z_sched_prio_cmp(cpu_thread, thread) < 0) &&
-		      (thread_is_preemptible(cpu_thread))) ||
-		     thread_is_metairq(thread)) && executable_on_cpu) {
+/* Create a bitmask of CPUs that need an IPI. Note: sched_spinlock is held. */
+atomic_val_t ipi_mask_create(struct k_thread *thread)
+{
+	if (!IS_ENABLED(CONFIG_IPI_OPTIMIZE)) {
+		return (CONFIG_MP_MAX_NUM_CPUS > 1) ? IPI_ALL_CPUS_MASK : 0;
+	}
+
+#ifdef CONFIG_IPI_TARGETED
+	return ipi_target_select(thread);
+#else
+	uint32_t  ipi_mask = 0;
+	uint32_t  num_cpus = (uint32_t)arch_num_cpus();
+	uint32_t  id = _current_cpu->id;
+
+	for (uint32_t i = 0; i < num_cpus; i++) {
+		if ((id != i) &&
+		    ipi_cpu_wanted(thread, i, _kernel.cpus[i].current)) {
 			ipi_mask |= BIT(i);
 		}
 	}
 
 	return (atomic_val_t)ipi_mask;
+#endif /* CONFIG_IPI_TARGETED */
 }
 
 void signal_pending_ipi(void)
@@ -78,12 +173,48 @@ void signal_pending_ipi(void)
 #if defined(CONFIG_SCHED_IPI_SUPPORTED)
 	if (arch_num_cpus() > 1) {
 		uint32_t  cpu_bitmap;
+#if defined(CONFIG_IPI_COALESCE) || defined(CONFIG_SCHED_IPI_STATS)
+		uint32_t  others;
+		unsigned int key;
+
+		/* The caller may be preemptible: read the CPU ID safely */
+		key = arch_irq_lock();
+		others = ~BIT(arch_curr_cpu()->id) & BIT_MASK(arch_num_cpus());
+		arch_irq_unlock(key);
+#endif
+
+#ifdef CONFIG_IPI_COALESCE
+		/* Reaching a scheduling point is as good as handling an
+		 * IPI.  Clearing our bit when not actually rescheduling
+		 * just costs an extra IPI, while never clearing it after
+		 * an IPI got lost would deprive this CPU of IPIs.
+		 */
+		atomic_and(&_kernel.ipi_in_flight, (atomic_val_t)others);
+#endif /* CONFIG_IPI_COALESCE */
 
 		cpu_bitmap = (uint32_t)atomic_clear(&_kernel.pending_ipi);
+
+#ifdef CONFIG_IPI_COALESCE
+		/* CPUs which were sent an IPI they did not handle yet will
+		 * see the current state of the run queue when they do.
+		 */
+		if (cpu_bitmap != 0) {
+			uint32_t  in_flight;
+
+			in_flight = (uint32_t)atomic_or(&_kernel.ipi_in_flight,
+							(atomic_val_t)(cpu_bitmap & others));
+			in_flight &= cpu_bitmap & others;
+			ipi_stats_inc(in_flight, false);
+			cpu_bitmap &= ~in_flight;
+		}
+#endif /* CONFIG_IPI_COALESCE */
+
 		if (cpu_bitmap != 0) {
 #ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+			ipi_stats_inc(cpu_bitmap & others, true);
 			arch_sched_directed_ipi(cpu_bitmap);
 #else
+			ipi_stats_inc(others, true);
 			arch_sched_broadcast_ipi();
 #endif
 		}
@@ -96,6 +227,15 @@ void z_sched_ipi(void)
 	/* NOTE: When adding code to this, make sure this is called
 	 * at appropriate location when !CONFIG_SCHED_IPI_SUPPORTED.
 	 */
+#ifdef CONFIG_IPI_COALESCE
+	/* Anything made ready from now on needs another IPI */
+	atomic_and(&_kernel.ipi_in_flight, ~(atomic_val_t)BIT(_current_cpu->id));
+#endif /* CONFIG_IPI_COALESCE */
+
+#ifdef CONFIG_SCHED_IPI_STATS
+	atomic_inc(&_current_cpu->ipi_stats.received);
+#endif /* CONFIG_SCHED_IPI_STATS */
+
 #ifdef CONFIG_TRACE_SCHED_IPI
 	z_trace_sched_ipi();
 #endif /* CONFIG_TRACE_SCHED_IPI */
@@ -8,14 +8,20 @@
 #include <zephyr/init.h>
 #include <zephyr/linker/linker-defs.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/math_extras.h>
+#include <string.h>
 /* private kernel APIs */
 #include <ksched.h>
 #include <wait_q.h>
 
 void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 {
+	heap->lock = (struct k_spinlock) K_SPINLOCK_MCS_INIT;
 	z_waitq_init(&heap->wait_q);
 	sys_heap_init(&heap->heap, mem, bytes);
+#ifdef CONFIG_HEAP_MAGAZINES
+	heap->cache = NULL;
+#endif
 
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
 }
@@ -62,11 +68,323 @@ SYS_INIT_NAMED(statics_init_pre, statics_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_
 SYS_INIT_NAMED(statics_init_post, statics_init, POST_KERNEL, 0);
 #endif /* CONFIG_DEMAND_PAGING && !CONFIG_LINKER_GENERIC_SECTIONS_PRESENT_AT_BOOT */
 
+#ifdef CONFIG_HEAP_MAGAZINES
+
+/*
+ * Per-CPU magazines, after Bonwick & Adams, "Magazines and Vmem".  Each
+ * CPU keeps a small stack of free blocks per power of two size class,
+ * protected by a lock of its own that is only contended when a thread
+ * migrates while using it.  An empty magazine is refilled with half a
+ * magazine of blocks, and a full one returns half of its blocks, both
+ * under a single hold of the heap lock.  There is no depot layer: the
+ * heap itself plays that role.
+ */
+
+#define MAG_ROUNDS CONFIG_HEAP_MAGAZINE_ROUNDS
+#define MAG_BATCH  (CONFIG_HEAP_MAGAZINE_ROUNDS / 2)
+
+/* cache_reclaim() state of an allocation */
+#define RECLAIM_FLUSHED BIT(0)
+#define RECLAIM_WAITING BIT(1)
+
+static inline size_t class_size(unsigned int c)
+{
+	return (size_t)Z_HEAP_MAG_MIN_SIZE << c;
+}
+
+static inline unsigned int log2_floor(size_t v)
+{
+	return 31U - u32_count_leading_zeros((uint32_t)v);
+}
+
+/* Smallest class whose blocks can hold a request, or -1 */
+static int alloc_class(size_t bytes)
+{
+	if ((bytes == 0U) || (bytes > CONFIG_HEAP_MAGAZINE_MAX_SIZE)) {
+		return -1;
+	}
+
+	if (bytes <= Z_HEAP_MAG_MIN_SIZE) {
+		return 0;
+	}
+
+	return (int)(log2_floor(bytes - 1U) + 1U - LOG2(Z_HEAP_MAG_MIN_SIZE));
+}
+
+/* Largest class a block can serve all requests of, or -1.  Blocks of
+ * twice the largest class size or more are left to the heap.
+ */
+static int free_class(size_t usable)
+{
+	if ((usable < Z_HEAP_MAG_MIN_SIZE) ||
+	    (usable >= 2U * CONFIG_HEAP_MAGAZINE_MAX_SIZE)) {
+		return -1;
+	}
+
+	return (int)(log2_floor(usable) - LOG2(Z_HEAP_MAG_MIN_SIZE));
+}
+
+/* The thread may migrate right after reading the CPU id, which only
+ * costs locality: the magazines are protected by their CPU's lock, not
+ * by running on that CPU.
+ */
+static inline struct z_heap_cache_cpu *cache_cpu(struct k_heap *heap)
+{
+	return &heap->cache->cpus[arch_curr_cpu()->id];
+}
+
+/* Called with the CPU's lock held */
+static void mag_refill(struct k_heap *heap, struct z_heap_cache_cpu *cc,
+		       unsigned int c)
+{
+	struct z_heap_magazine *mag = &cc->mags[c];
+	k_spinlock_key_t key = k_spin_lock(&heap->lock);
+
+	while (mag->rounds < MAG_BATCH) {
+		void *mem = sys_heap_alloc(&heap->heap, class_size(c));
+
+		if (mem == NULL) {
+			break;
+		}
+		mag->objs[mag->rounds++] = mem;
+	}
+
+	k_spin_unlock(&heap->lock, key);
+
+	cc->stats.refills++;
+	cc->stats.cached_bytes += mag->rounds * class_size(c);
+}
+
+/* Called with the CPU's lock held.  Returns the count oldest blocks of
+ * a magazine to the heap, and whether any heap waiter was woken.
+ */
+static bool mag_flush(struct k_heap *heap, struct z_heap_cache_cpu *cc,
+		      unsigned int c, unsigned int count)
+{
+	struct z_heap_magazine *mag = &cc->mags[c];
+	k_spinlock_key_t key = k_spin_lock(&heap->lock);
+	bool woken;
+
+	for (unsigned int i = 0; i < count; i++) {
+		sys_heap_free(&heap->heap, mag->objs[i]);
+	}
+	woken = z_unpend_all(&heap->wait_q) != 0;
+
+	k_spin_unlock(&heap->lock, key);
+
+	mag->rounds -= count;
+	(void)memmove(&mag->objs[0], &mag->objs[count],
+		      mag->rounds * sizeof(mag->objs[0]));
+
+	cc->stats.flushes++;
+	cc->stats.cached_bytes -= count * class_size(c);
+
+	return woken;
+}
+
+static void *cache_alloc(struct k_heap *heap, size_t align, size_t bytes)
+{
+	int c = alloc_class(bytes);
+	void *ret = NULL;
+
+	/* Every block is aligned on at least a pointer size */
+	if ((c < 0) || (align > sizeof(void *))) {
+		return NULL;
+	}
+
+	struct z_heap_cache_cpu *cc = cache_cpu(heap);
+	struct z_heap_magazine *mag = &cc->mags[c];
+	k_spinlock_key_t key = k_spin_lock(&cc->lock);
+
+	if (mag->rounds > 0U) {
+		cc->stats.alloc_hits++;
+	} else {
+		cc->stats.alloc_misses++;
+		mag_refill(heap, cc, c);
+	}
+
+	if (mag->rounds > 0U) {
+		ret = mag->objs[--mag->rounds];
+		cc->stats.cached_bytes -= class_size(c);
+	}
+
+	k_spin_unlock(&cc->lock, key);
+	return ret;
+}
+
+static bool cache_free(struct k_heap *heap, void *mem)
+{
+	/* Only reads the block's own chunk size, which cannot change
+	 * while the block is allocated, so the heap lock is not needed.
+	 */
+	int c = free_class(sys_heap_usable_size(&heap->heap, mem));
+	bool woken = false;
+
+	if (c < 0) {
+		return false;
+	}
+
+	struct z_heap_cache_cpu *cc = cache_cpu(heap);
+	struct z_heap_magazine *mag = &cc->mags[c];
+	k_spinlock_key_t key = k_spin_lock(&cc->lock);
+
+	/* Blocks go straight to the heap while a thread waits on it */
+	if (atomic_get(&heap->cache->waiters) != 0) {
+		k_spin_unlock(&cc->lock, key);
+		return false;
+	}
+
+	if (mag->rounds == MAG_ROUNDS) {
+		woken = mag_flush(heap, cc, c, MAG_BATCH);
+	}
+	mag->objs[mag->rounds++] = mem;
+	cc->stats.free_hits++;
+	cc->stats.cached_bytes += class_size(c);
+
+	k_spin_unlock(&cc->lock, key);
+
+	if (woken) {
+		z_reschedule_unlocked();
+	}
+
+	return true;
+}
+
+/*
+ * Called with the heap lock held after an allocation failed.  Flushes
+ * the magazines once per attempt, and tells if the allocation should be
+ * retried.  The thread is counted as a waiter before flushing, so that
+ * no free can refill the magazines between the flush and the thread
+ * pending: cache_free() checks the count under the same per-CPU locks
+ * that the flush takes.
+ */
+static bool cache_reclaim(struct k_heap *heap, k_spinlock_key_t *key,
+			  uint8_t *state)
+{
+	if (heap->cache == NULL) {
+		return false;
+	}
+
+	if ((*state & RECLAIM_FLUSHED) != 0U) {
+		/* Flush again after the next wakeup */
+		*state &= ~RECLAIM_FLUSHED;
+		return false;
+	}
+
+	if ((*state & RECLAIM_WAITING) == 0U) {
+		atomic_inc(&heap->cache->waiters);
+	}
+	*state |= RECLAIM_FLUSHED | RECLAIM_WAITING;
+
+	k_spin_unlock(&heap->lock, *key);
+	k_heap_cache_flush(heap);
+	*key = k_spin_lock(&heap->lock);
+
+	return true;
+}
+
+static inline void cache_reclaim_done(struct k_heap *heap, uint8_t state)
+{
+	if ((state & RECLAIM_WAITING) != 0U) {
+		atomic_dec(&heap->cache->waiters);
+	}
+}
+
+void k_heap_cache_attach(struct k_heap *heap, struct k_heap_cache *cache)
+{
+	__ASSERT_NO_MSG(heap->cache == NULL);
+
+	heap->cache = cache;
+}
+
+void k_heap_cache_flush(struct k_heap *heap)
+{
+	bool woken = false;
+
+	if (heap->cache == NULL) {
+		return;
+	}
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(heap->cache->cpus); i++) {
+		struct z_heap_cache_cpu *cc = &heap->cache->cpus[i];
+		k_spinlock_key_t key = k_spin_lock(&cc->lock);
+
+		for (unsigned int c = 0; c < Z_HEAP_MAG_CLASSES; c++) {
+			if (cc->mags[c].rounds > 0U) {
+				woken |= mag_flush(heap, cc, c, cc->mags[c].rounds);
+			}
+		}
+
+		k_spin_unlock(&cc->lock, key);
+	}
+
+	if (woken) {
+		z_reschedule_unlocked();
+	}
+}
+
+int k_heap_cache_stats_get(struct k_heap *heap, struct k_heap_cache_stats *stats)
+{
+	if (heap->cache == NULL) {
+		return -EINVAL;
+	}
+
+	*stats = (struct k_heap_cache_stats) {0};
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(heap->cache->cpus); i++) {
+		struct z_heap_cache_cpu *cc = &heap->cache->cpus[i];
+		k_spinlock_key_t key = k_spin_lock(&cc->lock);
+
+		stats->alloc_hits += cc->stats.alloc_hits;
+		stats->alloc_misses += cc->stats.alloc_misses;
+		stats->free_hits += cc->stats.free_hits;
+		stats->refills += cc->stats.refills;
+		stats->flushes += cc->stats.flushes;
+		stats->cached_bytes += cc->stats.cached_bytes;
+
+		k_spin_unlock(&cc->lock, key);
+	}
+
+	return 0;
+}
+
+#else
+
+static inline bool cache_reclaim(struct k_heap *heap, k_spinlock_key_t *key,
+				 uint8_t *state)
+{
+	ARG_UNUSED(heap);
+	ARG_UNUSED(key);
+	ARG_UNUSED(state);
+
+	return false;
+}
+
+static inline void cache_reclaim_done(struct k_heap *heap, uint8_t state)
+{
+	ARG_UNUSED(heap);
+	ARG_UNUSED(state);
+}
+
+#endif /* CONFIG_HEAP_MAGAZINES */
+
 void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 			k_timeout_t timeout)
 {
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	void *ret = NULL;
+	uint8_t reclaim = 0U;
+
+#ifdef CONFIG_HEAP_MAGAZINES
+	if (heap->cache != NULL) {
+		ret = cache_alloc(heap, align, bytes);
+		if (ret != NULL) {
+			SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, heap, timeout);
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, heap, timeout, ret);
+			return ret;
+		}
+	}
+#endif
 
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
@@ -79,6 +397,10 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 	while (ret == NULL) {
 		ret = sys_heap_aligned_alloc(&heap->heap, align, bytes);
 
+		if ((ret == NULL) && cache_reclaim(heap, &key, &reclaim)) {
+			continue;
+		}
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -99,6 +421,8 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 		key = k_spin_lock(&heap->lock);
 	}
 
+	cache_reclaim_done(heap, reclaim);
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, heap, timeout, ret);
 
 	k_spin_unlock(&heap->lock, key);
@@ -120,6 +444,7 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 {
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	void *ret = NULL;
+	uint8_t reclaim = 0U;
 
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
@@ -130,6 +455,10 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 	while (ret == NULL) {
 		ret = sys_heap_aligned_realloc(&heap->heap, ptr, sizeof(void *), bytes);
 
+		if ((ret == NULL) && cache_reclaim(heap, &key, &reclaim)) {
+			continue;
+		}
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -140,6 +469,8 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 		key = k_spin_lock(&heap->lock);
 	}
 
+	cache_reclaim_done(heap, reclaim);
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, realloc, heap, ptr, bytes, timeout, ret);
 
 	k_spin_unlock(&heap->lock, key);
@@ -148,6 +479,13 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
+#ifdef CONFIG_HEAP_MAGAZINES
+	if ((heap->cache != NULL) && (mem != NULL) && cache_free(heap, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+		return;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	sys_heap_free(&heap->heap, mem);
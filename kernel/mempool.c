@@ -5,6 +5,7 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/init.h>
 #include <string.h>
 #include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/util.h>
@@ -61,6 +62,22 @@ void k_free(void *ptr)
 K_HEAP_DEFINE(_system_heap, K_HEAP_MEM_POOL_SIZE);
 #define _SYSTEM_HEAP (&_system_heap)
 
+#ifdef CONFIG_HEAP_MAGAZINES
+static struct k_heap_cache _system_heap_cache;
+
+/* After the heap itself has been initialized, which may only happen at
+ * POST_KERNEL with demand paging.
+ */
+static int system_heap_cache_init(void)
+{
+	k_heap_cache_attach(_SYSTEM_HEAP, &_system_heap_cache);
+
+	return 0;
+}
+
+SYS_INIT(system_heap_cache_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_HEAP_MAGAZINES */
+
 void *k_aligned_alloc(size_t align, size_t size)
 {
 	__ASSERT(align / sizeof(void *) >= 1
@@ -1424,7 +1424,98 @@ static inline struct z_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
-static bool do_page_fault(void *addr, bool pin)
+#ifdef CONFIG_DEMAND_PAGING_BACKGROUND_EVICTION
+static K_SEM_DEFINE(eviction_sem, 0, 1);
+
+/* must be called with interrupts locked */
+static inline void background_eviction_kick(void)
+{
+	if (z_free_page_count < CONFIG_DEMAND_PAGING_FREE_PAGES_LOW) {
+		k_sem_give(&eviction_sem);
+	}
+}
+
+/* Implementation is similar to z_page_frame_evict(), the page frame being
+ * chosen by the eviction algorithm.
+ */
+static int do_background_evict(void)
+{
+	struct z_page_frame *pf;
+	uintptr_t location;
+	bool dirty;
+	int key, ret;
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_sched_lock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	key = irq_lock();
+	pf = do_eviction_select(&dirty);
+	if (pf == NULL) {
+		ret = -ENOMEM;
+		goto out;
+	}
+	LOG_DBG("evicting %p at 0x%lx in background",
+		z_page_frame_to_virt(pf),
+		z_page_frame_to_phys(pf));
+
+	paging_stats_eviction_inc(_current, dirty);
+	ret = page_frame_prepare_locked(pf, &dirty, false, &location);
+	if (ret != 0) {
+		goto out;
+	}
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	irq_unlock(key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	if (dirty) {
+		do_backing_store_page_out(location);
+	}
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	key = irq_lock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	page_frame_free_locked(pf);
+out:
+	irq_unlock(key);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_sched_unlock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	return ret;
+}
+
+/* Refill the pool of free page frames whenever page faults drained it,
+ * so that they rarely have to evict and write back a data page first.
+ */
+static void background_eviction_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		(void)k_sem_take(&eviction_sem, K_FOREVER);
+
+		while (z_free_page_count < CONFIG_DEMAND_PAGING_FREE_PAGES_HIGH) {
+			if (do_background_evict() != 0) {
+				break;
+			}
+		}
+	}
+}
+
+K_KERNEL_THREAD_DEFINE(z_paging_eviction,
+		       CONFIG_DEMAND_PAGING_EVICTION_THREAD_STACK_SIZE,
+		       background_eviction_thread, NULL, NULL, NULL,
+		       K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+#endif /* CONFIG_DEMAND_PAGING_BACKGROUND_EVICTION */
+
+/*
+ * Page in the data page at addr.
+ *
+ * If read_ahead is set, this is not an actual page fault: nothing is done
+ * and false is returned if the data page is not paged out or if there is no
+ * free page frame.
+ */
+static bool do_page_fault(void *addr, bool pin, bool read_ahead)
 {
 	struct z_page_frame *pf;
 	int key, ret;
@@ -1498,14 +1589,22 @@ static bool do_page_fault(void *addr, bool pin)
 		 * no need to go through the following code to
 		 * pull in the data pages. So skip to the end.
 		 */
+		result = !read_ahead;
 		goto out;
 	}
 	__ASSERT(status == ARCH_PAGE_LOCATION_PAGED_OUT,
 		 "unexpected status value %d", status);
 
-	paging_stats_faults_inc(faulting_thread, key);
+	if (!read_ahead) {
+		paging_stats_faults_inc(faulting_thread, key);
+	}
 
 	pf = free_page_frame_list_get();
+	if ((pf == NULL) && read_ahead) {
+		/* Never evict a data page to read ahead another one */
+		result = false;
+		goto out;
+	}
 	if (pf == NULL) {
 		/* Need to evict a page frame */
 		pf = do_eviction_select(&dirty);
@@ -1516,6 +1615,9 @@ static bool do_page_fault(void *addr, bool pin)
 
 		paging_stats_eviction_inc(faulting_thread, dirty);
 	}
+#ifdef CONFIG_DEMAND_PAGING_BACKGROUND_EVICTION
+	background_eviction_kick();
+#endif /* CONFIG_DEMAND_PAGING_BACKGROUND_EVICTION */
 	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
 	__ASSERT(ret == 0, "failed to prepare page frame");
 
@@ -1556,7 +1658,7 @@ static void do_page_in(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, false);
+	ret = do_page_fault(addr, false, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1573,7 +1675,7 @@ static void do_mem_pin(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, true);
+	ret = do_page_fault(addr, true, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1586,9 +1688,46 @@ void k_mem_pin(void *addr, size_t size)
 	virt_region_foreach(addr, size, do_mem_pin);
 }
 
+#if CONFIG_DEMAND_PAGING_READ_AHEAD > 0
+/* Data page following the last one paged in by a fault or read ahead */
+static uint8_t *read_ahead_next;
+
+/* When page faults are sequential, page in the next data pages before they
+ * fault as well, stopping at the first one not paged out.
+ */
+static void page_read_ahead(void *addr)
+{
+	uint8_t *page = (uint8_t *)ROUND_DOWN(addr, CONFIG_MMU_PAGE_SIZE);
+	bool sequential = (page == read_ahead_next);
+
+	read_ahead_next = page + CONFIG_MMU_PAGE_SIZE;
+	if (!sequential) {
+		return;
+	}
+
+	for (int i = 0; i < CONFIG_DEMAND_PAGING_READ_AHEAD; i++) {
+		if (!IN_RANGE((uintptr_t)read_ahead_next,
+			      (uintptr_t)Z_VIRT_RAM_START,
+			      ((uintptr_t)Z_VIRT_RAM_END - 1)) ||
+		    !do_page_fault(read_ahead_next, false, true)) {
+			break;
+		}
+		read_ahead_next += CONFIG_MMU_PAGE_SIZE;
+	}
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD > 0 */
+
 bool z_page_fault(void *addr)
 {
-	return do_page_fault(addr, false);
+	bool ret = do_page_fault(addr, false, false);
+
+#if CONFIG_DEMAND_PAGING_READ_AHEAD > 0
+	if (ret) {
+		page_read_ahead(addr);
+	}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD > 0 */
+
+	return ret;
 }
 
 static void do_mem_unpin(void *addr)
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * Bounded lock-free multi-producer, multi-consumer queue.
+ *
+ * This is Dmitry Vyukov's bounded MPMC queue: every cell of the ring
+ * has a sequence number telling which lap of the ring it is ready for.
+ * A producer claims the cell at enqueue_pos when its sequence equals
+ * the position, by advancing enqueue_pos with a compare-and-swap, then
+ * stores the item and publishes it by setting the sequence to
+ * position + 1.  A consumer does the same at dequeue_pos, waiting for
+ * position + 1 and handing the cell back to the producers of the next
+ * lap with position + capacity.
+ *
+ * Blocking is layered on top like a futex: a thread that finds the
+ * queue empty (or full) takes the lock, counts itself as a waiter,
+ * tries again and only then pends.  The other side checks the waiter
+ * count after publishing a cell and takes the lock to wake a thread
+ * only when it is not zero.  Both the count update and the cell
+ * update are sequentially consistent, so either the waiter sees the
+ * new cell on its second try, or the other side sees the waiter.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+
+#include <zephyr/toolchain.h>
+#include <wait_q.h>
+#include <ksched.h>
+#include <zephyr/sys/check.h>
+#include <zephyr/sys/util.h>
+#include <string.h>
+
+/* Sequence numbers are stored minus the index of their cell, which
+ * makes all-zero cells the initial state of an empty ring.
+ */
+static inline uintptr_t cell_seq(struct k_mpmc *mpmc, struct z_mpmc_cell *cell,
+				 uintptr_t pos)
+{
+	return (uintptr_t)atomic_get(&cell->seq) + (pos & mpmc->mask);
+}
+
+static inline void cell_seq_set(struct k_mpmc *mpmc, struct z_mpmc_cell *cell,
+				uintptr_t pos, uintptr_t seq)
+{
+	(void)atomic_set(&cell->seq, (atomic_val_t)(seq - (pos & mpmc->mask)));
+}
+
+static bool try_put(struct k_mpmc *mpmc, void *data)
+{
+	uintptr_t pos = (uintptr_t)atomic_get(&mpmc->enqueue_pos);
+
+	for (;;) {
+		struct z_mpmc_cell *cell = &mpmc->cells[pos & mpmc->mask];
+		intptr_t dif = (intptr_t)(cell_seq(mpmc, cell, pos) - pos);
+
+		if (dif == 0) {
+			if (atomic_cas(&mpmc->enqueue_pos, (atomic_val_t)pos,
+				       (atomic_val_t)(pos + 1U))) {
+				cell->data = data;
+				cell_seq_set(mpmc, cell, pos, pos + 1U);
+				return true;
+			}
+		} else if (dif < 0) {
+			/* Cell still holds the item of the previous lap */
+			return false;
+		}
+
+		pos = (uintptr_t)atomic_get(&mpmc->enqueue_pos);
+	}
+}
+
+static void *try_get(struct k_mpmc *mpmc)
+{
+	uintptr_t pos = (uintptr_t)atomic_get(&mpmc->dequeue_pos);
+
+	for (;;) {
+		struct z_mpmc_cell *cell = &mpmc->cells[pos & mpmc->mask];
+		intptr_t dif = (intptr_t)(cell_seq(mpmc, cell, pos) - (pos + 1U));
+
+		if (dif == 0) {
+			if (atomic_cas(&mpmc->dequeue_pos, (atomic_val_t)pos,
+				       (atomic_val_t)(pos + 1U))) {
+				void *data = cell->data;
+
+				cell_seq_set(mpmc, cell, pos, pos + mpmc->mask + 1U);
+				return data;
+			}
+		} else if (dif < 0) {
+			/* Cell not published yet: empty */
+			return NULL;
+		}
+
+		pos = (uintptr_t)atomic_get(&mpmc->dequeue_pos);
+	}
+}
+
+static void wake_one(struct k_mpmc *mpmc, atomic_t *waiters, _wait_q_t *wait_q,
+		     int ret)
+{
+	struct k_thread *thread;
+	k_spinlock_key_t key;
+
+	if (atomic_get(waiters) == 0) {
+		return;
+	}
+
+	key = k_spin_lock(&mpmc->lock);
+	thread = z_unpend_first_thread(wait_q);
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread, ret);
+		z_ready_thread(thread);
+		z_reschedule(&mpmc->lock, key);
+	} else {
+		k_spin_unlock(&mpmc->lock, key);
+	}
+}
+
+int k_mpmc_init(struct k_mpmc *mpmc, struct z_mpmc_cell *cells,
+		uint32_t capacity)
+{
+	CHECKIF((capacity < 2U) || !IS_POWER_OF_TWO(capacity)) {
+		return -EINVAL;
+	}
+
+	*mpmc = (struct k_mpmc) {
+		.cells = cells,
+		.mask = capacity - 1U,
+	};
+	memset(cells, 0, capacity * sizeof(*cells));
+	z_waitq_init(&mpmc->get_wait_q);
+	z_waitq_init(&mpmc->put_wait_q);
+
+	return 0;
+}
+
+int k_mpmc_put(struct k_mpmc *mpmc, void *data, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	bool done;
+	int ret = 0;
+
+	__ASSERT(data != NULL, "NULL cannot be queued");
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	while (!try_put(mpmc, data)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMSG;
+		}
+
+		key = k_spin_lock(&mpmc->lock);
+		atomic_inc(&mpmc->put_waiters);
+		done = try_put(mpmc, data);
+		if (done) {
+			k_spin_unlock(&mpmc->lock, key);
+		} else {
+			ret = z_pend_curr(&mpmc->lock, key, &mpmc->put_wait_q,
+					  timeout);
+		}
+		atomic_dec(&mpmc->put_waiters);
+
+		if (done) {
+			break;
+		}
+		if (ret != 0) {
+			return ret;
+		}
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	wake_one(mpmc, &mpmc->get_waiters, &mpmc->get_wait_q, 0);
+
+	return 0;
+}
+
+void *k_mpmc_get(struct k_mpmc *mpmc, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	void *data;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	for (;;) {
+		data = try_get(mpmc);
+		if ((data != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			break;
+		}
+
+		key = k_spin_lock(&mpmc->lock);
+		atomic_inc(&mpmc->get_waiters);
+		data = try_get(mpmc);
+		if (data != NULL) {
+			k_spin_unlock(&mpmc->lock, key);
+			ret = 0;
+		} else {
+			ret = z_pend_curr(&mpmc->lock, key, &mpmc->get_wait_q,
+					  timeout);
+		}
+		atomic_dec(&mpmc->get_waiters);
+
+		if ((data != NULL) || (ret != 0)) {
+			break;
+		}
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	if (data != NULL) {
+		wake_one(mpmc, &mpmc->put_waiters, &mpmc->put_wait_q, 0);
+	}
+
+	return data;
+}
+
+void k_mpmc_cancel_wait(struct k_mpmc *mpmc)
+{
+	wake_one(mpmc, &mpmc->get_waiters, &mpmc->get_wait_q, -ECANCELED);
+}
+
+void *k_mpmc_peek_head(struct k_mpmc *mpmc)
+{
+	uintptr_t pos = (uintptr_t)atomic_get(&mpmc->dequeue_pos);
+	struct z_mpmc_cell *cell = &mpmc->cells[pos & mpmc->mask];
+
+	return (cell_seq(mpmc, cell, pos) == pos + 1U) ? cell->data : NULL;
+}
+
+void *k_mpmc_peek_tail(struct k_mpmc *mpmc)
+{
+	uintptr_t pos = (uintptr_t)atomic_get(&mpmc->enqueue_pos) - 1U;
+	struct z_mpmc_cell *cell = &mpmc->cells[pos & mpmc->mask];
+
+	return (cell_seq(mpmc, cell, pos) == pos + 1U) ? cell->data : NULL;
+}
+
+int k_mpmc_is_empty(struct k_mpmc *mpmc)
+{
+	return (int)(k_mpmc_peek_head(mpmc) == NULL);
+}
+
+#ifdef CONFIG_FIFO_MPMC
+int z_mpmc_fifo_put(struct k_mpmc *mpmc, void *data)
+{
+	bool can_wait = !k_is_in_isr() && !k_is_pre_kernel();
+
+	/* Callers that cannot wait get the item back on a full ring */
+	return (k_mpmc_put(mpmc, data, can_wait ? K_FOREVER : K_NO_WAIT) == 0) ?
+	       0 : -ENOMEM;
+}
+
+void z_mpmc_fifo_put_list(struct k_mpmc *mpmc, void *head, void *tail)
+{
+	void *node = head;
+
+	while (node != NULL) {
+		/* The item belongs to the consumer once put */
+		void *next = (node == tail) ? NULL : *(void **)node;
+
+		int ret = z_mpmc_fifo_put(mpmc, node);
+
+		__ASSERT(ret == 0, "MPMC FIFO full");
+		ARG_UNUSED(ret);
+		node = next;
+	}
+}
+#endif /* CONFIG_FIFO_MPMC */
@@ -36,6 +36,126 @@ static inline void handle_poll_events(struct k_msgq *msgq, uint32_t state)
 }
 #endif /* CONFIG_POLL */
 
+/* With CONFIG_MSGQ_CLAIM, the ring buffer holds, in order:
+ *
+ * - the slot claimed by a consumer and the slots of the messages
+ *   received after it (get_claim_len), which are only freed when the
+ *   claim is released;
+ * - the messages that can be received (used_msgs);
+ * - the slot claimed by a producer and the messages put after it
+ *   (put_claim_len), which can only be received once the claim is
+ *   committed.
+ *
+ * While a claim is outstanding, threads that have to wait pend on
+ * claim_wait_q and try again whenever the queue changes, instead of
+ * having messages handed to or taken from them through wait_q.
+ */
+#ifdef CONFIG_MSGQ_CLAIM
+static inline bool claim_pending(struct k_msgq *msgq)
+{
+	return (msgq->put_claim != NULL) || (msgq->get_claim != NULL);
+}
+
+static inline bool put_claim_pending(struct k_msgq *msgq)
+{
+	return msgq->put_claim != NULL;
+}
+
+static bool claim_waiters_wake(struct k_msgq *msgq)
+{
+	struct k_thread *thread;
+	bool woken = false;
+
+	while ((thread = z_unpend_first_thread(&msgq->claim_wait_q)) != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		woken = true;
+	}
+
+	return woken;
+}
+#else
+static inline bool claim_pending(struct k_msgq *msgq)
+{
+	ARG_UNUSED(msgq);
+
+	return false;
+}
+
+static inline bool put_claim_pending(struct k_msgq *msgq)
+{
+	ARG_UNUSED(msgq);
+
+	return false;
+}
+
+static inline bool claim_waiters_wake(struct k_msgq *msgq)
+{
+	ARG_UNUSED(msgq);
+
+	return false;
+}
+#endif /* CONFIG_MSGQ_CLAIM */
+
+static inline char *next_slot(struct k_msgq *msgq, char *slot)
+{
+	slot += msgq->msg_size;
+
+	return (slot == msgq->buffer_end) ? msgq->buffer_start : slot;
+}
+
+/* Copy a message to the write pointer, returns true if it can be
+ * received right away.
+ */
+static bool msgq_write(struct k_msgq *msgq, const void *data)
+{
+	__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+			msgq->write_ptr < msgq->buffer_end);
+	(void)memcpy(msgq->write_ptr, (char *)data, msgq->msg_size);
+	msgq->write_ptr = next_slot(msgq, msgq->write_ptr);
+
+#ifdef CONFIG_MSGQ_CLAIM
+	if (put_claim_pending(msgq)) {
+		msgq->put_claim_len++;
+		return false;
+	}
+#endif /* CONFIG_MSGQ_CLAIM */
+	msgq->used_msgs++;
+
+	return true;
+}
+
+/* Copy the message at the read pointer */
+static void msgq_read(struct k_msgq *msgq, void *data)
+{
+	(void)memcpy((char *)data, msgq->read_ptr, msgq->msg_size);
+	msgq->read_ptr = next_slot(msgq, msgq->read_ptr);
+	msgq->used_msgs--;
+#ifdef CONFIG_MSGQ_CLAIM
+	if (msgq->get_claim != NULL) {
+		msgq->get_claim_len++;
+	}
+#endif /* CONFIG_MSGQ_CLAIM */
+}
+
+#ifdef CONFIG_MSGQ_CLAIM
+/* Wait on claim_wait_q for the queue to change, returns 0 with the lock
+ * held again, or the error of z_pend_curr() with the lock released.
+ */
+static int claim_wait(struct k_msgq *msgq, k_spinlock_key_t *key,
+		      k_timepoint_t end)
+{
+	int ret = z_pend_curr(&msgq->lock, *key, &msgq->claim_wait_q,
+			      sys_timepoint_timeout(end));
+
+	if (ret == 0) {
+		*key = k_spin_lock(&msgq->lock);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_MSGQ_CLAIM */
+
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs)
 {
@@ -48,6 +168,13 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	msgq->used_msgs = 0;
 	msgq->flags = 0;
 	z_waitq_init(&msgq->wait_q);
+#ifdef CONFIG_MSGQ_CLAIM
+	msgq->put_claim = NULL;
+	msgq->put_claim_len = 0;
+	msgq->get_claim = NULL;
+	msgq->get_claim_len = 0;
+	z_waitq_init(&msgq->claim_wait_q);
+#endif /* CONFIG_MSGQ_CLAIM */
 	msgq->lock = (struct k_spinlock) {};
 #ifdef CONFIG_POLL
 	sys_dlist_init(&msgq->poll_events);
@@ -55,6 +182,10 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 
 #ifdef CONFIG_OBJ_CORE_MSGQ
 	k_obj_core_init_and_link(K_OBJ_CORE(msgq), &obj_type_msgq);
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+	k_obj_core_stats_register(K_OBJ_CORE(msgq), &msgq->wait_q.blocked,
+				  sizeof(struct k_usage_hist));
+#endif /* CONFIG_OBJ_CORE_STATS_WAIT */
 #endif /* CONFIG_OBJ_CORE_MSGQ */
 
 	SYS_PORT_TRACING_OBJ_INIT(k_msgq, msgq);
@@ -104,7 +235,7 @@ int k_msgq_cleanup(struct k_msgq *msgq)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, cleanup, msgq);
 
-	CHECKIF(z_waitq_head(&msgq->wait_q) != NULL) {
+	CHECKIF((z_waitq_head(&msgq->wait_q) != NULL) || claim_pending(msgq)) {
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, cleanup, msgq, -EBUSY);
 
 		return -EBUSY;
@@ -125,17 +256,36 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 {
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
-	struct k_thread *pending_thread;
+	struct k_thread *pending_thread = NULL;
 	k_spinlock_key_t key;
 	int result;
+	bool resched = false;
 
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
 
-	if (msgq->used_msgs < msgq->max_msgs) {
+#ifdef CONFIG_MSGQ_CLAIM
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+
+	while (claim_pending(msgq) && (z_impl_k_msgq_num_free_get(msgq) == 0U) &&
+	       !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put, msgq, timeout);
+
+		result = claim_wait(msgq, &key, end);
+		if (result != 0) {
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
+			return result;
+		}
+		timeout = sys_timepoint_timeout(end);
+	}
+#endif /* CONFIG_MSGQ_CLAIM */
+
+	if (z_impl_k_msgq_num_free_get(msgq) > 0U) {
 		/* message queue isn't full */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (!put_claim_pending(msgq)) {
+			pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		}
 		if (pending_thread != NULL) {
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, 0);
 
@@ -149,17 +299,12 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 			return 0;
 		} else {
 			/* put message in queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, (char *)data, msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
+			if (msgq_write(msgq, data)) {
 #ifdef CONFIG_POLL
-			handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+				handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
 #endif /* CONFIG_POLL */
+			}
+			resched = claim_waiters_wake(msgq);
 		}
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -178,7 +323,11 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
 
-	k_spin_unlock(&msgq->lock, key);
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
 
 	return result;
 }
@@ -218,37 +367,46 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
 	k_spinlock_key_t key;
-	struct k_thread *pending_thread;
+	struct k_thread *pending_thread = NULL;
 	int result;
+	bool resched = false;
 
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
 
+#ifdef CONFIG_MSGQ_CLAIM
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+
+	while (claim_pending(msgq) && (msgq->used_msgs == 0U) &&
+	       !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
+
+		result = claim_wait(msgq, &key, end);
+		if (result != 0) {
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
+			return result;
+		}
+		timeout = sys_timepoint_timeout(end);
+	}
+#endif /* CONFIG_MSGQ_CLAIM */
+
 	if (msgq->used_msgs > 0U) {
 		/* take first available message from queue */
-		(void)memcpy((char *)data, msgq->read_ptr, msgq->msg_size);
-		msgq->read_ptr += msgq->msg_size;
-		if (msgq->read_ptr == msgq->buffer_end) {
-			msgq->read_ptr = msgq->buffer_start;
-		}
-		msgq->used_msgs--;
+		msgq_read(msgq, data);
 
-		/* handle first thread waiting to write (if any) */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		/* handle first thread waiting to write (if any), unless
+		 * the slot is held by a claim
+		 */
+		if (z_impl_k_msgq_num_free_get(msgq) > 0U) {
+			pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		}
 		if (pending_thread != NULL) {
 			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
 
 			/* add thread's message to queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, (char *)pending_thread->base.swap_data,
-			       msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
+			(void)msgq_write(msgq, pending_thread->base.swap_data);
+			(void)claim_waiters_wake(msgq);
 
 			/* wake up waiting thread */
 			arch_thread_return_value_set(pending_thread, 0);
@@ -259,6 +417,7 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 
 			return 0;
 		}
+		resched = claim_waiters_wake(msgq);
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 		/* don't wait for a message to become available */
@@ -276,7 +435,11 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
 
-	k_spin_unlock(&msgq->lock, key);
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
 
 	return result;
 }
@@ -389,8 +552,27 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 		z_ready_thread(pending_thread);
 	}
 
+#ifdef CONFIG_MSGQ_CLAIM
+	/* Slots held by a consumer's claim are freed when it is released,
+	 * and the slot claimed by a producer stays claimed.
+	 */
+	if (msgq->get_claim != NULL) {
+		msgq->get_claim_len += msgq->used_msgs;
+	}
+	if (msgq->put_claim != NULL) {
+		msgq->write_ptr = next_slot(msgq, msgq->put_claim);
+		msgq->put_claim_len = 1;
+	}
+	(void)claim_waiters_wake(msgq);
+#endif /* CONFIG_MSGQ_CLAIM */
+
 	msgq->used_msgs = 0;
 	msgq->read_ptr = msgq->write_ptr;
+#ifdef CONFIG_MSGQ_CLAIM
+	if (msgq->put_claim != NULL) {
+		msgq->read_ptr = msgq->put_claim;
+	}
+#endif /* CONFIG_MSGQ_CLAIM */
 
 	z_reschedule(&msgq->lock, key);
 }
@@ -419,6 +601,149 @@ static inline uint32_t z_vrfy_k_msgq_num_used_get(struct k_msgq *msgq)
 
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_MSGQ_CLAIM
+int k_msgq_put_claim(struct k_msgq *msgq, void **slot, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+	int result;
+
+	while ((msgq->put_claim != NULL) || (z_impl_k_msgq_num_free_get(msgq) == 0U)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&msgq->lock, key);
+			return -ENOMSG;
+		}
+
+		result = claim_wait(msgq, &key, end);
+		if (result != 0) {
+			return result;
+		}
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	msgq->put_claim = msgq->write_ptr;
+	msgq->put_claim_len = 1;
+	msgq->write_ptr = next_slot(msgq, msgq->write_ptr);
+	*slot = msgq->put_claim;
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return 0;
+}
+
+int k_msgq_put_commit(struct k_msgq *msgq, void *slot)
+{
+	k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+	struct k_thread *pending_thread;
+
+	CHECKIF((slot == NULL) || (slot != msgq->put_claim)) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	msgq->used_msgs += msgq->put_claim_len;
+	msgq->put_claim = NULL;
+	msgq->put_claim_len = 0;
+
+	/* Hand the messages to the threads that were waiting in
+	 * k_msgq_get() before the claim.
+	 */
+	while (msgq->used_msgs > 0U) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+		msgq_read(msgq, pending_thread->base.swap_data);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+	}
+
+#ifdef CONFIG_POLL
+	if (msgq->used_msgs > 0U) {
+		handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+	}
+#endif /* CONFIG_POLL */
+	(void)claim_waiters_wake(msgq);
+
+	z_reschedule(&msgq->lock, key);
+
+	return 0;
+}
+
+int k_msgq_get_claim(struct k_msgq *msgq, void **slot, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+	int result;
+
+	while ((msgq->get_claim != NULL) || (msgq->used_msgs == 0U)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&msgq->lock, key);
+			return -ENOMSG;
+		}
+
+		result = claim_wait(msgq, &key, end);
+		if (result != 0) {
+			return result;
+		}
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	msgq->get_claim = msgq->read_ptr;
+	msgq->get_claim_len = 1;
+	msgq->read_ptr = next_slot(msgq, msgq->read_ptr);
+	msgq->used_msgs--;
+	*slot = msgq->get_claim;
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return 0;
+}
+
+int k_msgq_get_release(struct k_msgq *msgq, void *slot)
+{
+	k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+	struct k_thread *pending_thread;
+	bool was_full;
+
+	CHECKIF((slot == NULL) || (slot != msgq->get_claim)) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	was_full = z_impl_k_msgq_num_free_get(msgq) == 0U;
+	msgq->get_claim = NULL;
+	msgq->get_claim_len = 0;
+
+	/* Take the messages of the threads that were waiting in
+	 * k_msgq_put() before the claim.
+	 */
+	while (was_full && (z_impl_k_msgq_num_free_get(msgq) > 0U)) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+		if (msgq_write(msgq, pending_thread->base.swap_data)) {
+#ifdef CONFIG_POLL
+			handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+		}
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+	}
+
+	(void)claim_waiters_wake(msgq);
+
+	z_reschedule(&msgq->lock, key);
+
+	return 0;
+}
+#endif /* CONFIG_MSGQ_CLAIM */
+
 #ifdef CONFIG_OBJ_CORE_MSGQ
 static int init_msgq_obj_core_list(void)
 {
@@ -426,11 +751,18 @@ static int init_msgq_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_msgq, K_OBJ_TYPE_MSGQ_ID,
 			offsetof(struct k_msgq, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+	k_obj_type_stats_init(&obj_type_msgq, &z_waitq_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_WAIT */
 
 	/* Initialize and link statically defined message queues */
 
 	STRUCT_SECTION_FOREACH(k_msgq, msgq) {
 		k_obj_core_init_and_link(K_OBJ_CORE(msgq), &obj_type_msgq);
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+		k_obj_core_stats_register(K_OBJ_CORE(msgq), &msgq->wait_q.blocked,
+					  sizeof(struct k_usage_hist));
+#endif /* CONFIG_OBJ_CORE_STATS_WAIT */
 	}
 
 	return 0;
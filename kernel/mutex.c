@@ -52,10 +52,42 @@ static struct k_spinlock lock;
 static struct k_obj_type obj_type_mutex;
 #endif /* CONFIG_OBJ_CORE_MUTEX */
 
+#ifdef CONFIG_SYNC_FAST_PATH
+/* With CONFIG_SYNC_FAST_PATH, mutex->lock_word is the authoritative
+ * owner: it holds the owner thread pointer, or zero when unlocked, and
+ * an uncontended lock or unlock is a single compare-and-swap on it.
+ * The owner, lock_count and owner_orig_prio fields are written only by
+ * the thread owning the word (or, on hand-off, by the unlocking thread
+ * before the new owner runs), with owner written last on lock and
+ * cleared first on unlock.
+ *
+ * A thread about to pend sets LOCK_WAITERS in the word under the lock,
+ * which forces the owner into the locked unlock path where it restores
+ * its priority and hands the mutex to the first waiter.
+ */
+#define LOCK_WAITERS 1UL
+
+static inline struct k_thread *lock_word_owner(atomic_val_t word)
+{
+	return (struct k_thread *)((uintptr_t)word & ~LOCK_WAITERS);
+}
+
+static inline void set_owner(struct k_mutex *mutex, struct k_thread *owner,
+			     int orig_prio)
+{
+	mutex->owner_orig_prio = orig_prio;
+	mutex->lock_count = 1U;
+	mutex->owner = owner;
+}
+#endif /* CONFIG_SYNC_FAST_PATH */
+
 int z_impl_k_mutex_init(struct k_mutex *mutex)
 {
 	mutex->owner = NULL;
 	mutex->lock_count = 0U;
+#ifdef CONFIG_SYNC_FAST_PATH
+	atomic_set(&mutex->lock_word, 0);
+#endif /* CONFIG_SYNC_FAST_PATH */
 
 	z_waitq_init(&mutex->wait_q);
 
@@ -63,6 +95,10 @@ int z_impl_k_mutex_init(struct k_mutex *mutex)
 
 #ifdef CONFIG_OBJ_CORE_MUTEX
 	k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+	k_obj_core_stats_register(K_OBJ_CORE(mutex), &mutex->wait_q.blocked,
+				  sizeof(struct k_usage_hist));
+#endif /* CONFIG_OBJ_CORE_STATS_WAIT */
 #endif /* CONFIG_OBJ_CORE_MUTEX */
 
 	SYS_PORT_TRACING_OBJ_INIT(k_mutex, mutex, 0);
@@ -88,20 +124,131 @@ static int32_t new_prio_for_inheritance(int32_t target, int32_t limit)
 	return new_prio;
 }
 
-static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
+static bool adjust_owner_prio(struct k_thread *owner, int32_t new_prio)
 {
-	if (mutex->owner->base.prio != new_prio) {
+	if (owner->base.prio != new_prio) {
 
 		LOG_DBG("%p (ready (y/n): %c) prio changed to %d (was %d)",
-			mutex->owner, z_is_thread_ready(mutex->owner) ?
-			'y' : 'n',
-			new_prio, mutex->owner->base.prio);
+			owner, z_is_thread_ready(owner) ? 'y' : 'n',
+			new_prio, owner->base.prio);
 
-		return z_thread_prio_set(mutex->owner, new_prio);
+		return z_thread_prio_set(owner, new_prio);
 	}
 	return false;
 }
 
+#ifdef CONFIG_SYNC_FAST_PATH
+int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
+{
+	/* Sampled before the word is claimed: once it is, waiters may
+	 * boost our priority.
+	 */
+	int prio = _current->base.prio;
+	struct k_thread *owner;
+	atomic_val_t word;
+	k_spinlock_key_t key;
+	bool resched = false;
+
+	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, lock, mutex, timeout);
+
+	if (likely(atomic_cas(&mutex->lock_word, 0, (atomic_val_t)_current))) {
+		set_owner(mutex, _current, prio);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+		return 0;
+	}
+
+	if (lock_word_owner(atomic_get(&mutex->lock_word)) == _current) {
+		mutex->lock_count++;
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+		return 0;
+	}
+
+	if (unlikely(K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, -EBUSY);
+		return -EBUSY;
+	}
+
+	key = k_spin_lock(&lock);
+
+	/* Retry the lock if it was released meanwhile, otherwise flag
+	 * that the owner has to take the locked path to release it.
+	 */
+	while (true) {
+		word = atomic_get(&mutex->lock_word);
+		if (word == 0) {
+			if (atomic_cas(&mutex->lock_word, 0, (atomic_val_t)_current)) {
+				set_owner(mutex, _current, _current->base.prio);
+				k_spin_unlock(&lock, key);
+				SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex,
+							       timeout, 0);
+				return 0;
+			}
+		} else if (((word & LOCK_WAITERS) != 0UL) ||
+			   atomic_cas(&mutex->lock_word, word, word | LOCK_WAITERS)) {
+			break;
+		}
+	}
+
+	owner = lock_word_owner(word);
+
+	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
+
+	int new_prio = new_prio_for_inheritance(_current->base.prio,
+						owner->base.prio);
+
+	LOG_DBG("adjusting prio up on mutex %p", mutex);
+
+	if (z_is_prio_higher(new_prio, owner->base.prio)) {
+		resched = adjust_owner_prio(owner, new_prio);
+	}
+
+	int got_mutex = z_pend_curr(&lock, key, &mutex->wait_q, timeout);
+
+	LOG_DBG("%p got mutex %p (y/n): %c", _current, mutex,
+		got_mutex ? 'y' : 'n');
+
+	if (got_mutex == 0) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+		return 0;
+	}
+
+	/* timed out */
+
+	LOG_DBG("%p timeout on mutex %p", _current, mutex);
+
+	key = k_spin_lock(&lock);
+
+	/*
+	 * Only adjust the owner's priority down if its owner_orig_prio
+	 * is published, which is not yet the case right after a fast
+	 * path lock: that owner cannot have been boosted by us anyway.
+	 */
+	owner = lock_word_owner(atomic_get(&mutex->lock_word));
+	if (likely((owner != NULL) && (mutex->owner == owner))) {
+		struct k_thread *waiter = z_waitq_head(&mutex->wait_q);
+
+		new_prio = (waiter != NULL) ?
+			new_prio_for_inheritance(waiter->base.prio, mutex->owner_orig_prio) :
+			mutex->owner_orig_prio;
+
+		LOG_DBG("adjusting prio down on mutex %p", mutex);
+
+		resched = adjust_owner_prio(owner, new_prio) || resched;
+	}
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, -EAGAIN);
+
+	return -EAGAIN;
+}
+#else
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
@@ -150,7 +297,7 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 	LOG_DBG("adjusting prio up on mutex %p", mutex);
 
 	if (z_is_prio_higher(new_prio, mutex->owner->base.prio)) {
-		resched = adjust_owner_prio(mutex, new_prio);
+		resched = adjust_owner_prio(mutex->owner, new_prio);
 	}
 
 	int got_mutex = z_pend_curr(&lock, key, &mutex->wait_q, timeout);
@@ -184,7 +331,7 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 		LOG_DBG("adjusting prio down on mutex %p", mutex);
 
-		resched = adjust_owner_prio(mutex, new_prio) || resched;
+		resched = adjust_owner_prio(mutex->owner, new_prio) || resched;
 	}
 
 	if (resched) {
@@ -197,6 +344,7 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	return -EAGAIN;
 }
+#endif /* CONFIG_SYNC_FAST_PATH */
 
 #ifdef CONFIG_USERSPACE
 static inline int z_vrfy_k_mutex_lock(struct k_mutex *mutex,
@@ -249,9 +397,25 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 		goto k_mutex_unlock_return;
 	}
 
+#ifdef CONFIG_SYNC_FAST_PATH
+	/* Without waiters flagged nobody can have boosted us through this
+	 * mutex, so just release the word.  The fields must be cleared
+	 * first as the next owner may claim the word at once.
+	 */
+	if (atomic_get(&mutex->lock_word) == (atomic_val_t)_current) {
+		mutex->owner = NULL;
+		mutex->lock_count = 0U;
+		if (likely(atomic_cas(&mutex->lock_word, (atomic_val_t)_current, 0))) {
+			goto k_mutex_unlock_return;
+		}
+		mutex->lock_count = 1U;
+		mutex->owner = _current;
+	}
+#endif /* CONFIG_SYNC_FAST_PATH */
+
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
-	adjust_owner_prio(mutex, mutex->owner_orig_prio);
+	adjust_owner_prio(mutex->owner, mutex->owner_orig_prio);
 
 	/* Get the new owner, if any */
 	new_owner = z_unpend_first_thread(&mutex->wait_q);
@@ -268,11 +432,19 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 		 * adjust its priority
 		 */
 		mutex->owner_orig_prio = new_owner->base.prio;
+#ifdef CONFIG_SYNC_FAST_PATH
+		mutex->lock_count = 1U;
+		atomic_set(&mutex->lock_word, (atomic_val_t)new_owner |
+			   ((z_waitq_head(&mutex->wait_q) != NULL) ? LOCK_WAITERS : 0UL));
+#endif /* CONFIG_SYNC_FAST_PATH */
 		arch_thread_return_value_set(new_owner, 0);
 		z_ready_thread(new_owner);
 		z_reschedule(&lock, key);
 	} else {
 		mutex->lock_count = 0U;
+#ifdef CONFIG_SYNC_FAST_PATH
+		atomic_set(&mutex->lock_word, 0);
+#endif /* CONFIG_SYNC_FAST_PATH */
 		k_spin_unlock(&lock, key);
 	}
 
@@ -299,11 +471,18 @@ static int init_mutex_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_mutex, K_OBJ_TYPE_MUTEX_ID,
 			offsetof(struct k_mutex, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+	k_obj_type_stats_init(&obj_type_mutex, &z_waitq_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_WAIT */
 
 	/* Initialize and link statically defined mutexes */
 
 	STRUCT_SECTION_FOREACH(k_mutex, mutex) {
 		k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+		k_obj_core_stats_register(K_OBJ_CORE(mutex), &mutex->wait_q.blocked,
+					  sizeof(struct k_usage_hist));
+#endif /* CONFIG_OBJ_CORE_STATS_WAIT */
 	}
 
 	return 0;
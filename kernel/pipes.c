@@ -20,6 +20,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <kernel_internal.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 
 struct waitq_walk_data {
 	sys_dlist_t *list;
@@ -28,7 +29,8 @@ struct waitq_walk_data {
 };
 
 static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
-			     void *data, size_t bytes_to_read,
+			     void *data, const struct k_pipe_vec *vec,
+			     size_t vec_cnt, size_t bytes_to_read,
 			     size_t *bytes_read, size_t min_xfer,
 			     k_timeout_t timeout);
 #ifdef CONFIG_OBJ_CORE_PIPE
@@ -113,8 +115,8 @@ void z_impl_k_pipe_flush(struct k_pipe *pipe)
 
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
-	(void) pipe_get_internal(key, pipe, NULL, (size_t) -1, &bytes_read, 0U,
-				 K_NO_WAIT);
+	(void) pipe_get_internal(key, pipe, NULL, NULL, 0U, (size_t) -1,
+				 &bytes_read, 0U, K_NO_WAIT);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, flush, pipe);
 }
@@ -138,7 +140,7 @@ void z_impl_k_pipe_buffer_flush(struct k_pipe *pipe)
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
 	if (pipe->buffer != NULL) {
-		(void) pipe_get_internal(key, pipe, NULL, pipe->size,
+		(void) pipe_get_internal(key, pipe, NULL, NULL, 0U, pipe->size,
 					 &bytes_read, 0U, K_NO_WAIT);
 	} else {
 		k_spin_unlock(&pipe->lock, key);
@@ -214,6 +216,75 @@ static size_t pipe_xfer(unsigned char *dest, size_t dest_size,
 	return num_bytes;
 }
 
+/**
+ * @brief Account for bytes copied to/from the buffer(s) of @a desc
+ *
+ * For a scatter/gather transfer, this moves on to the next non-empty
+ * buffer once the current one is done.
+ */
+static void pipe_desc_advance(struct _pipe_desc *desc, size_t bytes)
+{
+	if (desc->buffer != NULL) {
+		desc->buffer += bytes;
+	}
+	desc->bytes_to_xfer -= bytes;
+
+#ifdef CONFIG_PIPES_VEC
+	if (desc->vec == NULL) {
+		return;
+	}
+
+	desc->buffer_bytes -= bytes;
+	while ((desc->buffer_bytes == 0U) && (desc->vec_cnt != 0U)) {
+		desc->buffer       = desc->vec->data;
+		desc->buffer_bytes = desc->vec->len;
+		desc->vec++;
+		desc->vec_cnt--;
+	}
+#endif /* CONFIG_PIPES_VEC */
+}
+
+/**
+ * @brief Initialize a pipe descriptor
+ *
+ * The descriptor refers either to the @a bytes bytes at @a buffer, or if
+ * @a vec is not NULL, to the @a vec_cnt buffers it describes, whose total
+ * size is @a bytes.
+ */
+static void pipe_desc_init(struct _pipe_desc *desc, unsigned char *buffer,
+			   const struct k_pipe_vec *vec, size_t vec_cnt,
+			   size_t bytes)
+{
+	desc->buffer        = buffer;
+	desc->bytes_to_xfer = bytes;
+
+#ifdef CONFIG_PIPES_VEC
+	desc->vec          = vec;
+	desc->vec_cnt      = vec_cnt;
+	desc->buffer_bytes = 0U;
+	if (vec != NULL) {
+		pipe_desc_advance(desc, 0U);
+	}
+#else
+	ARG_UNUSED(vec);
+	ARG_UNUSED(vec_cnt);
+#endif /* CONFIG_PIPES_VEC */
+}
+
+/**
+ * @brief Number of bytes that can be copied to/from @a desc at once
+ */
+static inline size_t pipe_desc_bytes(const struct _pipe_desc *desc)
+{
+#ifdef CONFIG_PIPES_VEC
+	if (desc->vec != NULL) {
+		return desc->buffer_bytes;
+	}
+#endif /* CONFIG_PIPES_VEC */
+
+	return desc->bytes_to_xfer;
+}
+
 /**
  * @brief Callback routine used to populate wait list
  *
@@ -275,18 +346,16 @@ static size_t pipe_buffer_list_populate(sys_dlist_t         *list,
 	sys_dlist_append(list, &desc[0].node);
 
 	desc[0].thread = NULL;
-	desc[0].buffer = &buffer[start];
 
 	if (start < end) {
-		desc[0].bytes_to_xfer = end - start;
+		pipe_desc_init(&desc[0], &buffer[start], NULL, 0U, end - start);
 		return end - start;
 	}
 
-	desc[0].bytes_to_xfer = size - start;
+	pipe_desc_init(&desc[0], &buffer[start], NULL, 0U, size - start);
 
 	desc[1].thread = NULL;
-	desc[1].buffer = &buffer[0];
-	desc[1].bytes_to_xfer = end;
+	pipe_desc_init(&desc[1], &buffer[0], NULL, 0U, end);
 
 	sys_dlist_append(list, &desc[1].node);
 
@@ -335,16 +404,13 @@ static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
 	dest = (struct _pipe_desc *)sys_dlist_get(dest_list);
 
 	while ((src != NULL) && (dest != NULL)) {
-		bytes_copied = pipe_xfer(dest->buffer, dest->bytes_to_xfer,
-					 src->buffer, src->bytes_to_xfer);
+		bytes_copied = pipe_xfer(dest->buffer, pipe_desc_bytes(dest),
+					 src->buffer, pipe_desc_bytes(src));
 
 		num_bytes_written   += bytes_copied;
 
-		dest->buffer        += bytes_copied;
-		dest->bytes_to_xfer -= bytes_copied;
-
-		src->buffer         += bytes_copied;
-		src->bytes_to_xfer  -= bytes_copied;
+		pipe_desc_advance(dest, bytes_copied);
+		pipe_desc_advance(src, bytes_copied);
 
 		if (dest->thread == NULL) {
 
@@ -377,9 +443,10 @@ static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
 	return num_bytes_written;
 }
 
-int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
-		      size_t bytes_to_write, size_t *bytes_written,
-		      size_t min_xfer, k_timeout_t timeout)
+static int pipe_put_internal(struct k_pipe *pipe, const void *data,
+			     const struct k_pipe_vec *vec, size_t vec_cnt,
+			     size_t bytes_to_write, size_t *bytes_written,
+			     size_t min_xfer, k_timeout_t timeout)
 {
 	struct _pipe_desc  pipe_desc[2];
 	struct _pipe_desc  isr_desc;
@@ -389,18 +456,6 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 	size_t             bytes_can_write;
 	bool               reschedule_needed = false;
 
-	__ASSERT(((arch_is_in_isr() == false) ||
-		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
-
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, put, pipe, timeout);
-
-	CHECKIF((min_xfer > bytes_to_write) || (bytes_written == NULL)) {
-		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe, timeout,
-					       -EINVAL);
-
-		return -EINVAL;
-	}
-
 	sys_dlist_init(&src_list);
 	sys_dlist_init(&dest_list);
 
@@ -432,9 +487,6 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 		k_spin_unlock(&pipe->lock, key);
 		*bytes_written = 0U;
 
-		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe,
-					       timeout, -EIO);
-
 		return -EIO;
 	}
 
@@ -445,9 +497,9 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 
 	src_desc = k_is_in_isr() ? &isr_desc : &_current->pipe_desc;
 
-	src_desc->buffer        = (unsigned char *)data;
-	src_desc->bytes_to_xfer = bytes_to_write;
-	src_desc->thread        = _current;
+	pipe_desc_init(src_desc, (unsigned char *)data, vec, vec_cnt,
+		       bytes_to_write);
+	src_desc->thread = _current;
 	sys_dlist_append(&src_list, &src_desc->node);
 
 	*bytes_written = pipe_write(pipe, &src_list,
@@ -479,8 +531,6 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 			k_spin_unlock(&pipe->lock, key);
 		}
 
-		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe, timeout, 0);
-
 		return 0;
 	}
 
@@ -504,8 +554,28 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
 
 	*bytes_written = bytes_to_write - src_desc->bytes_to_xfer;
 
-	int ret = pipe_return_code(min_xfer, src_desc->bytes_to_xfer,
-				   bytes_to_write);
+	return pipe_return_code(min_xfer, src_desc->bytes_to_xfer,
+				bytes_to_write);
+}
+
+int z_impl_k_pipe_put(struct k_pipe *pipe, const void *data,
+		      size_t bytes_to_write, size_t *bytes_written,
+		      size_t min_xfer, k_timeout_t timeout)
+{
+	__ASSERT(((arch_is_in_isr() == false) ||
+		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, put, pipe, timeout);
+
+	CHECKIF((min_xfer > bytes_to_write) || (bytes_written == NULL)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe, timeout,
+					       -EINVAL);
+
+		return -EINVAL;
+	}
+
+	int ret = pipe_put_internal(pipe, data, NULL, 0U, bytes_to_write,
+				    bytes_written, min_xfer, timeout);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe, timeout, ret);
 
@@ -529,7 +599,8 @@ int z_vrfy_k_pipe_put(struct k_pipe *pipe, const void *data,
 #endif /* CONFIG_USERSPACE */
 
 static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
-			     void *data, size_t bytes_to_read,
+			     void *data, const struct k_pipe_vec *vec,
+			     size_t vec_cnt, size_t bytes_to_read,
 			     size_t *bytes_read, size_t min_xfer,
 			     k_timeout_t timeout)
 {
@@ -583,26 +654,20 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 
 	dest_desc = k_is_in_isr() ? &isr_desc : &_current->pipe_desc;
 
-	dest_desc->buffer = data;
-	dest_desc->bytes_to_xfer = bytes_to_read;
+	pipe_desc_init(dest_desc, data, vec, vec_cnt, bytes_to_read);
 	dest_desc->thread = _current;
 
 	src_desc = (struct _pipe_desc *)sys_dlist_get(&src_list);
 	while (src_desc != NULL) {
 		bytes_copied = pipe_xfer(dest_desc->buffer,
-					  dest_desc->bytes_to_xfer,
+					  pipe_desc_bytes(dest_desc),
 					  src_desc->buffer,
-					  src_desc->bytes_to_xfer);
+					  pipe_desc_bytes(src_desc));
 
 		num_bytes_read += bytes_copied;
 
-		src_desc->buffer += bytes_copied;
-		src_desc->bytes_to_xfer -= bytes_copied;
-
-		if (dest_desc->buffer != NULL) {
-			dest_desc->buffer += bytes_copied;
-		}
-		dest_desc->bytes_to_xfer -= bytes_copied;
+		pipe_desc_advance(src_desc, bytes_copied);
+		pipe_desc_advance(dest_desc, bytes_copied);
 
 		if (src_desc->thread == NULL) {
 
@@ -622,7 +687,17 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 
 			reschedule_needed = true;
 		}
-		src_desc = (struct _pipe_desc *)sys_dlist_get(&src_list);
+
+		/*
+		 * Either buffer may be one of several in a scatter/gather
+		 * transfer: only move on to the next source when done with
+		 * this one, or when the request has been satisfied.
+		 */
+
+		if ((src_desc->bytes_to_xfer == 0U) ||
+		    (dest_desc->bytes_to_xfer == 0U)) {
+			src_desc = (struct _pipe_desc *)sys_dlist_get(&src_list);
+		}
 	}
 
 	if (pipe->bytes_used != pipe->size) {
@@ -713,8 +788,8 @@ int z_impl_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
-	int ret = pipe_get_internal(key, pipe, data, bytes_to_read, bytes_read,
-				    min_xfer, timeout);
+	int ret = pipe_get_internal(key, pipe, data, NULL, 0U, bytes_to_read,
+				    bytes_read, min_xfer, timeout);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, get, pipe, timeout, ret);
 
@@ -736,6 +811,143 @@ int z_vrfy_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 #include <zephyr/syscalls/k_pipe_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_PIPES_VEC
+/**
+ * @brief Compute the total size of the buffers of a scatter/gather transfer
+ *
+ * @return 0 on success, -EINVAL if the total size overflows
+ */
+static int pipe_vec_size(const struct k_pipe_vec *vec, size_t vec_cnt,
+			 size_t *size)
+{
+	*size = 0U;
+
+	for (size_t i = 0; i < vec_cnt; i++) {
+		if (size_add_overflow(*size, vec[i].len, size)) {
+			return -EINVAL;
+		}
+	}
+
+	return 0;
+}
+
+int z_impl_k_pipe_put_vec(struct k_pipe *pipe,
+			  const struct k_pipe_vec *vec, size_t vec_cnt,
+			  size_t *bytes_written, size_t min_xfer,
+			  k_timeout_t timeout)
+{
+	size_t bytes_to_write;
+	int    ret;
+
+	__ASSERT(((arch_is_in_isr() == false) ||
+		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, put, pipe, timeout);
+
+	ret = pipe_vec_size(vec, vec_cnt, &bytes_to_write);
+
+	CHECKIF((ret != 0) || (min_xfer > bytes_to_write) ||
+		(bytes_written == NULL)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe, timeout,
+					       -EINVAL);
+
+		return -EINVAL;
+	}
+
+	ret = pipe_put_internal(pipe, NULL, vec, vec_cnt, bytes_to_write,
+				bytes_written, min_xfer, timeout);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe, timeout, ret);
+
+	return ret;
+}
+
+int z_impl_k_pipe_get_vec(struct k_pipe *pipe,
+			  const struct k_pipe_vec *vec, size_t vec_cnt,
+			  size_t *bytes_read, size_t min_xfer,
+			  k_timeout_t timeout)
+{
+	size_t bytes_to_read;
+	int    ret;
+
+	__ASSERT(((arch_is_in_isr() == false) ||
+		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, get, pipe, timeout);
+
+	ret = pipe_vec_size(vec, vec_cnt, &bytes_to_read);
+
+	CHECKIF((ret != 0) || (min_xfer > bytes_to_read) ||
+		(bytes_read == NULL)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, get, pipe,
+					       timeout, -EINVAL);
+
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	ret = pipe_get_internal(key, pipe, NULL, vec, vec_cnt, bytes_to_read,
+				bytes_read, min_xfer, timeout);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, get, pipe, timeout, ret);
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+/*
+ * The buffer descriptions are copied to the kernel stack, where they stay
+ * while the caller waits for the transfer to complete, so that the user
+ * thread cannot change them once validated.
+ */
+static inline void pipe_vec_copy(struct k_pipe_vec *dest,
+				 const struct k_pipe_vec *src, size_t vec_cnt,
+				 bool write)
+{
+	K_OOPS(K_SYSCALL_VERIFY_MSG(vec_cnt <= CONFIG_PIPES_VEC_MAX,
+				    "too many pipe buffers (%zu)", vec_cnt));
+	K_OOPS(k_usermode_from_copy(dest, src, vec_cnt * sizeof(*dest)));
+
+	for (size_t i = 0; i < vec_cnt; i++) {
+		K_OOPS(K_SYSCALL_MEMORY(dest[i].data, dest[i].len, write));
+	}
+}
+
+int z_vrfy_k_pipe_put_vec(struct k_pipe *pipe,
+			  const struct k_pipe_vec *vec, size_t vec_cnt,
+			  size_t *bytes_written, size_t min_xfer,
+			  k_timeout_t timeout)
+{
+	struct k_pipe_vec vec_copy[CONFIG_PIPES_VEC_MAX];
+
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(bytes_written, sizeof(*bytes_written)));
+	pipe_vec_copy(vec_copy, vec, vec_cnt, false);
+
+	return z_impl_k_pipe_put_vec(pipe, vec_copy, vec_cnt, bytes_written,
+				     min_xfer, timeout);
+}
+#include <zephyr/syscalls/k_pipe_put_vec_mrsh.c>
+
+int z_vrfy_k_pipe_get_vec(struct k_pipe *pipe,
+			  const struct k_pipe_vec *vec, size_t vec_cnt,
+			  size_t *bytes_read, size_t min_xfer,
+			  k_timeout_t timeout)
+{
+	struct k_pipe_vec vec_copy[CONFIG_PIPES_VEC_MAX];
+
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(bytes_read, sizeof(*bytes_read)));
+	pipe_vec_copy(vec_copy, vec, vec_cnt, true);
+
+	return z_impl_k_pipe_get_vec(pipe, vec_copy, vec_cnt, bytes_read,
+				     min_xfer, timeout);
+}
+#include <zephyr/syscalls/k_pipe_get_vec_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_PIPES_VEC */
+
 size_t z_impl_k_pipe_read_avail(struct k_pipe *pipe)
 {
 	size_t res;
@@ -35,10 +35,13 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+#ifdef CONFIG_POLL_SET
+static int signal_poll_set(struct k_poll_event *event, uint32_t state);
+#endif
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -109,22 +112,32 @@ static struct k_thread *poller_thread(struct z_poller *p)
 	return p ? CONTAINER_OF(p, struct k_thread, poller) : NULL;
 }
 
+/* Poll sets have no thread: their events are signaled after those of
+ * polling threads, in the order they were registered.
+ */
+static inline bool is_set_poller(struct z_poller *p)
+{
+	return IS_ENABLED(CONFIG_POLL_SET) && (p->mode == MODE_SET);
+}
+
 static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 			     struct z_poller *poller)
 {
 	struct k_poll_event *pending;
 
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
-	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+	if ((pending == NULL) || is_set_poller(poller) ||
+		(!is_set_poller(pending->poller) &&
+		 (z_sched_prio_cmp(poller_thread(pending->poller),
+				   poller_thread(poller)) > 0))) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if (is_set_poller(pending->poller) ||
+		    (z_sched_prio_cmp(poller_thread(poller),
+				      poller_thread(pending->poller)) > 0)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -448,6 +461,11 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 			retcode = signal_poller(event, state);
 		} else if (poller->mode == MODE_TRIGGERED) {
 			retcode = signal_triggered_work(event, state);
+#ifdef CONFIG_POLL_SET
+		} else if (poller->mode == MODE_SET) {
+			/* The event stays in the set */
+			return signal_poll_set(event, state);
+#endif
 		} else {
 			/* Poller is not poll or triggered mode. No action needed.*/
 			;
@@ -813,3 +831,147 @@ int k_work_poll_cancel(struct k_work_poll *work)
 
 	return retval;
 }
+
+#ifdef CONFIG_POLL_SET
+static inline struct k_poll_set *poller_set(struct z_poller *p)
+{
+	return CONTAINER_OF(p, struct k_poll_set, poller);
+}
+
+/* must be called with interrupts locked */
+static void poll_set_ready(struct k_poll_set *set, struct k_poll_event *event)
+{
+	struct k_thread *thread;
+
+	sys_dlist_append(&set->ready, &event->_node);
+
+	thread = z_unpend_first_thread(&set->wait_q);
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+}
+
+/* must be called with interrupts locked */
+static void poll_set_arm(struct k_poll_set *set, struct k_poll_event *event)
+{
+	uint32_t state;
+
+	event->state = K_POLL_STATE_NOT_READY;
+	if (is_condition_met(event, &state)) {
+		event->state = state;
+		event->poller = &set->poller;
+		poll_set_ready(set, event);
+	} else {
+		register_event(event, &set->poller);
+	}
+}
+
+/* must be called with interrupts locked */
+static int signal_poll_set(struct k_poll_event *event, uint32_t state)
+{
+	/* The object has already unlinked the event */
+	event->state |= state;
+	poll_set_ready(poller_set(event->poller), event);
+
+	return 0;
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_SET;
+	sys_dlist_init(&set->ready);
+	sys_dlist_init(&set->returned);
+	z_waitq_init(&set->wait_q);
+}
+
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (event->poller != NULL) {
+		k_spin_unlock(&lock, key);
+		return -EBUSY;
+	}
+
+	poll_set_arm(set, event);
+	z_reschedule(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (event->poller != &set->poller) {
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	/* Linked to its object, the ready list or the returned list */
+	if (sys_dnode_is_linked(&event->_node)) {
+		sys_dlist_remove(&event->_node);
+	}
+	event->poller = NULL;
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **events,
+		    int max_events, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct k_poll_event *event;
+	k_spinlock_key_t key;
+	int num_events = 0;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(max_events > 0, "no room for events\n");
+
+	key = k_spin_lock(&lock);
+
+	/* Arm again the events returned by the previous call, releasing
+	 * the lock in between for latency like clear_event_registrations()
+	 */
+	while ((event = (struct k_poll_event *)sys_dlist_get(&set->returned))
+	       != NULL) {
+		poll_set_arm(set, event);
+		k_spin_unlock(&lock, key);
+		key = k_spin_lock(&lock);
+	}
+
+	while (sys_dlist_is_empty(&set->ready)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EAGAIN;
+		}
+
+		ret = z_pend_curr(&lock, key, &set->wait_q, timeout);
+		if (ret != 0) {
+			return ret;
+		}
+
+		/* Another waiter may have taken the events meanwhile */
+		key = k_spin_lock(&lock);
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	while (num_events < max_events) {
+		event = (struct k_poll_event *)sys_dlist_get(&set->ready);
+		if (event == NULL) {
+			break;
+		}
+		sys_dlist_append(&set->returned, &event->_node);
+		events[num_events++] = event;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return num_events;
+}
+#endif /* CONFIG_POLL_SET */
@@ -28,7 +28,7 @@ LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 extern struct k_thread *pending_current;
 #endif
 
-struct k_spinlock _sched_spinlock;
+struct k_spinlock _sched_spinlock = K_SPINLOCK_MCS_INIT;
 
 /* Storage to "complete" the context switch from an invalid/incomplete thread
  * context (ex: exiting an ISR that aborted _current)
@@ -382,6 +382,7 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+		z_sched_usage_ready(thread);
 		queue_thread(thread);
 		update_cache(0);
 
@@ -587,6 +588,7 @@ static void add_to_waitq_locked(struct k_thread *thread, _wait_q_t *wait_q)
 	if (wait_q != NULL) {
 		thread->base.pended_on = wait_q;
 		_priq_wait_add(&wait_q->waitq, thread);
+		z_sched_usage_pend(thread);
 	}
 }
 
@@ -618,6 +620,7 @@ void z_pend_thread(struct k_thread *thread, _wait_q_t *wait_q,
 
 static inline void unpend_thread_no_timeout(struct k_thread *thread)
 {
+	z_sched_usage_unpend(thread, pended_on_thread(thread));
 	_priq_wait_remove(&pended_on_thread(thread)->waitq, thread);
 	z_mark_thread_as_not_pending(thread);
 	thread->base.pended_on = NULL;
@@ -980,15 +983,93 @@ void *z_get_next_switch_handle(void *interrupted)
 }
 #endif /* CONFIG_USE_SWITCH */
 
+/* Waking several threads at once, e.g. on a broadcast: each thread is
+ * unpended and queued as ready_thread() would, but the cache update is
+ * deferred to wake_batch_end(), so that it happens once per batch.  IPIs
+ * are coalesced in _kernel.pending_ipi, every CPU being signalled at
+ * most once.  Must be called with _sched_spinlock held across the whole
+ * batch.
+ */
+struct wake_batch {
+	bool woken;
+#ifdef CONFIG_SMP
+	atomic_val_t ipi_mask;
+#endif /* CONFIG_SMP */
+};
+
+static void wake_batch_add(struct wake_batch *batch, struct k_thread *thread)
+{
+	if (thread->base.pended_on != NULL) {
+		unpend_thread_no_timeout(thread);
+	}
+	(void)z_abort_thread_timeout(thread);
+
+	if ((thread_active_elsewhere(thread) != NULL) ||
+	    z_is_thread_queued(thread) || !z_is_thread_ready(thread)) {
+		return;
+	}
+
+#ifdef CONFIG_KERNEL_COHERENCE
+	__ASSERT_NO_MSG(arch_mem_coherent(thread));
+#endif /* CONFIG_KERNEL_COHERENCE */
+
+	SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
+
+	z_sched_usage_ready(thread);
+	queue_thread(thread);
+	batch->woken = true;
+
+#ifdef CONFIG_SMP
+	/* Threads woken together mostly have the same targets: stop
+	 * evaluating them once all other CPUs are flagged anyway.  The
+	 * IPIs are flagged right away so that target selection for the
+	 * next thread knows which CPUs are already due to reschedule;
+	 * they are only sent once the lock is released.
+	 */
+	if ((batch->ipi_mask | BIT(_current_cpu->id)) != IPI_ALL_CPUS_MASK) {
+		atomic_val_t ipi_mask = ipi_mask_create(thread);
+
+		batch->ipi_mask |= ipi_mask;
+		flag_ipi(ipi_mask);
+	}
+#endif /* CONFIG_SMP */
+}
+
+static bool wake_batch_end(struct wake_batch *batch)
+{
+	if (batch->woken) {
+		update_cache(0);
+	}
+
+	return batch->woken;
+}
+
+static int wake_all_locked(_wait_q_t *wait_q, bool set_retval,
+			   int swap_retval, void *swap_data)
+{
+	struct wake_batch batch = { 0 };
+	int found = 0;
+	struct k_thread *thread;
+
+	while ((thread = _priq_wait_best(&wait_q->waitq)) != NULL) {
+		if (set_retval) {
+			z_thread_return_value_set_with_data(thread, swap_retval,
+							    swap_data);
+		}
+		wake_batch_add(&batch, thread);
+		found++;
+	}
+	(void)wake_batch_end(&batch);
+
+	return found;
+}
+
 int z_unpend_all(_wait_q_t *wait_q)
 {
 	int need_sched = 0;
-	struct k_thread *thread;
 
-	for (thread = z_waitq_head(wait_q); thread != NULL; thread = z_waitq_head(wait_q)) {
-		z_unpend_thread(thread);
-		z_ready_thread(thread);
-		need_sched = 1;
+	K_SPINLOCK(&_sched_spinlock) {
+		need_sched = wake_all_locked(wait_q, false, 0, NULL);
 	}
 
 	return need_sched;
@@ -1553,6 +1634,42 @@ bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data)
 	return ret;
 }
 
+int z_sched_wake_all(_wait_q_t *wait_q, int swap_retval, void *swap_data)
+{
+	int ret = 0;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		ret = wake_all_locked(wait_q, true, swap_retval, swap_data);
+	}
+
+	return ret;
+}
+
+void z_sched_wake_threads(struct k_thread *first,
+			  struct k_thread *(*next)(struct k_thread *thread))
+{
+	struct wake_batch batch = { 0 };
+
+	K_SPINLOCK(&_sched_spinlock) {
+		struct k_thread *thread = first;
+
+		while (thread != NULL) {
+			struct k_thread *following = next(thread);
+
+#ifdef CONFIG_EVENTS
+			thread->no_wake_on_timeout = false;
+#endif /* CONFIG_EVENTS */
+			if ((thread->base.thread_state &
+			     (_THREAD_DEAD | _THREAD_ABORTING)) == 0U) {
+				z_mark_thread_as_started(thread);
+				wake_batch_add(&batch, thread);
+			}
+			thread = following;
+		}
+		(void)wake_batch_end(&batch);
+	}
+}
+
 int z_sched_wait(struct k_spinlock *lock, k_spinlock_key_t key,
 		 _wait_q_t *wait_q, k_timeout_t timeout, void **data)
 {
@@ -1588,3 +1705,33 @@ int z_sched_waitq_walk(_wait_q_t  *wait_q,
 
 	return status;
 }
+
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+static int waitq_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	K_SPINLOCK(&_sched_spinlock) {
+		memcpy(stats, obj_core->stats, sizeof(struct k_usage_hist));
+	}
+
+	return 0;
+}
+
+static int waitq_stats_reset(struct k_obj_core *obj_core)
+{
+	K_SPINLOCK(&_sched_spinlock) {
+		memset(obj_core->stats, 0, sizeof(struct k_usage_hist));
+	}
+
+	return 0;
+}
+
+struct k_obj_core_stats_desc z_waitq_stats_desc = {
+	.raw_size = sizeof(struct k_usage_hist),
+	.query_size = sizeof(struct k_usage_hist),
+	.raw = waitq_stats_raw,
+	.query = waitq_stats_raw,
+	.reset = waitq_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_WAIT */
@@ -38,6 +38,56 @@
  */
 static struct k_spinlock lock;
 
+#ifdef CONFIG_SYNC_FAST_PATH
+/* With CONFIG_SYNC_FAST_PATH the count is an atomic word which the
+ * uncontended paths update without taking the lock.  Threads only pend
+ * after setting it to Z_SEM_WAITERS under the lock, and any give that
+ * finds that value goes to the locked path to wake them.  Givers also
+ * use the locked path when CONFIG_POLL is enabled: k_poll() registers
+ * on a semaphore under its own lock and relies on the giver walking
+ * the poll event list after the count update.
+ */
+static bool sem_try_take(struct k_sem *sem)
+{
+	atomic_val_t count;
+
+	do {
+		count = atomic_get(&sem->count);
+		if ((count == Z_SEM_WAITERS) || (count == 0)) {
+			return false;
+		}
+	} while (!atomic_cas(&sem->count, count,
+			    (atomic_val_t)((unsigned int)count - 1U)));
+
+	return true;
+}
+
+/* Increment the count up to the limit, returns false on Z_SEM_WAITERS
+ * unless the caller holds the lock and has found the wait queue empty.
+ */
+static bool sem_try_give(struct k_sem *sem, bool locked)
+{
+	atomic_val_t count;
+	atomic_val_t next;
+
+	do {
+		count = atomic_get(&sem->count);
+		if (count == Z_SEM_WAITERS) {
+			if (!locked) {
+				return false;
+			}
+			next = 1;
+		} else {
+			unsigned int val = (unsigned int)count;
+
+			next = (atomic_val_t)(val + ((val != sem->limit) ? 1U : 0U));
+		}
+	} while (!atomic_cas(&sem->count, count, next));
+
+	return true;
+}
+#endif /* CONFIG_SYNC_FAST_PATH */
+
 #ifdef CONFIG_OBJ_CORE_SEM
 static struct k_obj_type obj_type_sem;
 #endif /* CONFIG_OBJ_CORE_SEM */
@@ -45,6 +95,12 @@ static struct k_obj_type obj_type_sem;
 int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 		      unsigned int limit)
 {
+	/*
+	 * UINT_MAX stands for no limit, which the fast path caps at
+	 * K_SEM_MAX_LIMIT as UINT_MAX is its waiter marker
+	 */
+	limit = Z_SEM_LIMIT(limit);
+
 	/*
 	 * Limit cannot be zero and count cannot be greater than limit
 	 */
@@ -54,7 +110,11 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_SYNC_FAST_PATH
+	atomic_set(&sem->count, (atomic_val_t)initial_count);
+#else
 	sem->count = initial_count;
+#endif /* CONFIG_SYNC_FAST_PATH */
 	sem->limit = limit;
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_sem, init, sem, 0);
@@ -67,6 +127,10 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 
 #ifdef CONFIG_OBJ_CORE_SEM
 	k_obj_core_init_and_link(K_OBJ_CORE(sem), &obj_type_sem);
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+	k_obj_core_stats_register(K_OBJ_CORE(sem), &sem->wait_q.blocked,
+				  sizeof(struct k_usage_hist));
+#endif /* CONFIG_OBJ_CORE_STATS_WAIT */
 #endif /* CONFIG_OBJ_CORE_SEM */
 
 	return 0;
@@ -95,19 +159,36 @@ static inline bool handle_poll_events(struct k_sem *sem)
 
 void z_impl_k_sem_give(struct k_sem *sem)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key;
 	struct k_thread *thread;
 	bool resched = true;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, give, sem);
 
+#if defined(CONFIG_SYNC_FAST_PATH) && !defined(CONFIG_POLL)
+	if (likely(sem_try_give(sem, false))) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, give, sem);
+		return;
+	}
+#endif
+
+	key = k_spin_lock(&lock);
 	thread = z_unpend_first_thread(&sem->wait_q);
 
 	if (thread != NULL) {
 		arch_thread_return_value_set(thread, 0);
 		z_ready_thread(thread);
+#ifdef CONFIG_SYNC_FAST_PATH
+		if (z_waitq_head(&sem->wait_q) == NULL) {
+			atomic_set(&sem->count, 0);
+		}
+#endif /* CONFIG_SYNC_FAST_PATH */
 	} else {
+#ifdef CONFIG_SYNC_FAST_PATH
+		(void)sem_try_give(sem, true);
+#else
 		sem->count += (sem->count != sem->limit) ? 1U : 0U;
+#endif /* CONFIG_SYNC_FAST_PATH */
 		resched = handle_poll_events(sem);
 	}
 
@@ -131,15 +212,43 @@ static inline void z_vrfy_k_sem_give(struct k_sem *sem)
 
 int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 {
+	k_spinlock_key_t key;
 	int ret;
 
 	__ASSERT(((arch_is_in_isr() == false) ||
 		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
-
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, take, sem, timeout);
 
+#ifdef CONFIG_SYNC_FAST_PATH
+	if (likely(sem_try_take(sem))) {
+		ret = 0;
+		goto out;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		ret = -EBUSY;
+		goto out;
+	}
+
+	key = k_spin_lock(&lock);
+
+	/* Either take a count that was given meanwhile, or publish that
+	 * there are waiters before pending so that givers take the lock.
+	 */
+	while (!atomic_cas(&sem->count, 0, Z_SEM_WAITERS)) {
+		if (sem_try_take(sem)) {
+			k_spin_unlock(&lock, key);
+			ret = 0;
+			goto out;
+		}
+		if (atomic_get(&sem->count) == Z_SEM_WAITERS) {
+			break;
+		}
+	}
+#else
+	key = k_spin_lock(&lock);
+
 	if (likely(sem->count > 0U)) {
 		sem->count--;
 		k_spin_unlock(&lock, key);
@@ -152,6 +261,7 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 		ret = -EBUSY;
 		goto out;
 	}
+#endif /* CONFIG_SYNC_FAST_PATH */
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_sem, take, sem, timeout);
 
@@ -176,7 +286,11 @@ void z_impl_k_sem_reset(struct k_sem *sem)
 		arch_thread_return_value_set(thread, -EAGAIN);
 		z_ready_thread(thread);
 	}
+#ifdef CONFIG_SYNC_FAST_PATH
+	atomic_set(&sem->count, 0);
+#else
 	sem->count = 0;
+#endif /* CONFIG_SYNC_FAST_PATH */
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_sem, reset, sem);
 
@@ -216,11 +330,18 @@ static int init_sem_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_sem, K_OBJ_TYPE_SEM_ID,
 			offsetof(struct k_sem, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+	k_obj_type_stats_init(&obj_type_sem, &z_waitq_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_WAIT */
 
 	/* Initialize and link statically defined semaphores */
 
 	STRUCT_SECTION_FOREACH(k_sem, sem) {
 		k_obj_core_init_and_link(K_OBJ_CORE(sem), &obj_type_sem);
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+		k_obj_core_stats_register(K_OBJ_CORE(sem), &sem->wait_q.blocked,
+					  sizeof(struct k_usage_hist));
+#endif /* CONFIG_OBJ_CORE_STATS_WAIT */
 	}
 
 	return 0;
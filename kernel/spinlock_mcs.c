@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * MCS queued spinlocks.
+ *
+ * A CPU taking an MCS lock appends one of its queue nodes to the lock by
+ * swapping it with the tail pointer of the lock.  If there was a previous
+ * tail, the CPU links its node behind it and spins on its own node until
+ * the previous CPU hands the lock over, so that waiters do not all poll
+ * the same cache line and are served in FIFO order.  The CPU releasing
+ * the lock clears the tail if it is the last in the queue, and otherwise
+ * flags the node of its successor.
+ *
+ * Each CPU has a few nodes, as spinlocks nest.  They are not always
+ * released in LIFO order (z_pend_curr() releases the caller's lock while
+ * holding the scheduler lock), so free nodes are tracked with a bitmask.
+ * Both locking and unlocking happen with interrupts masked on the CPU
+ * owning the node, which makes the bitmask CPU-local.
+ *
+ * A CPU that runs out of nodes falls back to spinning on the tail of the
+ * lock until the queue is empty, and takes the lock with the fallback
+ * node embedded in it.  Only the lock holder uses that node, and the
+ * holder leaves its next pointer cleared on release for the next one.
+ */
+
+#include <kernel_internal.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/util.h>
+
+BUILD_ASSERT(CONFIG_MCS_SPINLOCK_NODES <= 8, "Too many nodes for mask");
+
+/* Keep the nodes of each CPU on their own cache lines, 64 bytes being
+ * the most common line size.
+ */
+struct mcs_cpu {
+	struct z_mcs_node nodes[CONFIG_MCS_SPINLOCK_NODES];
+	uint8_t used;
+} __aligned(64);
+
+static struct mcs_cpu mcs_cpus[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Returns NULL when all the nodes of the CPU are in use */
+static struct z_mcs_node *node_alloc(void)
+{
+	struct mcs_cpu *cpu = &mcs_cpus[arch_curr_cpu()->id];
+	unsigned int i = find_lsb_set(~cpu->used & BIT_MASK(CONFIG_MCS_SPINLOCK_NODES));
+
+	if (i == 0U) {
+		return NULL;
+	}
+
+	cpu->used |= BIT(i - 1U);
+
+	return &cpu->nodes[i - 1U];
+}
+
+static void node_free(struct k_spinlock *l, struct z_mcs_node *node)
+{
+	struct mcs_cpu *cpu = &mcs_cpus[arch_curr_cpu()->id];
+
+	if (node == &l->mcs_fallback) {
+		return;
+	}
+
+	__ASSERT(IN_RANGE(node - cpu->nodes, 0, CONFIG_MCS_SPINLOCK_NODES - 1),
+		 "MCS spinlock released on another CPU");
+
+	cpu->used &= ~BIT(node - cpu->nodes);
+}
+
+static inline void stats_update(struct k_spinlock *l, uint64_t spins)
+{
+#ifdef CONFIG_MCS_SPINLOCK_STATS
+	/* Only the lock holder writes the statistics */
+	l->stats.acquisitions++;
+	if (spins != 0U) {
+		l->stats.contended++;
+		l->stats.spins += spins;
+	}
+#else
+	ARG_UNUSED(l);
+	ARG_UNUSED(spins);
+#endif /* CONFIG_MCS_SPINLOCK_STATS */
+}
+
+void z_mcs_lock(struct k_spinlock *l)
+{
+	struct z_mcs_node *node = node_alloc();
+	struct z_mcs_node *prev;
+	uint64_t spins = 0U;
+
+	if (node == NULL) {
+		node = &l->mcs_fallback;
+		while (!atomic_ptr_cas(&l->mcs_tail, NULL, node)) {
+			arch_spin_relax();
+			spins++;
+		}
+
+		l->mcs_owner = node;
+		stats_update(l, spins);
+		return;
+	}
+
+	atomic_ptr_clear(&node->next);
+	atomic_set(&node->locked, 1);
+
+	prev = atomic_ptr_set(&l->mcs_tail, node);
+	if (prev != NULL) {
+		atomic_ptr_set(&prev->next, node);
+		while (atomic_get(&node->locked) != 0) {
+			arch_spin_relax();
+			spins++;
+		}
+		/* Count handoffs found right away as contended too */
+		spins = MAX(spins, 1U);
+	}
+
+	l->mcs_owner = node;
+	stats_update(l, spins);
+}
+
+bool z_mcs_trylock(struct k_spinlock *l)
+{
+	struct z_mcs_node *node = node_alloc();
+
+	if (node == NULL) {
+		node = &l->mcs_fallback;
+	} else {
+		atomic_ptr_clear(&node->next);
+	}
+
+	if (!atomic_ptr_cas(&l->mcs_tail, NULL, node)) {
+		node_free(l, node);
+		return false;
+	}
+
+	l->mcs_owner = node;
+	stats_update(l, 0U);
+
+	return true;
+}
+
+void z_mcs_unlock(struct k_spinlock *l)
+{
+	struct z_mcs_node *node = l->mcs_owner;
+	struct z_mcs_node *next = atomic_ptr_get(&node->next);
+
+	if (next == NULL) {
+		if (atomic_ptr_cas(&l->mcs_tail, node, NULL)) {
+			node_free(l, node);
+			return;
+		}
+
+		/* A CPU swapped the tail but did not link its node yet */
+		do {
+			arch_spin_relax();
+			next = atomic_ptr_get(&node->next);
+		} while (next == NULL);
+	}
+
+	/* The successor linked to the node, which is unused from now on */
+	atomic_ptr_clear(&node->next);
+	atomic_clear(&next->locked);
+	node_free(l, node);
+}
+
+#ifdef CONFIG_MCS_SPINLOCK_STATS
+void k_spin_stats_get(struct k_spinlock *l, struct k_spinlock_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(l);
+
+	*stats = l->stats;
+	k_spin_unlock(l, key);
+
+	/* Leave out the acquisition made to read them */
+	if (z_spin_is_mcs(l)) {
+		stats->acquisitions--;
+	}
+}
+
+void k_spin_stats_reset(struct k_spinlock *l)
+{
+	K_SPINLOCK(l) {
+		l->stats = (struct k_spinlock_stats) {0};
+	}
+}
+#endif /* CONFIG_MCS_SPINLOCK_STATS */
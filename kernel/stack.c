@@ -38,6 +38,10 @@ void k_stack_init(struct k_stack *stack, stack_data_t *buffer,
 
 #ifdef CONFIG_OBJ_CORE_STACK
 	k_obj_core_init_and_link(K_OBJ_CORE(stack), &obj_type_stack);
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+	k_obj_core_stats_register(K_OBJ_CORE(stack), &stack->wait_q.blocked,
+				  sizeof(struct k_usage_hist));
+#endif /* CONFIG_OBJ_CORE_STATS_WAIT */
 #endif /* CONFIG_OBJ_CORE_STACK */
 }
 
@@ -207,11 +211,18 @@ static int init_stack_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_stack, K_OBJ_TYPE_STACK_ID,
 			offsetof(struct k_stack, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+	k_obj_type_stats_init(&obj_type_stack, &z_waitq_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_WAIT */
 
 	/* Initialize and link statically defined stacks */
 
 	STRUCT_SECTION_FOREACH(k_stack, stack) {
 		k_obj_core_init_and_link(K_OBJ_CORE(stack), &obj_type_stack);
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+		k_obj_core_stats_register(K_OBJ_CORE(stack), &stack->wait_q.blocked,
+					  sizeof(struct k_usage_hist));
+#endif /* CONFIG_OBJ_CORE_STATS_WAIT */
 	}
 
 	return 0;
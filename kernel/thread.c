@@ -547,6 +547,7 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 
 	/* Any given thread has access to itself */
 	k_object_access_grant(new_thread, new_thread);
+	z_thread_perms_index_init(new_thread);
 #endif /* CONFIG_USERSPACE */
 	z_waitq_init(&new_thread->join_queue);
 
@@ -589,6 +590,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 #ifdef CONFIG_EVENTS
 	new_thread->no_wake_on_timeout = false;
 #endif /* CONFIG_EVENTS */
+#ifdef CONFIG_SYS_ARENA_THREAD
+	new_thread->scratch_arena = NULL;
+#endif /* CONFIG_SYS_ARENA_THREAD */
 #ifdef CONFIG_THREAD_MONITOR
 	new_thread->entry.pEntry = entry;
 	new_thread->entry.parameter1 = p1;
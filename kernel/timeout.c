@@ -8,15 +8,18 @@
 #include <zephyr/spinlock.h>
 #include <ksched.h>
 #include <timeout_q.h>
+#include <timeout_wheel.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
 
 static uint64_t curr_tick;
 
+#ifndef CONFIG_TIMEOUT_QUEUE_WHEEL
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif /* !CONFIG_TIMEOUT_QUEUE_WHEEL */
 
-static struct k_spinlock timeout_lock;
+static struct k_spinlock timeout_lock = K_SPINLOCK_MCS_INIT;
 
 #define MAX_WAIT (IS_ENABLED(CONFIG_SYSTEM_CLOCK_SLOPPY_IDLE) \
 		  ? K_TICKS_FOREVER : INT_MAX)
@@ -24,6 +27,15 @@ static struct k_spinlock timeout_lock;
 /* Ticks left to process in the currently-executing sys_clock_announce() */
 static int announce_remaining;
 
+#ifdef CONFIG_TIMEOUT_SLACK
+#define NO_TICK UINT64_MAX
+
+/* Tick the system timer is programmed to expire at, or NO_TICK.  Every
+ * queued timeout expiring before it tolerates being delayed until then.
+ */
+static uint64_t programmed_tick = NO_TICK;
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 #if defined(CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME)
 int z_clock_hw_cycles_per_sec = CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
 
@@ -36,6 +48,33 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+/* With the timing wheel, dticks holds the absolute expiry tick */
+
+static inline struct _timeout *first(void)
+{
+	return z_timeout_wheel_first();
+}
+
+static inline void remove_timeout(struct _timeout *t)
+{
+	z_timeout_wheel_remove(t);
+}
+
+static void insert_timeout(struct _timeout *to, k_ticks_t dticks)
+{
+	to->dticks = curr_tick + dticks;
+	z_timeout_wheel_add(to);
+}
+
+/* must be locked */
+static inline k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	return timeout->dticks - curr_tick;
+}
+
+#else
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -59,6 +98,41 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+static void insert_timeout(struct _timeout *to, k_ticks_t dticks)
+{
+	struct _timeout *t;
+
+	to->dticks = dticks;
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -80,6 +154,24 @@ static int32_t elapsed(void)
 	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
 }
 
+/* Ticks until the system timer has to expire for the first timeout.
+ * With slack, that is the tick it is already programmed for if the
+ * timeout expires no later than that, as it then tolerates the delay.
+ */
+static k_ticks_t wakeup_rem(const struct _timeout *to)
+{
+	k_ticks_t ticks = timeout_rem(to);
+
+#ifdef CONFIG_TIMEOUT_SLACK
+	if ((programmed_tick != NO_TICK) &&
+	    (curr_tick + ticks <= programmed_tick)) {
+		ticks = programmed_tick - curr_tick;
+	}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+	return ticks;
+}
+
 static int32_t next_timeout(void)
 {
 	struct _timeout *to = first();
@@ -87,17 +179,69 @@ static int32_t next_timeout(void)
 	int32_t ret;
 
 	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	    ((int64_t)(wakeup_rem(to) - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, wakeup_rem(to) - ticks_elapsed);
 	}
 
 	return ret;
 }
 
-void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
-		   k_timeout_t timeout)
+static void set_timeout(int32_t ticks)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	programmed_tick = (ticks == MAX_WAIT) ? NO_TICK
+					      : curr_tick + elapsed() + ticks;
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+	sys_clock_set_timeout(ticks, false);
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Program the system timer, if needed, for a newly added timeout
+ * expiring at tick expiry and tolerating up to slack ticks of delay.
+ */
+static void set_timeout_slack(struct _timeout *to, uint64_t expiry,
+			      k_ticks_t slack)
+{
+	uint64_t latest = expiry + slack;
+
+	if ((programmed_tick != NO_TICK) && (expiry <= programmed_tick)) {
+		if (programmed_tick <= latest) {
+			/* Expires in the batch already programmed */
+			return;
+		}
+
+		/* The timeouts expiring before the programmed tick
+		 * tolerate any earlier one, so wait as long as this one
+		 * tolerates.
+		 */
+		set_timeout((int32_t)MAX(0, (int64_t)(latest - curr_tick) -
+					    elapsed()));
+	} else if (to == first()) {
+		set_timeout(next_timeout());
+	}
+}
+
+/* sys_clock_announce() reprograms the system timer once its callbacks
+ * are done, and may stop short of the programmed tick when the driver
+ * announces intermediate ticks.  Keep that tick within the tolerance of
+ * a timeout added meanwhile, so that reprogramming cannot delay it.
+ */
+static void clamp_programmed_tick(uint64_t expiry, k_ticks_t slack)
+{
+	uint64_t latest = expiry + slack;
+
+	if ((programmed_tick != NO_TICK) && (expiry <= programmed_tick) &&
+	    (latest < programmed_tick)) {
+		programmed_tick = latest;
+	}
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+static void add_timeout(struct _timeout *to, _timeout_func_t fn,
+			k_timeout_t timeout, k_ticks_t slack)
 {
 	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
 		return;
@@ -111,36 +255,49 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
+		k_ticks_t dticks;
 
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    (Z_TICK_ABS(timeout.ticks) >= 0)) {
 			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
 
-			to->dticks = MAX(1, ticks);
+			dticks = MAX(1, ticks);
 		} else {
-			to->dticks = timeout.ticks + 1 + elapsed();
+			dticks = timeout.ticks + 1 + elapsed();
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
+		insert_timeout(to, dticks);
 
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
+#ifdef CONFIG_TIMEOUT_SLACK
+		if (announce_remaining == 0) {
+			set_timeout_slack(to, curr_tick + dticks, slack);
+		} else {
+			clamp_programmed_tick(curr_tick + dticks, slack);
 		}
+#else
+		ARG_UNUSED(slack);
 
 		if (to == first() && announce_remaining == 0) {
-			sys_clock_set_timeout(next_timeout(), false);
+			set_timeout(next_timeout());
 		}
+#endif /* CONFIG_TIMEOUT_SLACK */
 	}
 }
 
+void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
+		   k_timeout_t timeout)
+{
+	add_timeout(to, fn, timeout, 0);
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+void z_add_timeout_slack(struct _timeout *to, _timeout_func_t fn,
+			 k_timeout_t timeout, k_ticks_t slack)
+{
+	add_timeout(to, fn, timeout, MAX(0, slack));
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 int z_abort_timeout(struct _timeout *to)
 {
 	int ret = -EINVAL;
@@ -155,21 +312,6 @@ int z_abort_timeout(struct _timeout *to)
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
-
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks;
-}
-
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
@@ -228,13 +370,18 @@ void sys_clock_announce(int32_t ticks)
 	struct _timeout *t;
 
 	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
+	     (t != NULL) && (timeout_rem(t) <= announce_remaining);
 	     t = first()) {
-		int dt = t->dticks;
+		int dt = timeout_rem(t);
 
 		curr_tick += dt;
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+		remove_timeout(t);
+		z_timeout_wheel_advance(curr_tick);
+#else
 		t->dticks = 0;
 		remove_timeout(t);
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 		k_spin_unlock(&timeout_lock, key);
 		t->fn(t);
@@ -242,14 +389,20 @@ void sys_clock_announce(int32_t ticks)
 		announce_remaining -= dt;
 	}
 
+#ifndef CONFIG_TIMEOUT_QUEUE_WHEEL
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
 	}
+#endif /* !CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
 
-	sys_clock_set_timeout(next_timeout(), false);
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	z_timeout_wheel_advance(curr_tick);
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+	set_timeout(next_timeout());
 
 	k_spin_unlock(&timeout_lock, key);
 
@@ -330,7 +483,19 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	K_SPINLOCK(&timeout_lock) {
+		z_timeout_wheel_rebase(tick);
+		curr_tick = tick;
+	}
+#else
 	curr_tick = tick;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* The programmed tick does not make sense on the new time base */
+	programmed_tick = NO_TICK;
+#endif /* CONFIG_TIMEOUT_SLACK */
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+#include <timeout_wheel.h>
+
+/*
+ * A timeout lives at the level given by the most significant group of
+ * WHEEL_BITS tick bits in which its expiry differs from the wheel base,
+ * in the slot indexed by its expiry's bits of that group.  Thus every
+ * timeout at level N shares all higher bits with the base, so:
+ *
+ * - level 0 slots hold timeouts expiring on exactly one tick,
+ * - the lowest non-empty slot of the lowest non-empty level holds the
+ *   earliest timeout,
+ * - when the base enters a new level N block, only the level N slot
+ *   for that block needs to be cascaded to lower levels.
+ *
+ * Timeouts expiring on the same tick are always on the same list and
+ * are only ever appended or moved in order, which keeps them FIFO.
+ */
+
+#define WHEEL_BITS   CONFIG_TIMEOUT_WHEEL_LEVEL_BITS
+#define WHEEL_SLOTS  BIT(WHEEL_BITS)
+#define WHEEL_MASK   (WHEEL_SLOTS - 1U)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+
+/* Pseudo level for timeouts beyond the range of the wheel */
+#define OVERFLOW_LEVEL WHEEL_LEVELS
+
+#define WHEEL_RANGE_BITS (WHEEL_LEVELS * WHEEL_BITS)
+
+BUILD_ASSERT(WHEEL_SLOTS <= 32, "slot bitmaps are 32 bit wide");
+BUILD_ASSERT(WHEEL_RANGE_BITS < 64, "wheel range exceeds the tick count");
+
+/* Slot lists are only initialized when they become non-empty, as
+ * tracked in the per-level occupancy bitmaps, so no init hook is
+ * needed before the first timeout is added.
+ */
+static sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static uint32_t wheel_map[WHEEL_LEVELS];
+static sys_dlist_t overflow = SYS_DLIST_STATIC_INIT(&overflow);
+static uint64_t wheel_base;
+
+/* Cached result of z_timeout_wheel_first(), valid if first_valid */
+static struct _timeout *first_to;
+static bool first_valid = true;
+
+static inline uint64_t expiry(const struct _timeout *to)
+{
+	return (uint64_t)to->dticks;
+}
+
+/* Append all nodes of src to dst in order, leaving src empty */
+static void splice(sys_dlist_t *dst, sys_dlist_t *src)
+{
+	if (!sys_dlist_is_empty(src)) {
+		sys_dnode_t *head = src->head;
+		sys_dnode_t *tail = src->tail;
+
+		head->prev = dst->tail;
+		dst->tail->next = head;
+		tail->next = dst;
+		dst->tail = tail;
+		sys_dlist_init(src);
+	}
+}
+
+static int level_of(uint64_t tick)
+{
+	uint64_t diff = tick ^ wheel_base;
+
+	if (diff < WHEEL_SLOTS) {
+		return 0;
+	}
+
+	int level = (63 - u64_count_leading_zeros(diff)) / WHEEL_BITS;
+
+	return MIN(level, OVERFLOW_LEVEL);
+}
+
+static inline unsigned int slot_of(uint64_t tick, int level)
+{
+	return (unsigned int)(tick >> (level * WHEEL_BITS)) & WHEEL_MASK;
+}
+
+static sys_dlist_t *list_of(const struct _timeout *to, int *level,
+			    unsigned int *slot)
+{
+	*level = level_of(expiry(to));
+	if (*level == OVERFLOW_LEVEL) {
+		return &overflow;
+	}
+
+	*slot = slot_of(expiry(to), *level);
+	return &wheel[*level][*slot];
+}
+
+static void insert(struct _timeout *to)
+{
+	int level;
+	unsigned int slot = 0;
+	sys_dlist_t *list = list_of(to, &level, &slot);
+
+	__ASSERT(expiry(to) >= wheel_base, "timeout expires in the past");
+
+	if ((level != OVERFLOW_LEVEL) && ((wheel_map[level] & BIT(slot)) == 0U)) {
+		sys_dlist_init(list);
+		wheel_map[level] |= BIT(slot);
+	}
+	sys_dlist_append(list, &to->node);
+}
+
+void z_timeout_wheel_add(struct _timeout *to)
+{
+	insert(to);
+
+	if (first_valid && ((first_to == NULL) ||
+			    (expiry(to) < expiry(first_to)))) {
+		first_to = to;
+	}
+}
+
+void z_timeout_wheel_remove(struct _timeout *to)
+{
+	int level;
+	unsigned int slot = 0;
+	sys_dlist_t *list = list_of(to, &level, &slot);
+
+	sys_dlist_remove(&to->node);
+
+	if ((level != OVERFLOW_LEVEL) && sys_dlist_is_empty(list)) {
+		wheel_map[level] &= ~BIT(slot);
+	}
+
+	if (to == first_to) {
+		first_to = NULL;
+		first_valid = false;
+	}
+}
+
+/* Earliest timeout of a list, the first queued one on ties */
+static struct _timeout *list_min(sys_dlist_t *list)
+{
+	struct _timeout *min = NULL;
+	struct _timeout *t;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(list, t, node) {
+		if ((min == NULL) || (expiry(t) < expiry(min))) {
+			min = t;
+		}
+	}
+
+	return min;
+}
+
+struct _timeout *z_timeout_wheel_first(void)
+{
+	if (first_valid) {
+		return first_to;
+	}
+
+	first_to = NULL;
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		if (wheel_map[level] != 0U) {
+			unsigned int slot = u32_count_trailing_zeros(wheel_map[level]);
+			sys_dlist_t *list = &wheel[level][slot];
+
+			if (level == 0) {
+				first_to = CONTAINER_OF(sys_dlist_peek_head(list),
+							struct _timeout, node);
+			} else {
+				first_to = list_min(list);
+			}
+			break;
+		}
+	}
+
+	if (first_to == NULL) {
+		first_to = list_min(&overflow);
+	}
+
+	first_valid = true;
+	return first_to;
+}
+
+/* Re-queue every timeout of a list relative to the current base */
+static void requeue(sys_dlist_t *list)
+{
+	sys_dnode_t *node;
+
+	while ((node = sys_dlist_get(list)) != NULL) {
+		insert(CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+
+void z_timeout_wheel_advance(uint64_t tick)
+{
+	uint64_t old = wheel_base;
+
+	__ASSERT_NO_MSG(tick >= old);
+	wheel_base = tick;
+
+	if ((old >> WHEEL_RANGE_BITS) != (tick >> WHEEL_RANGE_BITS)) {
+		sys_dlist_t tmp;
+
+		sys_dlist_init(&tmp);
+		splice(&tmp, &overflow);
+		requeue(&tmp);
+	}
+
+	/* Timeouts in the level N slot of the block the base just
+	 * entered now share that block with the base and belong to a
+	 * lower level.  No other slot is affected.
+	 */
+	for (int level = WHEEL_LEVELS - 1; level > 0; level--) {
+		if ((old >> (level * WHEEL_BITS)) == (tick >> (level * WHEEL_BITS))) {
+			continue;
+		}
+
+		unsigned int slot = slot_of(tick, level);
+
+		if ((wheel_map[level] & BIT(slot)) != 0U) {
+			sys_dlist_t tmp;
+
+			sys_dlist_init(&tmp);
+			splice(&tmp, &wheel[level][slot]);
+			wheel_map[level] &= ~BIT(slot);
+			requeue(&tmp);
+		}
+	}
+}
+
+void z_timeout_wheel_rebase(uint64_t tick)
+{
+	sys_dlist_t all;
+	sys_dnode_t *node;
+
+	sys_dlist_init(&all);
+
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		while (wheel_map[level] != 0U) {
+			unsigned int slot = u32_count_trailing_zeros(wheel_map[level]);
+
+			splice(&all, &wheel[level][slot]);
+			wheel_map[level] &= ~BIT(slot);
+		}
+	}
+	splice(&all, &overflow);
+
+	SYS_DLIST_FOR_EACH_NODE(&all, node) {
+		struct _timeout *t = CONTAINER_OF(node, struct _timeout, node);
+
+		t->dticks += (int64_t)(tick - wheel_base);
+	}
+
+	wheel_base = tick;
+	first_to = NULL;
+	first_valid = false;
+	requeue(&all);
+}
@@ -32,6 +32,81 @@ static uint32_t usage_now(void)
 	return (now == 0) ? 1 : now;
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS
+static inline void usage_hist_add(struct k_usage_hist *hist, uint32_t cycles)
+{
+	/* Bucket i holds [2^i, 2^(i+1)), bucket 0 also holds 0 */
+	unsigned int i = MAX(find_msb_set(cycles), 1U) - 1U;
+
+	hist->buckets[MIN(i, K_USAGE_HIST_BUCKETS - 1U)]++;
+}
+
+/* Account for the delay between @a thread being made ready and running */
+static void sched_usage_hist_start(struct _cpu *cpu, struct k_thread *thread)
+{
+	uint32_t ready0 = thread->base.usage_ready0;
+
+	cpu->window0 = cpu->usage0;
+
+	if (ready0 == 0U) {
+		return;
+	}
+
+	uint32_t cycles = cpu->usage0 - ready0;
+
+	thread->base.usage_ready0 = 0U;
+
+	if (thread->base.usage.track_usage) {
+		usage_hist_add(&thread->base.usage.sched_delay, cycles);
+	}
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+	if (cpu->usage->track_usage) {
+		usage_hist_add(&cpu->usage->sched_delay, cycles);
+	}
+#endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
+}
+
+/* Account for the execution window of the current thread ending at @a now */
+static void sched_usage_hist_stop(struct _cpu *cpu, uint32_t now)
+{
+	uint32_t cycles = now - cpu->window0;
+
+	if (cpu->current->base.usage.track_usage) {
+		usage_hist_add(&cpu->current->base.usage.run_slice, cycles);
+	}
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+	if (cpu->usage->track_usage && (cpu->current != cpu->idle_thread)) {
+		usage_hist_add(&cpu->usage->run_slice, cycles);
+	}
+#endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
+}
+
+/*
+ * The following are called with the scheduler lock held, which also
+ * protects the wait queue histograms.
+ */
+
+void z_sched_usage_ready(struct k_thread *thread)
+{
+	thread->base.usage_ready0 = usage_now();
+}
+
+void z_sched_usage_pend(struct k_thread *thread)
+{
+	thread->base.usage_pend0 = usage_now();
+}
+
+void z_sched_usage_unpend(struct k_thread *thread, _wait_q_t *wait_q)
+{
+	usage_hist_add(&wait_q->blocked, usage_now() - thread->base.usage_pend0);
+}
+#else
+#define sched_usage_hist_start(cpu, thread)   do { } while (0)
+#define sched_usage_hist_stop(cpu, now)       do { } while (0)
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 {
@@ -73,17 +148,22 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 
 void z_sched_usage_start(struct k_thread *thread)
 {
-#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
+#if defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) || \
+	defined(CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS)
 	k_spinlock_key_t  key;
 
 	key = k_spin_lock(&usage_lock);
 
 	_current_cpu->usage0 = usage_now();   /* Always update */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 	if (thread->base.usage.track_usage) {
 		thread->base.usage.num_windows++;
 		thread->base.usage.current = 0;
 	}
+#endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+
+	sched_usage_hist_start(_current_cpu, thread);
 
 	k_spin_unlock(&usage_lock, key);
 #else
@@ -93,7 +173,7 @@ void z_sched_usage_start(struct k_thread *thread)
 	 */
 
 	_current_cpu->usage0 = usage_now();
-#endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS || CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS */
 }
 
 void z_sched_usage_stop(void)
@@ -105,13 +185,15 @@ void z_sched_usage_stop(void)
 	uint32_t u0 = cpu->usage0;
 
 	if (u0 != 0) {
-		uint32_t cycles = usage_now() - u0;
+		uint32_t now = usage_now();
+		uint32_t cycles = now - u0;
 
 		if (cpu->current->base.usage.track_usage) {
 			sched_thread_update_usage(cpu->current, cycles);
 		}
 
 		sched_cpu_update_usage(cpu, cycles);
+		sched_usage_hist_stop(cpu, now);
 	}
 
 	cpu->usage0 = 0;
@@ -382,6 +464,10 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats->longest = 0ULL;
 	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS
+	stats->sched_delay = (struct k_usage_hist) {};
+	stats->run_slice = (struct k_usage_hist) {};
+#endif /* CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS */
 
 	if (thread != _current_cpu->current) {
 
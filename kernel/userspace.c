@@ -12,6 +12,7 @@
 #include <zephyr/kernel_structs.h>
 #include <zephyr/sys/sys_io.h>
 #include <ksched.h>
+#include <kernel_internal.h>
 #include <zephyr/syscall.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/device.h>
@@ -183,9 +184,157 @@ extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
  */
 static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
 
+#if CONFIG_DYNAMIC_OBJECTS_HASH_SIZE > 0
 /*
- * TODO: Write some hash table code that will replace obj_list.
+ * Open addressing hash table of allocated kernel objects, keyed by object
+ * address, so that validating a system call argument does not have to
+ * walk obj_list.
+ *
+ * Lookups take no lock, RCU style: a slot is published by setting its
+ * object and then its key, and a lookup reads the key again after the
+ * object to catch a concurrent removal.  Updates are serialized by
+ * hash_lock, which is the innermost lock: objects get removed with
+ * obj_lock and possibly lists_lock held.
+ *
+ * Linear probing stops at the first empty slot, so a removed entry leaves
+ * a tombstone behind, unless the following slot is empty: then no probe
+ * goes through it, and it is cleared along with the tombstones before it.
+ * Objects which would take the table over 3/4 load are only on obj_list,
+ * hash_overflow counting them so that lookups know when a miss needs a
+ * search of the list.
  */
+#define HASH_SLOTS	CONFIG_DYNAMIC_OBJECTS_HASH_SIZE
+#define HASH_MAX_USED	(HASH_SLOTS - (HASH_SLOTS / 4))
+
+/* Never the address of an object, which is at least word aligned */
+#define HASH_TOMBSTONE	((void *)1)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(HASH_SLOTS),
+	     "CONFIG_DYNAMIC_OBJECTS_HASH_SIZE must be a power of two");
+
+struct hash_slot {
+	atomic_ptr_t key;
+	atomic_ptr_t dyn;
+};
+
+static struct hash_slot hash_table[HASH_SLOTS];
+static struct k_spinlock hash_lock;	/* hash_table updates */
+static size_t hash_used;		/* live entries and tombstones */
+static atomic_t hash_overflow;
+
+static inline size_t hash_home(const void *obj)
+{
+	uintptr_t addr = (uintptr_t)obj;
+	uint32_t h = (uint32_t)addr;
+
+#if UINTPTR_MAX > UINT32_MAX
+	h ^= (uint32_t)(addr >> 32);
+#endif /* UINTPTR_MAX > UINT32_MAX */
+
+	/* Fibonacci hashing, folding the well mixed top bits down */
+	h *= 2654435769U;
+	h ^= h >> 16;
+
+	return h & (HASH_SLOTS - 1);
+}
+
+static inline size_t hash_next(size_t i)
+{
+	return (i + 1) & (HASH_SLOTS - 1);
+}
+
+static struct dyn_obj *dyn_hash_find(const void *obj)
+{
+	size_t i = hash_home(obj);
+
+	for (size_t n = 0; n < HASH_SLOTS; n++, i = hash_next(i)) {
+		void *key = atomic_ptr_get(&hash_table[i].key);
+
+		if (key == obj) {
+			struct dyn_obj *dyn = atomic_ptr_get(&hash_table[i].dyn);
+
+			if (atomic_ptr_get(&hash_table[i].key) == obj) {
+				return dyn;
+			}
+		} else if (key == NULL) {
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+static void dyn_hash_insert(struct dyn_obj *dyn)
+{
+	const void *obj = dyn->kobj.name;
+	size_t i = hash_home(obj);
+	struct hash_slot *slot = NULL;
+	k_spinlock_key_t key = k_spin_lock(&hash_lock);
+
+	for (size_t n = 0; n < HASH_SLOTS; n++, i = hash_next(i)) {
+		void *k = atomic_ptr_get(&hash_table[i].key);
+
+		if (k == HASH_TOMBSTONE) {
+			slot = &hash_table[i];
+			break;
+		}
+		if (k == NULL) {
+			if (hash_used < HASH_MAX_USED) {
+				slot = &hash_table[i];
+				hash_used++;
+			}
+			break;
+		}
+	}
+
+	if (slot != NULL) {
+		atomic_ptr_set(&slot->dyn, dyn);
+		atomic_ptr_set(&slot->key, (void *)obj);
+	} else {
+		atomic_inc(&hash_overflow);
+	}
+
+	k_spin_unlock(&hash_lock, key);
+}
+
+static void dyn_hash_remove(struct dyn_obj *dyn)
+{
+	const void *obj = dyn->kobj.name;
+	size_t i = hash_home(obj);
+	void *k = NULL;
+	k_spinlock_key_t key = k_spin_lock(&hash_lock);
+
+	for (size_t n = 0; n < HASH_SLOTS; n++, i = hash_next(i)) {
+		k = atomic_ptr_get(&hash_table[i].key);
+		if ((k == obj) || (k == NULL)) {
+			break;
+		}
+	}
+
+	if (k != obj) {
+		/* Not in the table: it was one of the overflow */
+		atomic_dec(&hash_overflow);
+		goto out;
+	}
+
+	atomic_ptr_set(&hash_table[i].key, HASH_TOMBSTONE);
+	atomic_ptr_clear(&hash_table[i].dyn);
+
+	/* Clear the tombstones no probe needs to go through anymore */
+	while ((atomic_ptr_get(&hash_table[hash_next(i)].key) == NULL) &&
+	       (atomic_ptr_get(&hash_table[i].key) == HASH_TOMBSTONE)) {
+		atomic_ptr_clear(&hash_table[i].key);
+		hash_used--;
+		i = (i - 1) & (HASH_SLOTS - 1);
+	}
+
+out:
+	k_spin_unlock(&hash_lock, key);
+}
+#else
+#define dyn_hash_insert(dyn) do { } while (false)
+#define dyn_hash_remove(dyn) do { } while (false)
+#endif /* CONFIG_DYNAMIC_OBJECTS_HASH_SIZE > 0 */
 
 static size_t obj_size_get(enum k_objects otype)
 {
@@ -226,6 +375,13 @@ static struct dyn_obj *dyn_object_find(const void *obj)
 	struct dyn_obj *node;
 	k_spinlock_key_t key;
 
+#if CONFIG_DYNAMIC_OBJECTS_HASH_SIZE > 0
+	node = dyn_hash_find(obj);
+	if ((node != NULL) || (atomic_get(&hash_overflow) == 0)) {
+		return node;
+	}
+#endif /* CONFIG_DYNAMIC_OBJECTS_HASH_SIZE > 0 */
+
 	/* For any dynamically allocated kernel object, the object
 	 * pointer is just a member of the containing struct dyn_obj,
 	 * so just a little arithmetic is necessary to locate the
@@ -377,6 +533,7 @@ static struct k_object *dynamic_object_create(enum k_objects otype, size_t align
 
 	sys_dlist_append(&obj_list, &dyn->dobj_list);
 	k_spin_unlock(&lists_lock, key);
+	dyn_hash_insert(dyn);
 
 	return &dyn->kobj;
 }
@@ -470,6 +627,7 @@ void k_object_free(void *obj)
 	dyn = dyn_object_find(obj);
 	if (dyn != NULL) {
 		sys_dlist_remove(&dyn->dobj_list);
+		dyn_hash_remove(dyn);
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
 			thread_idx_free(dyn->kobj.data.thread_id);
@@ -580,6 +738,7 @@ static void unref_check(struct k_object *ko, uintptr_t index)
 	}
 
 	sys_dlist_remove(&dyn->dobj_list);
+	dyn_hash_remove(dyn);
 	k_free(dyn->data);
 	k_free(dyn);
 out:
@@ -645,6 +804,11 @@ void k_thread_perms_all_clear(struct k_thread *thread)
 	}
 }
 
+void z_thread_perms_index_init(struct k_thread *thread)
+{
+	thread->perms_index = (int)thread_index_get(thread);
+}
+
 static int thread_perms_test(struct k_object *ko)
 {
 	int index;
@@ -653,7 +817,8 @@ static int thread_perms_test(struct k_object *ko)
 		return 1;
 	}
 
-	index = thread_index_get(_current);
+	/* Cached, rather than looking up the thread object every time */
+	index = _current->perms_index;
 	if (index != -1) {
 		return sys_bitfield_test_bit((mem_addr_t)&ko->perms, index);
 	}
@@ -870,6 +870,19 @@ void k_work_init_delayable(struct k_work_delayable *dwork,
 	SYS_PORT_TRACING_OBJ_INIT(k_work_delayable, dwork);
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+				k_timeout_t slack)
+{
+	__ASSERT_NO_MSG(dwork != NULL);
+	__ASSERT(slack.ticks >= 0, "slack must be a relative timeout");
+
+	K_SPINLOCK(&lock) {
+		dwork->slack = slack.ticks;
+	}
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 static inline int work_delayable_busy_get_locked(const struct k_work_delayable *dwork)
 {
 	return flags_get(&dwork->work.flags) & K_WORK_MASK;
@@ -922,7 +935,11 @@ static int schedule_for_queue_locked(struct k_work_q **queuep,
 	dwork->queue = *queuep;
 
 	/* Add timeout */
+#ifdef CONFIG_TIMEOUT_SLACK
+	z_add_timeout_slack(&dwork->timeout, work_timeout, delay, dwork->slack);
+#else
 	z_add_timeout(&dwork->timeout, work_timeout, delay);
+#endif /* CONFIG_TIMEOUT_SLACK */
 
 	return ret;
 }
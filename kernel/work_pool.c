@@ -0,0 +1,525 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * Work-stealing pool of threads running k_work items.
+ *
+ * Each worker owns a Chase-Lev deque: it pushes and pops items at the
+ * bottom without locking, and any other worker may steal the oldest
+ * item from the top with a single compare-and-swap.  Items submitted
+ * from outside the pool go to the inbox of the worker of the preferred
+ * (or submitting) CPU, a list protected by the pool lock, which that
+ * worker moves to its deque in batches so that idle workers can steal
+ * them.  Items submitted by a work handler running in the pool are
+ * pushed to the local deque directly.
+ *
+ * The pool lock also protects the QUEUED and RUNNING flags of the work
+ * items, which give the same resubmission semantics as a k_work_q: an
+ * item resubmitted while it runs is handed to the worker running it,
+ * outside of its deque so that no other worker can steal it, and runs
+ * again once its handler returns.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/printk.h>
+
+#define DEQUE_SIZE CONFIG_WORK_POOL_DEQUE_SIZE
+#define DEQUE_MASK (DEQUE_SIZE - 1)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(DEQUE_SIZE),
+	     "CONFIG_WORK_POOL_DEQUE_SIZE must be a power of two");
+
+#define MAX_WORKERS (sizeof(uint32_t) * 8)
+
+#ifdef CONFIG_OBJ_CORE_WORK_POOL
+static struct k_obj_type obj_type_work_pool;
+#endif /* CONFIG_OBJ_CORE_WORK_POOL */
+
+/* Number of items in a deque, indices only ever grow and may wrap */
+static inline atomic_val_t deque_len(atomic_val_t top, atomic_val_t bottom)
+{
+	return (atomic_val_t)((unsigned long)bottom - (unsigned long)top);
+}
+
+/* Owner only */
+static bool deque_push(struct k_work_pool_worker *w, struct k_work *work)
+{
+	atomic_val_t b = atomic_get(&w->bottom);
+	atomic_val_t t = atomic_get(&w->top);
+
+	if (deque_len(t, b) >= DEQUE_SIZE) {
+		return false;
+	}
+
+	atomic_ptr_set(&w->slots[b & DEQUE_MASK], work);
+	atomic_set(&w->bottom, b + 1);
+
+	return true;
+}
+
+/* Owner only */
+static struct k_work *deque_pop(struct k_work_pool_worker *w)
+{
+	atomic_val_t b = atomic_get(&w->bottom) - 1;
+	atomic_val_t t;
+	struct k_work *work = NULL;
+
+	/* Publish the claim on the bottom item before looking at top,
+	 * atomic_set() is a full barrier.
+	 */
+	atomic_set(&w->bottom, b);
+	t = atomic_get(&w->top);
+
+	if (deque_len(t, b) >= 0) {
+		work = atomic_ptr_get(&w->slots[b & DEQUE_MASK]);
+		if (t == b) {
+			/* Last item: race against thieves for it */
+			if (!atomic_cas(&w->top, t, t + 1)) {
+				work = NULL;
+			}
+			atomic_set(&w->bottom, b + 1);
+		}
+	} else {
+		atomic_set(&w->bottom, b + 1);
+	}
+
+	return work;
+}
+
+static struct k_work *deque_steal(struct k_work_pool_worker *w)
+{
+	atomic_val_t t = atomic_get(&w->top);
+	atomic_val_t b = atomic_get(&w->bottom);
+	struct k_work *work;
+
+	if (deque_len(t, b) <= 0) {
+		return NULL;
+	}
+
+	work = atomic_ptr_get(&w->slots[t & DEQUE_MASK]);
+
+	/* Losing the race to the owner or another thief is just a failed
+	 * steal, the caller will look elsewhere or try again.
+	 */
+	return atomic_cas(&w->top, t, t + 1) ? work : NULL;
+}
+
+static uint32_t worker_depth(struct k_work_pool_worker *w)
+{
+	atomic_val_t len = deque_len(atomic_get(&w->top), atomic_get(&w->bottom));
+
+	return w->inbox_len + (uint32_t)MAX(len, 0) +
+	       ((w->requeued != NULL) ? 1U : 0U);
+}
+
+static void update_max_depth(struct k_work_pool_worker *w)
+{
+	w->stats.max_depth = MAX(w->stats.max_depth, worker_depth(w));
+}
+
+/* The worker the calling thread is, if it is one of the pool */
+static struct k_work_pool_worker *current_worker(struct k_work_pool *pool)
+{
+	if (k_is_in_isr()) {
+		return NULL;
+	}
+
+	struct k_work_pool_worker *w =
+		CONTAINER_OF(k_current_get(), struct k_work_pool_worker, thread);
+
+	if ((w >= pool->workers) && (w < &pool->workers[pool->num_workers])) {
+		return w;
+	}
+
+	return NULL;
+}
+
+/* Wake up the target worker if it is idle, or another idle worker to
+ * steal the item if the target is busy.
+ */
+static void notify(struct k_work_pool *pool, struct k_work_pool_worker *target)
+{
+	uint32_t idle = (uint32_t)atomic_get(&pool->idle);
+
+	if ((target != NULL) && ((idle & BIT(target->id)) != 0U)) {
+		k_sem_give(&target->wake);
+	} else if (idle != 0U) {
+		k_sem_give(&pool->workers[u32_count_trailing_zeros(idle)].wake);
+	} else {
+		/* All workers are busy and will find the item */
+	}
+}
+
+/* The worker running an item, with the pool lock held */
+static struct k_work_pool_worker *running_worker(struct k_work_pool *pool,
+						 struct k_work *work)
+{
+	for (unsigned int i = 0; i < pool->num_workers; i++) {
+		if (pool->workers[i].running == work) {
+			return &pool->workers[i];
+		}
+	}
+
+	return NULL;
+}
+
+int k_work_pool_submit_to_cpu(struct k_work_pool *pool, struct k_work *work,
+			      int cpu)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+	__ASSERT_NO_MSG(work != NULL);
+	__ASSERT_NO_MSG(work->handler != NULL);
+
+	struct k_work_pool_worker *self = current_worker(pool);
+	struct k_work_pool_worker *target;
+	k_spinlock_key_t key = k_spin_lock(&pool->lock);
+
+	if ((work->flags & K_WORK_CANCELING) != 0U) {
+		k_spin_unlock(&pool->lock, key);
+		return -EBUSY;
+	}
+	if ((work->flags & K_WORK_QUEUED) != 0U) {
+		k_spin_unlock(&pool->lock, key);
+		return 0;
+	}
+	work->flags |= K_WORK_QUEUED;
+
+	/* Only the worker running the item may run it again */
+	if ((work->flags & K_WORK_RUNNING) != 0U) {
+		target = running_worker(pool, work);
+		__ASSERT(target != NULL, "work %p running outside the pool", work);
+
+		if (target != NULL) {
+			__ASSERT_NO_MSG(target->requeued == NULL);
+
+			target->requeued = work;
+			update_max_depth(target);
+			k_spin_unlock(&pool->lock, key);
+
+			return 2;
+		}
+	}
+
+	if ((self != NULL) &&
+	    ((cpu == K_WORK_POOL_ANY_CPU) || (cpu == self->id))) {
+		k_spin_unlock(&pool->lock, key);
+
+		if (deque_push(self, work)) {
+			update_max_depth(self);
+			notify(pool, NULL);
+			return 1;
+		}
+
+		/* Deque full, queue it to our own inbox */
+		key = k_spin_lock(&pool->lock);
+		target = self;
+	} else {
+		if (cpu == K_WORK_POOL_ANY_CPU) {
+			cpu = (int)arch_curr_cpu()->id;
+		}
+		target = &pool->workers[(unsigned int)cpu % pool->num_workers];
+	}
+
+	sys_slist_append(&target->inbox, &work->node);
+	target->inbox_len++;
+	update_max_depth(target);
+	k_spin_unlock(&pool->lock, key);
+
+	notify(pool, (target == self) ? NULL : target);
+
+	return 1;
+}
+
+/* Take the first item of a worker's inbox.  With move set, the caller
+ * is that worker and moves as many of the remaining items as fit to
+ * its deque, where idle workers can steal them.
+ */
+static struct k_work *inbox_take(struct k_work_pool *pool,
+				 struct k_work_pool_worker *w, bool move)
+{
+	struct k_work *work = NULL;
+	sys_snode_t *node;
+	k_spinlock_key_t key;
+
+	if (sys_slist_is_empty(&w->inbox)) {
+		return NULL;
+	}
+
+	key = k_spin_lock(&pool->lock);
+
+	node = sys_slist_get(&w->inbox);
+	if (node != NULL) {
+		work = CONTAINER_OF(node, struct k_work, node);
+		w->inbox_len--;
+	}
+
+	while (move && (work != NULL) && !sys_slist_is_empty(&w->inbox)) {
+		struct k_work *next = CONTAINER_OF(sys_slist_peek_head(&w->inbox),
+						   struct k_work, node);
+
+		if (!deque_push(w, next)) {
+			break;
+		}
+		(void)sys_slist_get(&w->inbox);
+		w->inbox_len--;
+	}
+
+	k_spin_unlock(&pool->lock, key);
+
+	return work;
+}
+
+static struct k_work *steal(struct k_work_pool *pool,
+			    struct k_work_pool_worker *w)
+{
+	for (unsigned int i = 1; i < pool->num_workers; i++) {
+		struct k_work_pool_worker *victim =
+			&pool->workers[(w->id + i) % pool->num_workers];
+		struct k_work *work = deque_steal(victim);
+
+		if (work == NULL) {
+			work = inbox_take(pool, victim, false);
+		}
+		if (work != NULL) {
+			w->stats.stolen++;
+			return work;
+		}
+	}
+
+	return NULL;
+}
+
+static bool pool_has_work(struct k_work_pool *pool)
+{
+	for (unsigned int i = 0; i < pool->num_workers; i++) {
+		struct k_work_pool_worker *w = &pool->workers[i];
+
+		if (!sys_slist_is_empty(&w->inbox) ||
+		    (deque_len(atomic_get(&w->top), atomic_get(&w->bottom)) > 0)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void run_work(struct k_work_pool *pool, struct k_work_pool_worker *w,
+		     struct k_work *work)
+{
+	k_spinlock_key_t key = k_spin_lock(&pool->lock);
+
+	do {
+		k_work_handler_t handler = work->handler;
+
+		work->flags &= ~K_WORK_QUEUED;
+		work->flags |= K_WORK_RUNNING;
+		w->running = work;
+		k_spin_unlock(&pool->lock, key);
+
+		handler(work);
+		w->stats.executed++;
+
+		key = k_spin_lock(&pool->lock);
+		work->flags &= ~K_WORK_RUNNING;
+		w->running = NULL;
+
+		/* Resubmitted while it ran */
+		work = w->requeued;
+		w->requeued = NULL;
+	} while (work != NULL);
+
+	k_spin_unlock(&pool->lock, key);
+}
+
+static void worker_main(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	struct k_work_pool_worker *w = p1;
+	struct k_work_pool *pool = w->pool;
+
+	while (true) {
+		struct k_work *work = deque_pop(w);
+
+		if (work == NULL) {
+			work = inbox_take(pool, w, true);
+		}
+		if (work == NULL) {
+			work = steal(pool, w);
+		}
+
+		if (work != NULL) {
+			run_work(pool, w, work);
+			if (!pool->no_yield) {
+				k_yield();
+			}
+			continue;
+		}
+
+		/* Announce that we are idle before checking for work one
+		 * last time: a submitter either sees the flag and wakes us,
+		 * or queued its item before the check.
+		 */
+		atomic_or(&pool->idle, (atomic_val_t)BIT(w->id));
+		if (!pool_has_work(pool)) {
+			(void)k_sem_take(&w->wake, K_FOREVER);
+		}
+		atomic_and(&pool->idle, ~(atomic_val_t)BIT(w->id));
+	}
+}
+
+int k_work_pool_start(struct k_work_pool *pool, int prio,
+		      const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+
+	size_t stride = K_THREAD_STACK_LEN(pool->stack_size);
+
+	CHECKIF((pool->num_workers == 0U) || (pool->num_workers > MAX_WORKERS)) {
+		return -EINVAL;
+	}
+
+	pool->no_yield = (cfg != NULL) && cfg->no_yield;
+	atomic_set(&pool->idle, 0);
+
+	for (unsigned int i = 0; i < pool->num_workers; i++) {
+		struct k_work_pool_worker *w = &pool->workers[i];
+
+		w->pool = pool;
+		w->id = (uint8_t)i;
+		atomic_set(&w->top, 0);
+		atomic_set(&w->bottom, 0);
+		sys_slist_init(&w->inbox);
+		w->inbox_len = 0U;
+		w->running = NULL;
+		w->requeued = NULL;
+		(void)k_sem_init(&w->wake, 0, 1);
+		w->stats = (struct k_work_pool_stats) { 0 };
+
+		(void)k_thread_create(&w->thread,
+				      (k_thread_stack_t *)&pool->stacks[stride * i],
+				      pool->stack_size, worker_main, w, NULL, NULL,
+				      prio, 0, K_FOREVER);
+
+#ifdef CONFIG_THREAD_NAME
+		if ((cfg != NULL) && (cfg->name != NULL)) {
+			char name[CONFIG_THREAD_MAX_NAME_LEN];
+
+			snprintk(name, sizeof(name), "%s/%u", cfg->name, i);
+			k_thread_name_set(&w->thread, name);
+		}
+#endif /* CONFIG_THREAD_NAME */
+
+		if ((cfg != NULL) && cfg->essential) {
+			w->thread.base.user_options |= K_ESSENTIAL;
+		}
+
+#if defined(CONFIG_SCHED_CPU_MASK) && defined(CONFIG_SMP)
+		if (pool->num_workers <= arch_num_cpus()) {
+			(void)k_thread_cpu_pin(&w->thread, (int)i);
+		}
+#endif /* CONFIG_SCHED_CPU_MASK && CONFIG_SMP */
+
+#ifdef CONFIG_OBJ_CORE_WORK_POOL
+		k_obj_core_init_and_link(K_OBJ_CORE(w), &obj_type_work_pool);
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_POOL
+		k_obj_core_stats_register(K_OBJ_CORE(w), &w->stats,
+					  sizeof(struct k_work_pool_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_POOL */
+#endif /* CONFIG_OBJ_CORE_WORK_POOL */
+	}
+
+	for (unsigned int i = 0; i < pool->num_workers; i++) {
+		k_thread_start(&pool->workers[i].thread);
+	}
+
+	return 0;
+}
+
+static void worker_stats_get(struct k_work_pool_worker *w,
+			     struct k_work_pool_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&w->pool->lock);
+
+	*stats = w->stats;
+	stats->depth = worker_depth(w);
+	k_spin_unlock(&w->pool->lock, key);
+}
+
+int k_work_pool_stats_get(struct k_work_pool *pool, unsigned int worker,
+			  struct k_work_pool_stats *stats)
+{
+	CHECKIF((pool == NULL) || (stats == NULL) ||
+		(worker >= pool->num_workers)) {
+		return -EINVAL;
+	}
+
+	worker_stats_get(&pool->workers[worker], stats);
+
+	return 0;
+}
+
+#ifdef CONFIG_OBJ_CORE_WORK_POOL
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_POOL
+static int work_pool_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	worker_stats_get(CONTAINER_OF(obj_core, struct k_work_pool_worker,
+				      obj_core), stats);
+
+	return 0;
+}
+
+static int work_pool_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_work_pool_worker *w =
+		CONTAINER_OF(obj_core, struct k_work_pool_worker, obj_core);
+	k_spinlock_key_t key = k_spin_lock(&w->pool->lock);
+
+	w->stats.executed = 0U;
+	w->stats.stolen = 0U;
+	w->stats.max_depth = worker_depth(w);
+	k_spin_unlock(&w->pool->lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc work_pool_stats_desc = {
+	.raw_size = sizeof(struct k_work_pool_stats),
+	.query_size = sizeof(struct k_work_pool_stats),
+	.raw   = work_pool_stats_raw,
+	.query = work_pool_stats_raw,
+	.reset = work_pool_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_POOL */
+
+static int init_work_pool_obj_core_type(void)
+{
+	z_obj_type_init(&obj_type_work_pool, K_OBJ_TYPE_WORK_POOL_ID,
+			offsetof(struct k_work_pool_worker, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_POOL
+	k_obj_type_stats_init(&obj_type_work_pool, &work_pool_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_POOL */
+
+	return 0;
+}
+
+SYS_INIT(init_work_pool_obj_core_type, PRE_KERNEL_1,
+	 CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+#endif /* CONFIG_OBJ_CORE_WORK_POOL */
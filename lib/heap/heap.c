@@ -37,11 +37,11 @@ static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int bidx)
 
 	CHECK(!chunk_used(h, c));
 	CHECK(b->next != 0);
-	CHECK(h->avail_buckets & BIT(bidx));
+	CHECK(bucket_avail(h, bidx));
 
 	if (next_free_chunk(h, c) == c) {
 		/* this is the last chunk */
-		h->avail_buckets &= ~BIT(bidx);
+		set_bucket_avail(h, bidx, false);
 		b->next = 0;
 	} else {
 		chunkid_t first = prev_free_chunk(h, c),
@@ -70,15 +70,15 @@ static void free_list_add_bidx(struct z_heap *h, chunkid_t c, int bidx)
 	struct z_heap_bucket *b = &h->buckets[bidx];
 
 	if (b->next == 0U) {
-		CHECK((h->avail_buckets & BIT(bidx)) == 0);
+		CHECK(!bucket_avail(h, bidx));
 
 		/* Empty list, first item */
-		h->avail_buckets |= BIT(bidx);
+		set_bucket_avail(h, bidx, true);
 		b->next = c;
 		set_prev_free_chunk(h, c, c);
 		set_next_free_chunk(h, c, c);
 	} else {
-		CHECK(h->avail_buckets & BIT(bidx));
+		CHECK(bucket_avail(h, bidx));
 
 		/* Insert before (!) the "next" pointer */
 		chunkid_t second = b->next;
@@ -208,6 +208,48 @@ size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
 	return chunk_sz - (addr - chunk_base);
 }
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+
+/* First non-empty bucket at or above bidx, or -1 */
+static int find_avail_bucket(struct z_heap *h, int bidx)
+{
+	unsigned int w = bidx / 32;
+	uint32_t map = h->avail_map[w] & ~BIT_MASK(bidx % 32);
+
+	if (map == 0U) {
+		uint32_t wmask = (w < 31U) ? (h->avail_buckets & ~BIT_MASK(w + 1)) : 0U;
+
+		if (wmask == 0U) {
+			return -1;
+		}
+		w = __builtin_ctz(wmask);
+		map = h->avail_map[w];
+	}
+
+	return w * 32 + __builtin_ctz(map);
+}
+
+/* Good fit rather than best fit: every chunk of the bucket found is
+ * big enough, so there is no list to search and both the bucket
+ * lookup and the removal are constant time.
+ */
+static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
+{
+	int bi = find_avail_bucket(h, bucket_fit_idx(h, sz));
+
+	if (bi < 0) {
+		return 0;
+	}
+
+	chunkid_t c = h->buckets[bi].next;
+
+	free_list_remove_bidx(h, c, bi);
+	CHECK(chunk_size(h, c) >= sz);
+	return c;
+}
+
+#else
+
 static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 {
 	int bi = bucket_idx(h, sz);
@@ -260,6 +302,8 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 	return 0;
 }
 
+#endif /* CONFIG_SYS_HEAP_TLSF */
+
 void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
@@ -510,6 +554,9 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	heap->heap = h;
 	h->end_chunk = heap_sz;
 	h->avail_buckets = 0;
+#ifdef CONFIG_SYS_HEAP_TLSF
+	(void)memset(h->avail_map, 0, sizeof(h->avail_map));
+#endif
 
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->free_bytes = 0;
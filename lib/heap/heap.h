@@ -45,6 +45,13 @@
  * obviously.  This memory is part of the user's buffer when
  * allocated.
  *
+ * With CONFIG_SYS_HEAP_TLSF, each power-of-two category is further
+ * split in 2^CONFIG_SYS_HEAP_TLSF_SL_BITS linearly spaced buckets
+ * ("two-level segregated fit").  Allocations then take a chunk from
+ * the first non-empty bucket whose chunks are all big enough, found
+ * in constant time through a two-level bitmap, instead of searching
+ * a bucket.
+ *
  * The field order is so that allocated buffers are immediately bounded
  * by SIZE_AND_USED of the current chunk at the bottom, and LEFT_SIZE of
  * the following chunk at the top. This ordering allows for quick buffer
@@ -65,10 +72,26 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+#define SL_BITS  CONFIG_SYS_HEAP_TLSF_SL_BITS
+#define SL_COUNT BIT(SL_BITS)
+
+/* Enough buckets for the largest chunk size, see bucket_idx() */
+#define MAX_BUCKETS \
+	((IS_ENABLED(CONFIG_SYS_HEAP_SMALL_ONLY) ? 16U : 32U) << SL_BITS)
+#define AVAIL_MAP_WORDS DIV_ROUND_UP(MAX_BUCKETS, 32U)
+#endif
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
+	/* One bit per non-empty bucket, or with CONFIG_SYS_HEAP_TLSF,
+	 * per non-zero word of avail_map.
+	 */
 	uint32_t avail_buckets;
+#ifdef CONFIG_SYS_HEAP_TLSF
+	uint32_t avail_map[AVAIL_MAP_WORDS];
+#endif
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	size_t free_bytes;
 	size_t allocated_bytes;
@@ -247,12 +270,106 @@ static inline size_t chunksz_to_bytes(struct z_heap *h, chunksz_t chunksz_in)
 	return chunksz_in * CHUNK_UNIT - chunk_header_bytes(h);
 }
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+
+/* Sizes below SL_COUNT units get a bucket each.  Above that, each
+ * power-of-two range is split in SL_COUNT buckets indexed by the bits
+ * of the size following the most significant one.
+ */
+static inline int usable_bucket_idx(unsigned int usable_sz)
+{
+	if (usable_sz < SL_COUNT) {
+		return usable_sz;
+	}
+
+	int fl = 31 - __builtin_clz(usable_sz);
+
+	return (fl - SL_BITS + 1) * SL_COUNT +
+	       ((usable_sz >> (fl - SL_BITS)) & (SL_COUNT - 1));
+}
+
+static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
+{
+	return usable_bucket_idx(sz - min_chunk_size(h) + 1);
+}
+
+/* Smallest bucket of which every chunk is at least sz units */
+static inline int bucket_fit_idx(struct z_heap *h, chunksz_t sz)
+{
+	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
+
+	if (usable_sz >= SL_COUNT) {
+		int fl = 31 - __builtin_clz(usable_sz);
+
+		usable_sz += BIT(fl - SL_BITS) - 1U;
+	}
+
+	return usable_bucket_idx(usable_sz);
+}
+
+/* Smallest chunk size in a bucket */
+static inline chunksz_t bucket_min_size(struct z_heap *h, int bidx)
+{
+	unsigned int usable_sz;
+
+	if (bidx < SL_COUNT) {
+		usable_sz = bidx;
+	} else {
+		usable_sz = (SL_COUNT + (bidx % SL_COUNT)) << (bidx / SL_COUNT - 1);
+	}
+
+	return usable_sz - 1 + min_chunk_size(h);
+}
+
+static inline bool bucket_avail(struct z_heap *h, int bidx)
+{
+	return (h->avail_map[bidx / 32] & BIT(bidx % 32)) != 0U;
+}
+
+static inline void set_bucket_avail(struct z_heap *h, int bidx, bool avail)
+{
+	unsigned int w = bidx / 32;
+
+	if (avail) {
+		h->avail_map[w] |= BIT(bidx % 32);
+		h->avail_buckets |= BIT(w);
+	} else {
+		h->avail_map[w] &= ~BIT(bidx % 32);
+		if (h->avail_map[w] == 0U) {
+			h->avail_buckets &= ~BIT(w);
+		}
+	}
+}
+
+#else
+
 static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
 {
 	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
 	return 31 - __builtin_clz(usable_sz);
 }
 
+static inline chunksz_t bucket_min_size(struct z_heap *h, int bidx)
+{
+	return (1 << bidx) - 1 + min_chunk_size(h);
+}
+
+static inline bool bucket_avail(struct z_heap *h, int bidx)
+{
+	return (h->avail_buckets & BIT(bidx)) != 0U;
+}
+
+static inline void set_bucket_avail(struct z_heap *h, int bidx, bool avail)
+{
+	if (avail) {
+		h->avail_buckets |= BIT(bidx);
+	} else {
+		h->avail_buckets &= ~BIT(bidx);
+	}
+}
+
+#endif /* CONFIG_SYS_HEAP_TLSF */
+
 static inline bool size_too_big(struct z_heap *h, size_t bytes)
 {
 	/*
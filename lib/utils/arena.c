@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/sys/arena.h>
+
+void sys_arena_init(struct sys_arena *arena, void *buf, size_t size)
+{
+	*arena = (struct sys_arena) {
+		.base = buf,
+		.size = size,
+	};
+}
+
+int sys_arena_init_from_heap(struct sys_arena *arena, struct k_heap *heap,
+			     size_t size, k_timeout_t timeout)
+{
+	void *buf = k_heap_aligned_alloc(heap, SYS_ARENA_ALIGN, size, timeout);
+
+	if (buf == NULL) {
+		return -ENOMEM;
+	}
+
+	sys_arena_init(arena, buf, size);
+	arena->heap = heap;
+
+	return 0;
+}
+
+void sys_arena_release(struct sys_arena *arena)
+{
+	if (arena->heap != NULL) {
+		k_heap_free(arena->heap, arena->base);
+	}
+
+	*arena = (struct sys_arena) {0};
+}
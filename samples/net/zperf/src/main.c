@@ -14,6 +14,54 @@
 #ifdef CONFIG_NET_LOOPBACK_SIMULATE_PACKET_DROP
 #include <zephyr/net/loopback.h>
 #endif
+
+#if CONFIG_NET_SAMPLE_IDLE_SOCKETS > 0
+#include <zephyr/net/socket.h>
+
+static void open_idle_sockets(void)
+{
+	struct sockaddr_in6 addr = {
+		.sin6_family = AF_INET6,
+		.sin6_addr = IN6ADDR_ANY_INIT,
+	};
+	struct sockaddr_in6 peer = {
+		.sin6_family = AF_INET6,
+	};
+	int i;
+
+	zsock_inet_pton(AF_INET6, CONFIG_NET_CONFIG_PEER_IPV6_ADDR,
+			&peer.sin6_addr);
+
+	for (i = 0; i < CONFIG_NET_SAMPLE_IDLE_SOCKETS; i++) {
+		uint16_t port = CONFIG_NET_SAMPLE_IDLE_SOCKETS_PORT + i;
+		int sock;
+
+		sock = zsock_socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+		if (sock < 0) {
+			printk("Cannot open idle socket %d (%d)\n", i, errno);
+			break;
+		}
+
+		addr.sin6_port = htons(port);
+		if (zsock_bind(sock, (struct sockaddr *)&addr,
+			       sizeof(addr)) < 0) {
+			printk("Cannot bind idle socket %d (%d)\n", i, errno);
+			zsock_close(sock);
+			break;
+		}
+
+		/* Have both bound and connected sockets around */
+		if ((i % 2) != 0) {
+			peer.sin6_port = htons(port);
+			(void)zsock_connect(sock, (struct sockaddr *)&peer,
+					    sizeof(peer));
+		}
+	}
+
+	printk("Opened %d idle sockets\n", i);
+}
+#endif /* CONFIG_NET_SAMPLE_IDLE_SOCKETS > 0 */
+
 int main(void)
 {
 #if defined(CONFIG_USB_DEVICE_STACK)
@@ -28,6 +76,9 @@ int main(void)
 #endif /* CONFIG_USB_DEVICE_STACK */
 #ifdef CONFIG_NET_LOOPBACK_SIMULATE_PACKET_DROP
 	loopback_set_packet_drop_ratio(1);
+#endif
+#if CONFIG_NET_SAMPLE_IDLE_SOCKETS > 0
+	open_idle_sockets();
 #endif
 	return 0;
 }
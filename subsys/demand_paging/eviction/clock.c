@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * CLOCK (second chance) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+#include <zephyr/kernel/mm/demand_paging.h>
+
+/* The page frames are arranged in a circle swept by a hand. A page frame
+ * under the hand which has been accessed since the last sweep gets a
+ * second chance: its accessed state is cleared and the hand moves on.
+ * The first page frame found not accessed is evicted, and the hand stops
+ * right after it.
+ *
+ * Unlike NRU there is no periodic timer: the accessed state is only
+ * sampled and cleared when a page frame needs to be evicted, and the
+ * position of the hand keeps the order in which pages were given their
+ * second chance.
+ */
+static size_t clock_hand;
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct z_page_frame *pf;
+	uintptr_t flags;
+
+	/* The first lap clears the accessed state of every page frame it
+	 * passes, so the second one always finds a victim.
+	 */
+	for (size_t i = 0; i < 2U * Z_NUM_PAGE_FRAMES; i++) {
+		pf = &z_page_frames[clock_hand];
+		clock_hand = (clock_hand + 1U) % Z_NUM_PAGE_FRAMES;
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		flags = arch_page_info_get(z_page_frame_to_virt(pf), NULL, true);
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+			/* Second chance */
+			continue;
+		}
+
+		*dirty_ptr = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+
+		return pf;
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(false, "no page to evict");
+
+	return NULL;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Aging LRU approximation eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+#include <zephyr/init.h>
+
+#include <zephyr/kernel/mm/demand_paging.h>
+
+/* Each page frame has an 8-bit age. A periodic timer shifts the ages
+ * right by one and sets the top bit of the page frames accessed since the
+ * previous period, clearing their accessed state. An age thus records
+ * the accesses over the last 8 periods, the most recent ones weighing
+ * the most, and the page frame with the lowest age is the least recently
+ * used one as far as the periods can tell.
+ *
+ * At eviction time, the accessed state of the current period counts as
+ * the top bit, and clean page frames are preferred over dirty ones of the
+ * same age since they do not need to be written to the backing store.
+ */
+#define AGE_ACCESSED	BIT(7)
+
+static uint8_t lru_ages[Z_NUM_PAGE_FRAMES];
+
+static void lru_periodic_update(struct k_timer *timer)
+{
+	uintptr_t phys;
+	struct z_page_frame *pf;
+	uintptr_t flags;
+	unsigned int key = irq_lock();
+
+	Z_PAGE_FRAME_FOREACH(phys, pf) {
+		uint8_t *age = &lru_ages[pf - z_page_frames];
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		/* Sample and clear accessed bit in page tables */
+		flags = arch_page_info_get(z_page_frame_to_virt(pf), NULL, true);
+		*age >>= 1;
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+			*age |= AGE_ACCESSED;
+		}
+	}
+
+	irq_unlock(key);
+}
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	unsigned int last_prec = BIT(10);
+	struct z_page_frame *last_pf = NULL, *pf;
+	bool last_dirty = false;
+	bool dirty;
+	uintptr_t flags, phys;
+
+	Z_PAGE_FRAME_FOREACH(phys, pf) {
+		unsigned int prec;
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		flags = arch_page_info_get(z_page_frame_to_virt(pf), NULL, false);
+		dirty = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		/* Current period above the age, dirty as the tie breaker */
+		prec = lru_ages[pf - z_page_frames] << 1;
+		prec |= ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) ? BIT(9) : 0U;
+		prec |= dirty ? 1U : 0U;
+
+		if (prec == 0U) {
+			/* Not used for 8 periods and clean: we're done */
+			last_pf = pf;
+			last_dirty = dirty;
+			break;
+		}
+
+		if (prec < last_prec) {
+			last_prec = prec;
+			last_pf = pf;
+			last_dirty = dirty;
+		}
+	}
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(last_pf != NULL, "no page to evict");
+
+	/* The page frame is about to hold a page being paged in: start its
+	 * history over as if it had just been accessed.
+	 */
+	if (last_pf != NULL) {
+		lru_ages[last_pf - z_page_frames] = AGE_ACCESSED;
+	}
+
+	*dirty_ptr = last_dirty;
+
+	return last_pf;
+}
+
+static K_TIMER_DEFINE(lru_timer, lru_periodic_update, NULL);
+
+void k_mem_paging_eviction_init(void)
+{
+	k_timer_start(&lru_timer, K_NO_WAIT,
+		      K_MSEC(CONFIG_EVICTION_LRU_AGING_PERIOD));
+}
@@ -59,11 +59,38 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #define NET_CONN_RANK(_flags)		(_flags & 0x78)
 
+/** Rank of a connection with all of its addresses and ports specified */
+#define NET_CONN_RANK_FULL		0x78
+
+#define CONN_HASH_SIZE			BIT(CONFIG_NET_CONN_HASH_BITS)
+#define CONN_HASH_MUL			0x9e3779b1U
+
 static struct net_conn conns[CONFIG_NET_MAX_CONN];
 
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
 
+/* Demultiplexing lists, linking each used connection once, so that the
+ * connections a received UDP or TCP packet can match are on at most
+ * three of them: connections with their whole address and port tuple
+ * specified are hashed on that tuple, other ones with a local port on
+ * that port, and the remaining ones (no local port, or not UDP/TCP over
+ * IP) are on the wildcard list.
+ */
+static sys_slist_t conn_tuple_hash[CONN_HASH_SIZE];
+static sys_slist_t conn_port_hash[CONN_HASH_SIZE];
+static sys_slist_t conn_wildcard;
+
+/* Candidate connections for a received packet */
+struct conn_iter {
+	sys_slist_t *lists[3];
+	sys_snode_t *node;
+	uint8_t count;
+	uint8_t idx;
+	/* Iterating over demultiplexing lists rather than conn_used */
+	bool demux;
+};
+
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
 void conn_register_debug(struct net_conn *conn,
@@ -116,6 +143,143 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+static inline uint32_t conn_hash_bucket(uint32_t hash)
+{
+	/* Fibonacci hashing, keeping the well mixed top bits */
+	return ((uint64_t)(uint32_t)(hash * CONN_HASH_MUL) <<
+		CONFIG_NET_CONN_HASH_BITS) >> 32;
+}
+
+/* Ports are in network byte order */
+static sys_slist_t *conn_port_list(uint16_t proto, uint16_t port)
+{
+	return &conn_port_hash[conn_hash_bucket(((uint32_t)proto << 16) | port)];
+}
+
+static sys_slist_t *conn_tuple_list(uint16_t proto,
+				    const uint8_t *remote, const uint8_t *local,
+				    size_t addr_len,
+				    uint16_t remote_port, uint16_t local_port)
+{
+	uint32_t hash = (((uint32_t)remote_port << 16) | local_port) ^ proto;
+
+	for (size_t i = 0; i < addr_len; i += sizeof(uint32_t)) {
+		hash = (hash ^ UNALIGNED_GET((const uint32_t *)&remote[i])) *
+		       CONN_HASH_MUL;
+		hash = (hash ^ UNALIGNED_GET((const uint32_t *)&local[i])) *
+		       CONN_HASH_MUL;
+	}
+
+	return &conn_tuple_hash[conn_hash_bucket(hash)];
+}
+
+/* Get the demultiplexing list of the connections with the given
+ * parameters, ports in network byte order.
+ */
+static sys_slist_t *conn_list_get(uint16_t proto, uint8_t family,
+				  const struct sockaddr *remote_addr,
+				  const struct sockaddr *local_addr,
+				  uint16_t remote_port, uint16_t local_port)
+{
+	if ((family != AF_INET && family != AF_INET6 && family != AF_UNSPEC) ||
+	    local_port == 0U) {
+		return &conn_wildcard;
+	}
+
+	if (remote_port == 0U || remote_addr == NULL || local_addr == NULL ||
+	    remote_addr->sa_family != local_addr->sa_family) {
+		return conn_port_list(proto, local_port);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && remote_addr->sa_family == AF_INET6) {
+		const struct in6_addr *remote = &net_sin6(remote_addr)->sin6_addr;
+		const struct in6_addr *local = &net_sin6(local_addr)->sin6_addr;
+
+		if (!net_ipv6_is_addr_unspecified(remote) &&
+		    !net_ipv6_is_addr_unspecified(local)) {
+			return conn_tuple_list(proto, remote->s6_addr,
+					       local->s6_addr,
+					       sizeof(struct in6_addr),
+					       remote_port, local_port);
+		}
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+		   remote_addr->sa_family == AF_INET) {
+		const struct in_addr *remote = &net_sin(remote_addr)->sin_addr;
+		const struct in_addr *local = &net_sin(local_addr)->sin_addr;
+
+		if (remote->s_addr != 0U && local->s_addr != 0U) {
+			return conn_tuple_list(proto, remote->s4_addr,
+					       local->s4_addr,
+					       sizeof(struct in_addr),
+					       remote_port, local_port);
+		}
+	}
+
+	return conn_port_list(proto, local_port);
+}
+
+static sys_slist_t *conn_demux_list(struct net_conn *conn)
+{
+	return conn_list_get(conn->proto, conn->family,
+			     (conn->flags & NET_CONN_REMOTE_ADDR_SET) ?
+				&conn->remote_addr : NULL,
+			     (conn->flags & NET_CONN_LOCAL_ADDR_SET) ?
+				&conn->local_addr : NULL,
+			     net_sin(&conn->remote_addr)->sin_port,
+			     net_sin(&conn->local_addr)->sin_port);
+}
+
+/* Get the lists of the connections a received UDP or TCP packet can
+ * match, ports in network byte order.
+ */
+static void conn_iter_init_ip(struct conn_iter *iter, uint8_t family,
+			      union net_ip_header *ip_hdr, uint8_t proto,
+			      uint16_t src_port, uint16_t dst_port)
+{
+	iter->demux = true;
+
+	if (dst_port != 0U) {
+		if (src_port == 0U) {
+			/* No connection with a whole tuple */
+		} else if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
+			iter->lists[iter->count++] =
+				conn_tuple_list(proto, ip_hdr->ipv6->src,
+						ip_hdr->ipv6->dst,
+						sizeof(struct in6_addr),
+						src_port, dst_port);
+		} else if (IS_ENABLED(CONFIG_NET_IPV4) && family == AF_INET) {
+			iter->lists[iter->count++] =
+				conn_tuple_list(proto, ip_hdr->ipv4->src,
+						ip_hdr->ipv4->dst,
+						sizeof(struct in_addr),
+						src_port, dst_port);
+		}
+
+		iter->lists[iter->count++] = conn_port_list(proto, dst_port);
+	}
+
+	iter->lists[iter->count++] = &conn_wildcard;
+}
+
+static struct net_conn *conn_iter_next(struct conn_iter *iter)
+{
+	if (iter->node != NULL) {
+		iter->node = sys_slist_peek_next(iter->node);
+	}
+
+	while (iter->node == NULL && iter->idx < iter->count) {
+		iter->node = sys_slist_peek_head(iter->lists[iter->idx++]);
+	}
+
+	if (iter->node == NULL) {
+		return NULL;
+	}
+
+	return iter->demux ?
+		CONTAINER_OF(iter->node, struct net_conn, demux_node) :
+		CONTAINER_OF(iter->node, struct net_conn, node);
+}
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -141,6 +305,7 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+	sys_slist_prepend(conn_demux_list(conn), &conn->demux_node);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -164,10 +329,15 @@ static struct net_conn *conn_find_handler(struct net_if *iface,
 {
 	struct net_conn *conn;
 	struct net_conn *tmp;
+	sys_slist_t *list;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&conn_used, conn, tmp, node) {
+	/* An identical handler has the same demultiplexing list */
+	list = conn_list_get(proto, family, remote_addr, local_addr,
+			     htons(remote_port), htons(local_port));
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(list, conn, tmp, demux_node) {
 		if (conn->proto != proto) {
 			continue;
 		}
@@ -452,6 +622,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+	sys_slist_find_and_remove(conn_demux_list(conn), &conn->demux_node);
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -476,10 +647,17 @@ int net_conn_update(struct net_conn_handle *handle,
 		return -ENOENT;
 	}
 
+	/* The connection moves to another list if its tuple changes */
+	k_mutex_lock(&conn_lock, K_FOREVER);
+	sys_slist_find_and_remove(conn_demux_list(conn), &conn->demux_node);
+
 	net_conn_change_callback(conn, cb, user_data);
 
 	ret = net_conn_change_remote(conn, remote_addr, remote_port);
 
+	sys_slist_prepend(conn_demux_list(conn), &conn->demux_node);
+	k_mutex_unlock(&conn_lock);
+
 	return ret;
 }
 
@@ -689,6 +867,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 	bool raw_pkt_delivered = false;
 	bool raw_pkt_continue = false;
 	struct net_conn *conn;
+	struct conn_iter iter = { 0 };
 	net_conn_cb_t cb = NULL;
 	void *user_data = NULL;
 
@@ -708,9 +887,18 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	}
 
+	if (IS_ENABLED(CONFIG_NET_IP) &&
+	    (pkt_family == AF_INET || pkt_family == AF_INET6)) {
+		conn_iter_init_ip(&iter, pkt_family, ip_hdr, proto,
+				  src_port, dst_port);
+	} else {
+		iter.lists[iter.count++] = &conn_used;
+	}
+
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
+	for (conn = conn_iter_next(&iter); conn != NULL;
+	     conn = conn_iter_next(&iter)) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (conn->context != NULL &&
 		    net_context_is_bound_to_iface(conn->context) &&
@@ -844,6 +1032,10 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 					best_rank = NET_CONN_RANK(conn->flags);
 					best_match = conn;
 
+					if (best_rank == NET_CONN_RANK_FULL) {
+						break; /* no other match can rank higher */
+					}
+
 					continue; /* found a match - but maybe not yet the best */
 				}
 
@@ -964,6 +1156,12 @@ void net_conn_init(void)
 
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
+	sys_slist_init(&conn_wildcard);
+
+	for (i = 0; i < CONN_HASH_SIZE; i++) {
+		sys_slist_init(&conn_tuple_hash[i]);
+		sys_slist_init(&conn_port_hash[i]);
+	}
 
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
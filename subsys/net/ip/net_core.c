@@ -60,7 +60,8 @@ LOG_MODULE_REGISTER(net_core, CONFIG_NET_CORE_LOG_LEVEL);
 #include "net_stats.h"
 
 static inline enum net_verdict process_data(struct net_pkt *pkt,
-					    bool is_loopback)
+					    bool is_loopback,
+					    struct net_tcp_gro *gro)
 {
 	int ret;
 	bool locally_routed = false;
@@ -129,6 +130,14 @@ static inline enum net_verdict process_data(struct net_pkt *pkt,
 			return ret;
 		}
 
+		/* Coalesce the TCP segments waiting in the RX queue */
+		if (IS_ENABLED(CONFIG_NET_TCP_GRO) && gro != NULL) {
+			ret = net_tcp_gro_receive(gro, pkt, is_loopback);
+			if (ret != NET_CONTINUE) {
+				return ret;
+			}
+		}
+
 		/* IP version and header length. */
 		uint8_t vtc_vhl = NET_IPV6_HDR(pkt)->vtc & 0xf0;
 
@@ -150,10 +159,11 @@ static inline enum net_verdict process_data(struct net_pkt *pkt,
 	return NET_DROP;
 }
 
-static void processing_data(struct net_pkt *pkt, bool is_loopback)
+static void processing_data(struct net_pkt *pkt, bool is_loopback,
+			    struct net_tcp_gro *gro)
 {
 again:
-	switch (process_data(pkt, is_loopback)) {
+	switch (process_data(pkt, is_loopback, gro)) {
 	case NET_CONTINUE:
 		if (IS_ENABLED(CONFIG_NET_L2_VIRTUAL)) {
 			/* If we have a tunneling packet, feed it back
@@ -407,7 +417,7 @@ int net_send_data(struct net_pkt *pkt)
 		 * to RX processing.
 		 */
 		NET_DBG("Loopback pkt %p back to us", pkt);
-		processing_data(pkt, true);
+		processing_data(pkt, true, NULL);
 		return 0;
 	}
 
@@ -429,7 +439,8 @@ int net_send_data(struct net_pkt *pkt)
 	return 0;
 }
 
-static void net_rx(struct net_if *iface, struct net_pkt *pkt)
+static void net_rx(struct net_if *iface, struct net_pkt *pkt,
+		   struct net_tcp_gro *gro)
 {
 	bool is_loopback = false;
 	size_t pkt_len;
@@ -448,19 +459,19 @@ static void net_rx(struct net_if *iface, struct net_pkt *pkt)
 #endif
 	}
 
-	processing_data(pkt, is_loopback);
+	processing_data(pkt, is_loopback, gro);
 
 	net_print_statistics();
 	net_pkt_print();
 }
 
-void net_process_rx_packet(struct net_pkt *pkt)
+void net_process_rx_packet(struct net_pkt *pkt, struct net_tcp_gro *gro)
 {
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
 
 	net_capture_pkt(net_pkt_iface(pkt), pkt);
 
-	net_rx(net_pkt_iface(pkt), pkt);
+	net_rx(net_pkt_iface(pkt), pkt, gro);
 }
 
 static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
@@ -479,7 +490,7 @@ static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
 #endif
 
 	if (NET_TC_RX_COUNT == 0) {
-		net_process_rx_packet(pkt);
+		net_process_rx_packet(pkt, NULL);
 	} else {
 		net_tc_submit_to_rx_queue(tc, pkt);
 	}
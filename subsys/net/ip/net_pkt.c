@@ -1879,6 +1879,7 @@ static void clone_pkt_attributes(struct net_pkt *pkt, struct net_pkt *clone_pkt)
 	net_pkt_set_l2_bridged(clone_pkt, net_pkt_is_l2_bridged(pkt));
 	net_pkt_set_l2_processed(clone_pkt, net_pkt_is_l2_processed(pkt));
 	net_pkt_set_ll_proto_type(clone_pkt, net_pkt_ll_proto_type(pkt));
+	net_pkt_set_gso_size(clone_pkt, net_pkt_gso_size(pkt));
 
 	if (pkt->buffer && clone_pkt->buffer) {
 		memcpy(net_pkt_lladdr_src(clone_pkt), net_pkt_lladdr_src(pkt),
@@ -1918,6 +1919,11 @@ static void clone_pkt_attributes(struct net_pkt *pkt, struct net_pkt *clone_pkt)
 	clone_pkt_cb(pkt, clone_pkt);
 }
 
+void net_pkt_copy_attributes(struct net_pkt *pkt, struct net_pkt *dst)
+{
+	clone_pkt_attributes(pkt, dst);
+}
+
 static struct net_pkt *net_pkt_clone_internal(struct net_pkt *pkt,
 					      struct k_mem_slab *slab,
 					      k_timeout_t timeout)
@@ -59,7 +59,9 @@ extern void net_if_init(void);
 extern void net_if_post_init(void);
 extern void net_if_stats_reset(struct net_if *iface);
 extern void net_if_stats_reset_all(void);
-extern void net_process_rx_packet(struct net_pkt *pkt);
+struct net_tcp_gro;
+
+extern void net_process_rx_packet(struct net_pkt *pkt, struct net_tcp_gro *gro);
 extern void net_process_tx_packet(struct net_pkt *pkt);
 
 extern int net_icmp_call_ipv4_handlers(struct net_pkt *pkt,
@@ -85,6 +87,7 @@ extern bool net_context_is_reuseport_set(struct net_context *context);
 extern bool net_context_is_v6only_set(struct net_context *context);
 extern bool net_context_is_recv_pktinfo_set(struct net_context *context);
 extern void net_pkt_init(void);
+extern void net_pkt_copy_attributes(struct net_pkt *pkt, struct net_pkt *dst);
 extern void net_tc_tx_init(void);
 extern void net_tc_rx_init(void);
 int net_context_get_local_addr(struct net_context *context,
@@ -595,6 +595,18 @@ static inline void net_stats_update_tc_rx_time_detail(struct net_if *iface,
 #endif /* CONFIG_NET_PKT_RXTIME_STATS_DETAIL */
 #endif /* NET_TC_COUNT > 1 */
 
+#if (NET_TC_RX_FLOW_COUNT > 1) && defined(CONFIG_NET_STATISTICS) \
+	&& defined(CONFIG_NET_NATIVE)
+static inline void net_stats_update_tc_rx_flow(struct net_if *iface,
+					       uint8_t queue, size_t bytes)
+{
+	UPDATE_STAT(iface, stats.rx_flow[queue].pkts++);
+	UPDATE_STAT(iface, stats.rx_flow[queue].bytes += bytes);
+}
+#else
+#define net_stats_update_tc_rx_flow(iface, queue, bytes)
+#endif /* NET_TC_RX_FLOW_COUNT > 1 */
+
 #if defined(CONFIG_NET_STATISTICS_POWER_MANAGEMENT)	\
 	&& defined(CONFIG_NET_STATISTICS) && defined(CONFIG_NET_NATIVE)
 static inline void net_stats_add_suspend_start_time(struct net_if *iface,
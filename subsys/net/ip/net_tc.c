@@ -9,14 +9,18 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 
 #include <zephyr/kernel.h>
 #include <string.h>
+#include <zephyr/sys/byteorder.h>
 
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_stats.h>
+#include <zephyr/net/ethernet.h>
 
 #include "net_private.h"
 #include "net_stats.h"
+#include "ipv4.h"
 #include "net_tc_mapping.h"
+#include "tcp_internal.h"
 
 /* Template for thread name. The "xx" is either "TX" denoting transmit thread,
  * or "RX" denoting receive thread. The "q[y]" denotes the traffic class queue
@@ -28,8 +32,17 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 K_KERNEL_STACK_ARRAY_DEFINE(tx_stack, NET_TC_TX_COUNT,
 			    CONFIG_NET_TX_STACK_SIZE);
 
+/* The best effort traffic class has NET_TC_RX_FLOW_COUNT RX queues, its
+ * own one and extra queues placed after the ones of the traffic classes.
+ */
+#if NET_TC_RX_COUNT > 0
+#define NET_TC_RX_QUEUE_COUNT (NET_TC_RX_COUNT + NET_TC_RX_FLOW_COUNT - 1)
+#else
+#define NET_TC_RX_QUEUE_COUNT 0
+#endif
+
 /* Stacks for RX work queue */
-K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_COUNT,
+K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_QUEUE_COUNT,
 			    CONFIG_NET_RX_STACK_SIZE);
 
 #if NET_TC_TX_COUNT > 0
@@ -37,7 +50,15 @@ static struct net_traffic_class tx_classes[NET_TC_TX_COUNT];
 #endif
 
 #if NET_TC_RX_COUNT > 0
-static struct net_traffic_class rx_classes[NET_TC_RX_COUNT];
+static struct net_traffic_class rx_classes[NET_TC_RX_QUEUE_COUNT];
+#endif
+
+#if NET_TC_RX_COUNT > 0 && defined(CONFIG_NET_TCP_GRO)
+/* Receive coalescing state of each RX queue */
+static struct net_tcp_gro rx_gro[NET_TC_RX_QUEUE_COUNT];
+#define RX_GRO(i) (&rx_gro[i])
+#else
+#define RX_GRO(i) NULL
 #endif
 
 #if NET_TC_RX_COUNT > 0 || NET_TC_TX_COUNT > 0
@@ -60,12 +81,145 @@ bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt)
 	return true;
 }
 
+#if NET_TC_RX_COUNT > 0 && NET_TC_RX_FLOW_COUNT > 1
+#define RX_FLOW_HASH_MUL 0x9e3779b1U
+
+static uint32_t rx_flow_hash_add(uint32_t hash, const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i < len; i += sizeof(uint32_t)) {
+		hash = (hash ^ UNALIGNED_GET((const uint32_t *)&data[i])) *
+		       RX_FLOW_HASH_MUL;
+	}
+
+	return hash;
+}
+
+/* Offset of the IP header in a packet whose L2 header has not been
+ * removed yet, negative if the packet does not carry IP.
+ */
+static int rx_flow_ip_offset(struct net_if *iface, const uint8_t *data,
+			     size_t len)
+{
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		const struct net_eth_hdr *hdr = (const struct net_eth_hdr *)data;
+		size_t offset = sizeof(struct net_eth_hdr);
+		uint16_t type;
+
+		if (len < offset) {
+			return -EINVAL;
+		}
+
+		type = sys_get_be16((const uint8_t *)&hdr->type);
+		if (type == NET_ETH_PTYPE_VLAN) {
+			const struct net_eth_vlan_hdr *vlan_hdr =
+				(const struct net_eth_vlan_hdr *)data;
+
+			offset = sizeof(struct net_eth_vlan_hdr);
+			if (len < offset) {
+				return -EINVAL;
+			}
+
+			type = sys_get_be16((const uint8_t *)&vlan_hdr->type);
+		}
+
+		if (type != NET_ETH_PTYPE_IP && type != NET_ETH_PTYPE_IPV6) {
+			return -EINVAL;
+		}
+
+		return offset;
+	}
+#endif
+
+#if defined(CONFIG_NET_L2_DUMMY)
+	/* Loopback and tunnels pass IP packets as they are */
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(DUMMY)) {
+		return 0;
+	}
+#endif
+
+	return -EINVAL;
+}
+
+/* Select the best effort RX queue of a packet from its addresses, protocol
+ * and ports. Only the headers in the first buffer are looked at, packets
+ * which cannot be classified go to the first queue.
+ */
+static uint8_t rx_flow_queue(struct net_pkt *pkt)
+{
+	const uint8_t *data = pkt->buffer->data;
+	size_t len = pkt->buffer->len;
+	size_t hdr_len;
+	uint32_t hash;
+	uint8_t proto;
+	int offset;
+
+	offset = rx_flow_ip_offset(net_pkt_iface(pkt), data, len);
+	if (offset < 0) {
+		return 0;
+	}
+
+	data += offset;
+	len -= offset;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && len >= sizeof(struct net_ipv4_hdr) &&
+	    (data[0] & 0xf0) == 0x40) {
+		const struct net_ipv4_hdr *hdr = (const struct net_ipv4_hdr *)data;
+
+		proto = hdr->proto;
+		hdr_len = (hdr->vhl & NET_IPV4_IHL_MASK) * 4U;
+		hash = rx_flow_hash_add(proto, hdr->src, 2 * sizeof(struct in_addr));
+
+		/* Only the first fragment has the ports, keep all of them
+		 * in the same queue for the reassembly.
+		 */
+		if (sys_get_be16(hdr->offset) &
+		    (NET_IPV4_MORE_FRAG_MASK | NET_IPV4_FRAGH_OFFSET_MASK)) {
+			proto = 0U;
+		}
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && len >= sizeof(struct net_ipv6_hdr) &&
+		   (data[0] & 0xf0) == 0x60) {
+		const struct net_ipv6_hdr *hdr = (const struct net_ipv6_hdr *)data;
+
+		/* Packets with extension headers are hashed on the addresses */
+		proto = hdr->nexthdr;
+		hdr_len = sizeof(struct net_ipv6_hdr);
+		hash = rx_flow_hash_add(proto, hdr->src, 2 * sizeof(struct in6_addr));
+	} else {
+		return 0;
+	}
+
+	/* Source and destination port */
+	if ((proto == IPPROTO_TCP || proto == IPPROTO_UDP) &&
+	    len >= hdr_len + sizeof(uint32_t)) {
+		hash = rx_flow_hash_add(hash, data + hdr_len, sizeof(uint32_t));
+	}
+
+	return ((uint64_t)hash * NET_TC_RX_FLOW_COUNT) >> 32;
+}
+#endif /* NET_TC_RX_COUNT > 0 && NET_TC_RX_FLOW_COUNT > 1 */
+
 void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 {
 #if NET_TC_RX_COUNT > 0
+	struct k_fifo *fifo = &rx_classes[tc].fifo;
+
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
 
-	submit_to_queue(&rx_classes[tc].fifo, pkt);
+#if NET_TC_RX_FLOW_COUNT > 1
+	if (tc == net_rx_priority2tc(NET_PRIORITY_BE)) {
+		uint8_t queue = rx_flow_queue(pkt);
+
+		net_stats_update_tc_rx_flow(net_pkt_iface(pkt), queue,
+					    net_pkt_get_len(pkt));
+
+		if (queue > 0) {
+			fifo = &rx_classes[NET_TC_RX_COUNT + queue - 1].fifo;
+		}
+	}
+#endif
+
+	submit_to_queue(fifo, pkt);
 #else
 	ARG_UNUSED(tc);
 	ARG_UNUSED(pkt);
@@ -242,19 +396,24 @@ static void net_tc_rx_stats_priority_setup(struct net_if *iface,
 #if NET_TC_RX_COUNT > 0
 static void tc_rx_handler(void *p1, void *p2, void *p3)
 {
-	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
 	struct k_fifo *fifo = p1;
+	struct net_tcp_gro *gro = p2;
 	struct net_pkt *pkt;
 
 	while (1) {
+		if (IS_ENABLED(CONFIG_NET_TCP_GRO) && k_fifo_is_empty(fifo)) {
+			/* Nothing left to coalesce with, pass it up */
+			net_tcp_gro_flush(gro);
+		}
+
 		pkt = k_fifo_get(fifo, K_FOREVER);
 		if (pkt == NULL) {
 			continue;
 		}
 
-		net_process_rx_packet(pkt);
+		net_process_rx_packet(pkt, gro);
 	}
 }
 #endif
@@ -354,12 +513,23 @@ void net_tc_rx_init(void)
 	net_if_foreach(net_tc_rx_stats_priority_setup, NULL);
 #endif
 
-	for (i = 0; i < NET_TC_RX_COUNT; i++) {
+	for (i = 0; i < NET_TC_RX_QUEUE_COUNT; i++) {
 		uint8_t thread_priority;
+		int flow = -1;
 		int priority;
 		k_tid_t tid;
+		int tc = i;
+
+		/* Index of the queue within the best effort traffic class */
+		if (i >= NET_TC_RX_COUNT) {
+			tc = net_rx_priority2tc(NET_PRIORITY_BE);
+			flow = i - NET_TC_RX_COUNT + 1;
+		} else if (NET_TC_RX_FLOW_COUNT > 1 &&
+			   i == net_rx_priority2tc(NET_PRIORITY_BE)) {
+			flow = 0;
+		}
 
-		thread_priority = rx_tc2thread(i);
+		thread_priority = rx_tc2thread(tc);
 
 		priority = IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE) ?
 			K_PRIO_COOP(thread_priority) :
@@ -379,7 +549,7 @@ void net_tc_rx_init(void)
 		tid = k_thread_create(&rx_classes[i].handler, rx_stack[i],
 				      K_KERNEL_STACK_SIZEOF(rx_stack[i]),
 				      tc_rx_handler,
-				      &rx_classes[i].fifo, NULL, NULL,
+				      &rx_classes[i].fifo, RX_GRO(i), NULL,
 				      priority, 0, K_FOREVER);
 		if (!tid) {
 			NET_ERR("Cannot create TC handler thread %d", i);
@@ -389,10 +559,21 @@ void net_tc_rx_init(void)
 		if (IS_ENABLED(CONFIG_THREAD_NAME)) {
 			char name[MAX_NAME_LEN];
 
-			snprintk(name, sizeof(name), "rx_q[%d]", i);
+			if (flow > 0) {
+				snprintk(name, sizeof(name), "rx_f[%d]", flow);
+			} else {
+				snprintk(name, sizeof(name), "rx_q[%d]", i);
+			}
+
 			k_thread_name_set(tid, name);
 		}
 
+#if defined(CONFIG_NET_TC_RX_FLOW_CPU_PIN)
+		if (flow >= 0) {
+			(void)k_thread_cpu_pin(tid, flow % arch_num_cpus());
+		}
+#endif
+
 		k_thread_start(tid);
 	}
 #endif
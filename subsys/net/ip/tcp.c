@@ -64,10 +64,6 @@ static int tcp_tx_window =
 #define TCP_RTO_MS (tcp_rto)
 #endif
 
-/* Define the number of MSS sections the congestion window is initialized at */
-#define TCP_CONGESTION_INITIAL_WIN 1
-#define TCP_CONGESTION_INITIAL_SSTHRESH 3
-
 static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
 static K_MUTEX_DEFINE(tcp_lock);
@@ -513,30 +509,138 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 	tcp_new_reno_log(conn, "pkts_acked");
 }
 
+const struct tcp_ca_ops tcp_ca_new_reno = {
+	.name = "reno",
+	.init = tcp_new_reno_init,
+	.fast_retransmit = tcp_new_reno_fast_retransmit,
+	.timeout = tcp_new_reno_timeout,
+	.dup_ack = tcp_new_reno_dup_ack,
+	.pkts_acked = tcp_new_reno_pkts_acked,
+};
+
+static const struct tcp_ca_ops *const tcp_ca_algorithms[] = {
+	&tcp_ca_new_reno,
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+	&tcp_ca_cubic,
+#endif
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+	&tcp_ca_bbr,
+#endif
+};
+
+#if defined(CONFIG_NET_TCP_CONGESTION_DEFAULT_CUBIC)
+#define TCP_CA_DEFAULT (&tcp_ca_cubic)
+#elif defined(CONFIG_NET_TCP_CONGESTION_DEFAULT_BBR)
+#define TCP_CA_DEFAULT (&tcp_ca_bbr)
+#else
+#define TCP_CA_DEFAULT (&tcp_ca_new_reno)
+#endif
+
+static const struct tcp_ca_ops *tcp_ca_find(const char *name, size_t len)
+{
+	len = strnlen(name, MIN(len, TCP_CA_NAME_MAX));
+
+	ARRAY_FOR_EACH(tcp_ca_algorithms, i) {
+		if (strlen(tcp_ca_algorithms[i]->name) == len &&
+		    strncmp(tcp_ca_algorithms[i]->name, name, len) == 0) {
+			return tcp_ca_algorithms[i];
+		}
+	}
+
+	return NULL;
+}
+
 static void tcp_ca_init(struct tcp *conn)
 {
-	tcp_new_reno_init(conn);
+	conn->ca_rtt_pending = false;
+	conn->ca_ops->init(conn);
 }
 
 static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
-	tcp_new_reno_fast_retransmit(conn);
+	/* Karn's algorithm, the ACK of a retransmitted segment is ambiguous */
+	conn->ca_rtt_pending = false;
+	conn->ca_ops->fast_retransmit(conn);
 }
 
 static void tcp_ca_timeout(struct tcp *conn)
 {
-	tcp_new_reno_timeout(conn);
+	conn->ca_rtt_pending = false;
+	conn->ca_ops->timeout(conn);
 }
 
 static void tcp_ca_dup_ack(struct tcp *conn)
 {
-	tcp_new_reno_dup_ack(conn);
+	conn->ca_ops->dup_ack(conn);
 }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	if (conn->ca_rtt_pending &&
+	    !net_tcp_seq_greater(conn->ca_rtt_seq, conn->seq + acked_len)) {
+		conn->ca_rtt_pending = false;
+
+		if (conn->ca_ops->rtt_sample != NULL) {
+			conn->ca_ops->rtt_sample(conn,
+						 tcp_ca_now_us() - conn->ca_rtt_start);
+		}
+	}
+
+	conn->ca_ops->pkts_acked(conn, acked_len);
+}
+
+/* Time a segment of new data, one at a time */
+static void tcp_ca_data_sent(struct tcp *conn, uint32_t seq, size_t len)
+{
+	if (conn->ca_rtt_pending || conn->data_mode != TCP_DATA_MODE_SEND) {
+		return;
+	}
+
+	conn->ca_rtt_seq = seq + len;
+	conn->ca_rtt_start = tcp_ca_now_us();
+	conn->ca_rtt_pending = true;
+}
+
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
+{
+	const struct tcp_ca_ops *ops;
+
+	ops = tcp_ca_find(value, len);
+	if (ops == NULL) {
+		return -ENOENT;
+	}
+
+	if (ops == conn->ca_ops) {
+		return 0;
+	}
+
+	conn->ca_ops = ops;
+
+	/* An established connection switches over right away, starting
+	 * from the initial state of the algorithm.
+	 */
+	if (conn->state == TCP_ESTABLISHED || conn->state == TCP_CLOSE_WAIT) {
+		tcp_ca_init(conn);
+	}
+
+	return 0;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
+{
+	size_t name_len = strlen(conn->ca_ops->name) + 1;
+
+	if (len == NULL) {
+		return -EINVAL;
+	}
+
+	/* Truncated if the buffer is too small, as Linux does */
+	*len = MIN(*len, name_len);
+	memcpy(value, conn->ca_ops->name, *len);
+
+	return 0;
 }
+
 #else
 
 static void tcp_ca_init(struct tcp *conn) { }
@@ -549,7 +653,449 @@ static void tcp_ca_dup_ack(struct tcp *conn) { }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len) { }
 
+static void tcp_ca_data_sent(struct tcp *conn, uint32_t seq, size_t len) { }
+
+#define set_tcp_congestion(...) (-ENOPROTOOPT)
+#define get_tcp_congestion(...) (-ENOPROTOOPT)
+
+#endif
+
+/* SACK options of an outgoing segment */
+struct tcp_sack_opts {
+	struct tcp_sack_block blocks[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t count;
+	bool perm;
+};
+
+#ifdef CONFIG_NET_TCP_SACK
+
+/* Implementation according to RFC2018 and RFC6675. The data sent and not
+ * cumulatively acknowledged is tracked segment by segment in a ring, the
+ * scoreboard, in which the SACK blocks received mark the segments the peer
+ * already has.
+ */
+
+#define tcp_seg_get(_conn, _i)						\
+	(&(_conn)->sack.segs[((_conn)->sack.first + (_i)) %		\
+			     CONFIG_NET_TCP_SACK_SEGMENTS])
+
+#define tcp_seg_end(_seg) ((_seg)->seq + (_seg)->len)
+
+static bool tcp_sack_ok(struct tcp *conn)
+{
+	return conn->recv_options.sack_perm_found;
+}
+
+static bool tcp_sack_in_recovery(struct tcp *conn)
+{
+	return conn->sack.in_recovery;
+}
+
+#ifdef CONFIG_NET_TCP_RACK
+
+/* Implementation according to RFC8985 */
+
+#define TCP_RACK_MIN_PTO_MS 10
+/* Worst case delay of the ACK of a single segment by the peer */
+#define TCP_RACK_WC_DEL_ACK_MS 200
+
+static bool tcp_rack_sent_after(uint32_t t1, uint32_t end1,
+				uint32_t t2, uint32_t end2)
+{
+	return ((int32_t)(t1 - t2) > 0) ||
+	       ((t1 == t2) && net_tcp_seq_greater(end1, end2));
+}
+
+static void tcp_rack_update(struct tcp *conn, struct tcp_seg *seg, uint32_t now)
+{
+	struct tcp_sack *sack = &conn->sack;
+	uint32_t rtt = now - seg->sent;
+
+	if (seg->flags & TCP_SEG_RETRANS) {
+		/* The ACK could be for the original transmission, do not
+		 * take it into account if it came back too early to be for
+		 * the retransmission.
+		 */
+		if (sack->rtt_valid && rtt < sack->min_rtt) {
+			return;
+		}
+	} else if (!sack->rtt_valid) {
+		sack->min_rtt = rtt;
+		sack->srtt = rtt;
+		sack->rtt_valid = true;
+	} else {
+		sack->min_rtt = MIN(sack->min_rtt, rtt);
+		sack->srtt = (7U * sack->srtt + rtt) / 8U;
+	}
+
+	if (!sack->rack_valid ||
+	    tcp_rack_sent_after(seg->sent, tcp_seg_end(seg),
+				sack->rack_sent, sack->rack_end)) {
+		sack->rack_sent = seg->sent;
+		sack->rack_end = tcp_seg_end(seg);
+		sack->rack_rtt = rtt;
+		sack->rack_valid = true;
+	}
+}
+
+/* Mark the segments sent before the latest one delivered as lost, once they
+ * have been given a reordering window to be delivered too. Returns the time
+ * in ms after which the others should be checked again, 0 if there is none.
+ */
+static uint32_t tcp_rack_detect_loss(struct tcp *conn, uint32_t now)
+{
+	struct tcp_sack *sack = &conn->sack;
+	uint32_t reo_wnd = MIN(sack->min_rtt / 4U, sack->srtt);
+	uint32_t timeout = 0U;
+
+	if (!sack->rack_valid) {
+		return 0U;
+	}
+
+	for (int i = 0; i < sack->count; i++) {
+		struct tcp_seg *seg = tcp_seg_get(conn, i);
+		int32_t remaining;
+
+		if ((seg->flags & (TCP_SEG_SACKED | TCP_SEG_LOST)) ||
+		    !tcp_rack_sent_after(sack->rack_sent, sack->rack_end,
+					 seg->sent, tcp_seg_end(seg))) {
+			continue;
+		}
+
+		remaining = (int32_t)(seg->sent + sack->rack_rtt + reo_wnd - now);
+		if (remaining <= 0) {
+			seg->flags |= TCP_SEG_LOST;
+		} else {
+			timeout = MAX(timeout, (uint32_t)remaining);
+		}
+	}
+
+	return timeout;
+}
+
+/* Arm the reordering timer if segments could be lost in timeout ms, or
+ * else the tail loss probe timer.
+ */
+static void tcp_rack_timer_update(struct tcp *conn, uint32_t timeout)
+{
+	struct tcp_sack *sack = &conn->sack;
+	uint32_t pto;
+
+	sack->reo_timeout = (timeout > 0U);
+	if (sack->reo_timeout) {
+		k_work_reschedule_for_queue(&tcp_work_q, &conn->rack_timer,
+					    K_MSEC(timeout));
+		return;
+	}
+
+	if (sack->in_recovery || sack->tlp_sent || !sack->rtt_valid ||
+	    sack->count == 0U) {
+		(void)k_work_cancel_delayable(&conn->rack_timer);
+		return;
+	}
+
+	pto = 2U * sack->srtt;
+	if (sack->count == 1U) {
+		pto += TCP_RACK_WC_DEL_ACK_MS;
+	}
+
+	pto = CLAMP(pto, TCP_RACK_MIN_PTO_MS, TCP_RTO_MS);
+
+	k_work_reschedule_for_queue(&tcp_work_q, &conn->rack_timer,
+				    K_MSEC(pto));
+}
+
+static void tcp_rack_data_sent(struct tcp *conn)
+{
+	/* The reordering timer, if armed, takes precedence over the tail
+	 * loss probe
+	 */
+	if (!conn->sack.reo_timeout) {
+		tcp_rack_timer_update(conn, 0U);
+	}
+}
+
+#else
+
+static void tcp_rack_update(struct tcp *conn, struct tcp_seg *seg, uint32_t now) { }
+
+static uint32_t tcp_rack_detect_loss(struct tcp *conn, uint32_t now) { return 0U; }
+
+static void tcp_rack_timer_update(struct tcp *conn, uint32_t timeout) { }
+
+static void tcp_rack_data_sent(struct tcp *conn) { }
+
+#endif /* CONFIG_NET_TCP_RACK */
+
+static void tcp_sack_reset(struct tcp *conn)
+{
+	conn->sack.count = 0U;
+	conn->sack.in_recovery = false;
+#ifdef CONFIG_NET_TCP_RACK
+	conn->sack.reo_timeout = false;
+	conn->sack.tlp_sent = false;
+	(void)k_work_cancel_delayable(&conn->rack_timer);
+#endif
+}
+
+/* Record the data sent from seq, either new or retransmitted */
+static void tcp_sack_sent(struct tcp *conn, uint32_t seq, size_t len)
+{
+	struct tcp_sack *sack = &conn->sack;
+	uint32_t now = k_uptime_get_32();
+	struct tcp_seg *seg = NULL;
+
+	if (!tcp_sack_ok(conn)) {
+		return;
+	}
+
+	if (sack->count > 0U) {
+		seg = tcp_seg_get(conn, sack->count - 1U);
+
+		if (net_tcp_seq_cmp(seq, tcp_seg_end(seg)) < 0) {
+			for (int i = 0; i < sack->count; i++) {
+				seg = tcp_seg_get(conn, i);
+
+				if (net_tcp_seq_cmp(seg->seq, seq + len) < 0 &&
+				    net_tcp_seq_greater(tcp_seg_end(seg), seq)) {
+					seg->sent = now;
+					seg->flags |= TCP_SEG_RETRANS;
+					seg->flags &= ~TCP_SEG_LOST;
+				}
+			}
+
+			return;
+		}
+	}
+
+	if (sack->count < CONFIG_NET_TCP_SACK_SEGMENTS) {
+		seg = tcp_seg_get(conn, sack->count);
+		sack->count++;
+
+		seg->seq = seq;
+		seg->len = len;
+		seg->flags = 0U;
+	} else if (seg->flags == 0U && tcp_seg_end(seg) == seq &&
+		   seg->len + len <= UINT16_MAX) {
+		seg->len += len;
+	} else {
+		/* Not tracked, only recovered by the retransmission timer */
+		return;
+	}
+
+	seg->sent = now;
+
+	tcp_rack_data_sent(conn);
+}
+
+/* Drop the segments cumulatively acknowledged from the scoreboard */
+static void tcp_sack_acked(struct tcp *conn, uint32_t ack, uint32_t now)
+{
+	struct tcp_sack *sack = &conn->sack;
+
+	while (sack->count > 0U) {
+		struct tcp_seg *seg = tcp_seg_get(conn, 0);
+
+		if (net_tcp_seq_greater(tcp_seg_end(seg), ack)) {
+			if (net_tcp_seq_greater(ack, seg->seq)) {
+				seg->len -= ack - seg->seq;
+				seg->seq = ack;
+			}
+
+			break;
+		}
+
+		if (!(seg->flags & TCP_SEG_SACKED)) {
+			tcp_rack_update(conn, seg, now);
+		}
+
+		sack->first = (sack->first + 1U) % CONFIG_NET_TCP_SACK_SEGMENTS;
+		sack->count--;
+	}
+
+	if (sack->in_recovery &&
+	    !net_tcp_seq_greater(sack->recovery_point, ack)) {
+		NET_DBG("conn: %p recovery done", conn);
+		sack->in_recovery = false;
+	}
+
+#ifdef CONFIG_NET_TCP_RACK
+	/* A new flight can be probed */
+	sack->tlp_sent = false;
 #endif
+}
+
+/* Mark the segments covered by the SACK blocks received */
+static void tcp_sack_blocks_received(struct tcp *conn, uint32_t now)
+{
+	struct tcp_options *options = &conn->recv_options;
+
+	for (int i = 0; i < options->sack_blocks; i++) {
+		struct tcp_sack_block *block = &options->sack[i];
+
+		for (int j = 0; j < conn->sack.count; j++) {
+			struct tcp_seg *seg = tcp_seg_get(conn, j);
+
+			if ((seg->flags & TCP_SEG_SACKED) ||
+			    net_tcp_seq_greater(block->left, seg->seq) ||
+			    net_tcp_seq_greater(tcp_seg_end(seg), block->right)) {
+				continue;
+			}
+
+			seg->flags |= TCP_SEG_SACKED;
+			seg->flags &= ~TCP_SEG_LOST;
+			tcp_rack_update(conn, seg, now);
+		}
+	}
+}
+
+/* A segment is deemed lost when enough segments sent after it were SACKed
+ * to rule out reordering, as in the IsLost() function of RFC6675.
+ * Retransmitted segments are only deemed lost again by RACK, or by the
+ * retransmission timer.
+ */
+static void tcp_sack_mark_lost(struct tcp *conn)
+{
+	int sacked = 0;
+
+	for (int i = conn->sack.count - 1; i >= 0; i--) {
+		struct tcp_seg *seg = tcp_seg_get(conn, i);
+
+		if (seg->flags & TCP_SEG_SACKED) {
+			sacked++;
+		} else if (sacked >= DUPLICATE_ACK_RETRANSMIT_TRHESHOLD &&
+			   !(seg->flags & TCP_SEG_RETRANS)) {
+			seg->flags |= TCP_SEG_LOST;
+		}
+	}
+}
+
+/* Describe the out-of-order data queued in SACK blocks, the block with the
+ * data received last being the first one.
+ */
+static uint8_t tcp_sack_blocks_get(struct tcp *conn,
+				   struct tcp_sack_block *blocks)
+{
+	struct tcp_sack_block block;
+	struct net_buf *buf;
+	uint8_t count = 0U;
+
+	if (!CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT ||
+	    net_pkt_is_empty(conn->queue_recv_data)) {
+		return 0U;
+	}
+
+	for (buf = conn->queue_recv_data->buffer; buf; buf = buf->frags) {
+		uint32_t seq = tcp_get_seq(buf);
+
+		if (count > 0U && blocks[count - 1U].right == seq) {
+			blocks[count - 1U].right += buf->len;
+			continue;
+		}
+
+		if (count == NET_TCP_SACK_MAX_BLOCKS) {
+			break;
+		}
+
+		blocks[count].left = seq;
+		blocks[count].right = seq + buf->len;
+		count++;
+	}
+
+	for (int i = 1; i < count; i++) {
+		if (!net_tcp_seq_greater(blocks[i].left, conn->sack.recv_seq) &&
+		    net_tcp_seq_greater(blocks[i].right, conn->sack.recv_seq)) {
+			block = blocks[i];
+			memmove(&blocks[1], &blocks[0], i * sizeof(block));
+			blocks[0] = block;
+			break;
+		}
+	}
+
+	return count;
+}
+
+/* Returns the length of the SACK options to send with the segment */
+static size_t tcp_sack_opts_get(struct tcp *conn, uint8_t flags,
+				struct tcp_sack_opts *opts)
+{
+	/* Offer SACK in a SYN, accept it in a SYN-ACK if it was offered */
+	opts->perm = (flags & SYN) && (!(flags & ACK) || tcp_sack_ok(conn));
+	opts->count = 0U;
+
+	if (opts->perm) {
+		return 2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_PERM_SIZE;
+	}
+
+	if (!(flags & ACK) || (flags & RST) || !tcp_sack_ok(conn)) {
+		return 0;
+	}
+
+	opts->count = tcp_sack_blocks_get(conn, opts->blocks);
+	if (opts->count == 0U) {
+		return 0;
+	}
+
+	return 2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_SIZE +
+	       opts->count * NET_TCP_SACK_BLOCK_SIZE;
+}
+
+static int tcp_sack_opts_set(struct net_pkt *pkt, struct tcp_sack_opts *opts)
+{
+	uint8_t buf[2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_SIZE +
+		    NET_TCP_SACK_MAX_BLOCKS * NET_TCP_SACK_BLOCK_SIZE];
+	uint8_t *ptr = buf;
+
+	if (!opts->perm && opts->count == 0U) {
+		return 0;
+	}
+
+	/* Keep the options 4 bytes aligned, as most implementations do */
+	*ptr++ = NET_TCP_NOP_OPT;
+	*ptr++ = NET_TCP_NOP_OPT;
+
+	if (opts->perm) {
+		*ptr++ = NET_TCP_SACK_PERM_OPT;
+		*ptr++ = NET_TCP_SACK_PERM_SIZE;
+	} else {
+		*ptr++ = NET_TCP_SACK_OPT;
+		*ptr++ = NET_TCP_SACK_SIZE +
+			 opts->count * NET_TCP_SACK_BLOCK_SIZE;
+
+		for (int i = 0; i < opts->count; i++) {
+			UNALIGNED_PUT(htonl(opts->blocks[i].left),
+				      (uint32_t *)ptr);
+			UNALIGNED_PUT(htonl(opts->blocks[i].right),
+				      (uint32_t *)(ptr + sizeof(uint32_t)));
+			ptr += NET_TCP_SACK_BLOCK_SIZE;
+		}
+	}
+
+	return net_pkt_write(pkt, buf, ptr - buf);
+}
+
+#else
+
+static bool tcp_sack_ok(struct tcp *conn) { return false; }
+
+static bool tcp_sack_in_recovery(struct tcp *conn) { return false; }
+
+static void tcp_sack_reset(struct tcp *conn) { }
+
+static void tcp_sack_sent(struct tcp *conn, uint32_t seq, size_t len) { }
+
+static size_t tcp_sack_opts_get(struct tcp *conn, uint8_t flags,
+				struct tcp_sack_opts *opts)
+{
+	return 0;
+}
+
+static int tcp_sack_opts_set(struct net_pkt *pkt, struct tcp_sack_opts *opts)
+{
+	return 0;
+}
+
+#endif /* CONFIG_NET_TCP_SACK */
 
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
 
@@ -804,6 +1350,9 @@ static void tcp_conn_release(struct k_work *work)
 	(void)k_work_cancel_delayable(&conn->ack_timer);
 	(void)k_work_cancel_delayable(&conn->send_timer);
 	(void)k_work_cancel_delayable(&conn->recv_queue_timer);
+#if defined(CONFIG_NET_TCP_RACK)
+	(void)k_work_cancel_delayable(&conn->rack_timer);
+#endif
 	keep_alive_timer_stop(conn);
 
 	k_mutex_unlock(&conn->lock);
@@ -1094,7 +1643,7 @@ static uint8_t *tcp_options_get(struct net_pkt *pkt, int tcp_options_len,
 }
 
 static bool tcp_options_check(struct tcp_options *recv_options,
-			      struct net_pkt *pkt, ssize_t len)
+			      struct net_pkt *pkt, ssize_t len, uint8_t flags)
 {
 	uint8_t options_buf[40]; /* TCP header max options size is 40 */
 	bool result = len > 0 && ((len % 4) == 0) ? true : false;
@@ -1104,8 +1653,16 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	NET_DBG("len=%zd", len);
 
-	recv_options->mss_found = false;
-	recv_options->wnd_found = false;
+	/* The options negotiated in the SYN segments stay valid for the
+	 * whole connection, as later segments can carry other options.
+	 */
+	if (flags & SYN) {
+		recv_options->mss_found = false;
+		recv_options->wnd_found = false;
+#ifdef CONFIG_NET_TCP_SACK
+		recv_options->sack_perm_found = false;
+#endif
+	}
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1140,6 +1697,11 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
+			/* Only valid in SYN segments, see RFC9293 */
+			if (!(flags & SYN)) {
+				break;
+			}
+
 			recv_options->mss =
 				ntohs(UNALIGNED_GET((uint16_t *)(options + 2)));
 			recv_options->mss_found = true;
@@ -1151,9 +1713,46 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
+			/* Only valid in SYN segments, see RFC7323 */
+			if (!(flags & SYN)) {
+				break;
+			}
+
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+#ifdef CONFIG_NET_TCP_SACK
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = (flags & SYN) != 0;
+			break;
+		case NET_TCP_SACK_OPT:
+			if ((opt_len - NET_TCP_SACK_SIZE) % NET_TCP_SACK_BLOCK_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_blocks =
+				MIN((opt_len - NET_TCP_SACK_SIZE) / NET_TCP_SACK_BLOCK_SIZE,
+				    NET_TCP_SACK_MAX_BLOCKS);
+
+			for (int i = 0; i < recv_options->sack_blocks; i++) {
+				uint8_t *block = options + NET_TCP_SACK_SIZE +
+						 i * NET_TCP_SACK_BLOCK_SIZE;
+
+				recv_options->sack[i].left =
+					ntohl(UNALIGNED_GET((uint32_t *)block));
+				recv_options->sack[i].right =
+					ntohl(UNALIGNED_GET((uint32_t *)(block + 4)));
+			}
+
+			NET_DBG("SACK blocks=%hu", (uint16_t)recv_options->sack_blocks);
+			break;
+#endif /* CONFIG_NET_TCP_SACK */
 		default:
 			continue;
 		}
@@ -1328,7 +1927,7 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 }
 
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
-			  uint32_t seq)
+			  uint32_t seq, size_t opts_len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
@@ -1342,11 +1941,7 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, &th->th_sport);
 	UNALIGNED_PUT(conn->dst.sin.sin_port, &th->th_dport);
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + opts_len / 4;
 
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
@@ -1530,15 +2125,18 @@ err:
 static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
-	size_t alloc_len = sizeof(struct tcphdr);
+	struct tcp_sack_opts sack_opts;
+	size_t opts_len = 0;
 	struct net_pkt *pkt;
 	int ret = 0;
 
 	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
+		opts_len += sizeof(uint32_t);
 	}
 
-	pkt = tcp_pkt_alloc(conn, alloc_len);
+	opts_len += tcp_sack_opts_get(conn, flags, &sack_opts);
+
+	pkt = tcp_pkt_alloc(conn, sizeof(struct tcphdr) + opts_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
 		goto out;
@@ -1548,6 +2146,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
 		data->buffer = NULL;
+		net_pkt_set_gso_size(pkt, net_pkt_gso_size(data));
 	}
 
 	ret = ip_header_add(conn, pkt);
@@ -1556,7 +2155,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
-	ret = tcp_header_add(conn, pkt, flags, seq);
+	ret = tcp_header_add(conn, pkt, flags, seq, opts_len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
@@ -1570,6 +2169,12 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	ret = tcp_sack_opts_set(pkt, &sack_opts);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		goto out;
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1721,13 +2326,35 @@ static int tcp_unsent_len(struct tcp *conn)
 	return unsent_len;
 }
 
+/* Data that fits in a segment along with the SACK options sent with it */
+static int tcp_data_mss(struct tcp *conn)
+{
+	struct tcp_sack_opts sack_opts;
+
+	return conn_mss(conn) - tcp_sack_opts_get(conn, PSH | ACK, &sack_opts);
+}
+
+/* Up to this much data is sent at once, segmented by the L2 if needed */
+static int tcp_gso_max_len(struct tcp *conn, int mss)
+{
+#if defined(CONFIG_NET_TCP_GSO)
+	if (net_if_l2(conn->iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		return MIN(mss * CONFIG_NET_TCP_GSO_MAX_SEGS,
+			   UINT16_MAX - NET_TCP_GRO_HDR_MAX);
+	}
+#endif
+
+	return mss;
+}
+
 static int tcp_send_data(struct tcp *conn)
 {
+	int mss = tcp_data_mss(conn);
 	int ret = 0;
 	int len;
 	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+	len = MIN(tcp_unsent_len(conn), tcp_gso_max_len(conn, mss));
 	if (len < 0) {
 		ret = len;
 		goto out;
@@ -1738,7 +2365,21 @@ static int tcp_send_data(struct tcp *conn)
 		goto out;
 	}
 
-	pkt = tcp_pkt_alloc(conn, len);
+	if (len > mss) {
+		/* Not limited to the MTU, the segments are made by the L2 */
+		pkt = tcp_pkt_alloc(conn, 0);
+		if (pkt && net_pkt_alloc_buffer_raw(pkt, len, TCP_PKT_ALLOC_TIMEOUT) < 0) {
+			tcp_pkt_unref(pkt);
+			pkt = NULL;
+		}
+
+		if (pkt) {
+			net_pkt_set_gso_size(pkt, mss);
+		}
+	} else {
+		pkt = tcp_pkt_alloc(conn, len);
+	}
+
 	if (!pkt) {
 		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
 		ret = -ENOBUFS;
@@ -1754,6 +2395,8 @@ static int tcp_send_data(struct tcp *conn)
 
 	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
 	if (ret == 0) {
+		tcp_sack_sent(conn, conn->seq + conn->unacked_len, len);
+		tcp_ca_data_sent(conn, conn->seq + conn->unacked_len, len);
 		conn->unacked_len += len;
 
 		if (conn->data_mode == TCP_DATA_MODE_RESEND) {
@@ -1868,6 +2511,11 @@ static void tcp_resend_data(struct k_work *work)
 		}
 	}
 
+	/* The peer may have discarded the data it selectively acknowledged,
+	 * so forget about it as recommended by RFC2018.
+	 */
+	tcp_sack_reset(conn);
+
 	conn->data_mode = TCP_DATA_MODE_RESEND;
 	conn->unacked_len = 0;
 
@@ -1922,6 +2570,163 @@ static void tcp_resend_data(struct k_work *work)
 	}
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+
+/* Retransmit a segment of the scoreboard, which is larger than the MSS
+ * if data was merged into it.
+ */
+static int tcp_sack_send_seg(struct tcp *conn, struct tcp_seg *seg)
+{
+	size_t pos = 0;
+	int ret = 0;
+
+	while (pos < seg->len) {
+		size_t len = MIN(seg->len - pos, tcp_data_mss(conn));
+		struct net_pkt *pkt;
+
+		pkt = tcp_pkt_alloc(conn, len);
+		if (!pkt) {
+			ret = -ENOBUFS;
+			break;
+		}
+
+		ret = tcp_pkt_peek(pkt, conn->send_data,
+				   seg->seq - conn->seq + pos, len);
+		if (ret == 0) {
+			ret = tcp_out_ext(conn, PSH | ACK, pkt, seg->seq + pos);
+		}
+
+		/* The data is in the send queue, if it was sent */
+		tcp_pkt_unref(pkt);
+
+		if (ret < 0) {
+			break;
+		}
+
+		net_stats_update_tcp_resent(conn->iface, len);
+		net_stats_update_tcp_seg_rexmit(conn->iface);
+		pos += len;
+	}
+
+	if (pos > 0) {
+		seg->sent = k_uptime_get_32();
+		seg->flags |= TCP_SEG_RETRANS;
+		seg->flags &= ~TCP_SEG_LOST;
+	}
+
+	return ret;
+}
+
+/* Retransmit the first segment deemed lost, entering loss recovery if not
+ * done yet. A segment is retransmitted per ACK received, as new data is.
+ */
+static void tcp_sack_retransmit(struct tcp *conn)
+{
+	struct tcp_sack *sack = &conn->sack;
+
+	/* Going back to the first unacknowledged segment already */
+	if (conn->data_mode == TCP_DATA_MODE_RESEND) {
+		return;
+	}
+
+	for (int i = 0; i < sack->count; i++) {
+		struct tcp_seg *seg = tcp_seg_get(conn, i);
+
+		if (!(seg->flags & TCP_SEG_LOST)) {
+			continue;
+		}
+
+		if (!sack->in_recovery) {
+			NET_DBG("conn: %p recovery from seq %u", conn, seg->seq);
+			sack->in_recovery = true;
+			sack->recovery_point = conn->seq + conn->unacked_len;
+			tcp_ca_fast_retransmit(conn);
+		}
+
+		(void)tcp_sack_send_seg(conn, seg);
+		break;
+	}
+}
+
+/* Update the scoreboard from an ACK received, before the acknowledged data
+ * is removed from the send queue, and retransmit what is deemed lost.
+ */
+static void tcp_sack_ack_received(struct tcp *conn, uint32_t ack)
+{
+	uint32_t now = k_uptime_get_32();
+	uint32_t timeout;
+
+	if (!tcp_sack_ok(conn)) {
+		return;
+	}
+
+	if (net_tcp_seq_greater(ack, conn->seq)) {
+		tcp_sack_acked(conn, ack, now);
+	}
+
+	tcp_sack_blocks_received(conn, now);
+	tcp_sack_mark_lost(conn);
+	timeout = tcp_rack_detect_loss(conn, now);
+
+	tcp_sack_retransmit(conn);
+	tcp_rack_timer_update(conn, timeout);
+}
+
+#ifdef CONFIG_NET_TCP_RACK
+
+/* Send new data if the windows allow it, or else the last segment sent
+ * again, so that the peer reports any loss at the tail of the flight.
+ */
+static void tcp_rack_tail_probe(struct tcp *conn)
+{
+	struct tcp_seg *seg;
+
+	conn->sack.tlp_sent = true;
+
+	if (tcp_unsent_len(conn) > 0 && tcp_send_data(conn) == 0) {
+		return;
+	}
+
+	seg = tcp_seg_get(conn, conn->sack.count - 1U);
+	if (!(seg->flags & TCP_SEG_SACKED)) {
+		NET_DBG("conn: %p probe seq %u", conn, seg->seq);
+		(void)tcp_sack_send_seg(conn, seg);
+	}
+}
+
+static void tcp_rack_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, rack_timer);
+	uint32_t timeout;
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	if (conn->sack.count == 0U ||
+	    conn->data_mode == TCP_DATA_MODE_RESEND) {
+		goto out;
+	}
+
+	if (conn->sack.reo_timeout) {
+		timeout = tcp_rack_detect_loss(conn, k_uptime_get_32());
+		tcp_sack_retransmit(conn);
+		tcp_rack_timer_update(conn, timeout);
+	} else {
+		tcp_rack_tail_probe(conn);
+	}
+
+out:
+	k_mutex_unlock(&conn->lock);
+}
+
+#endif /* CONFIG_NET_TCP_RACK */
+
+#else
+
+static void tcp_sack_ack_received(struct tcp *conn, uint32_t ack) { }
+
+#endif /* CONFIG_NET_TCP_SACK */
+
 static void tcp_timewait_timeout(struct k_work *work)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
@@ -2124,6 +2929,7 @@ static struct tcp *tcp_conn_alloc(void)
 	 * is available as soon as the connection is established
 	 */
 	conn->ca.cwnd = UINT16_MAX;
+	conn->ca_ops = TCP_CA_DEFAULT;
 #endif
 
 	/* The ISN value will be set when we get the connection attempt or
@@ -2140,6 +2946,9 @@ static struct tcp *tcp_conn_alloc(void)
 	k_work_init_delayable(&conn->recv_queue_timer, tcp_cleanup_recv_queue);
 	k_work_init_delayable(&conn->persist_timer, tcp_send_zwp);
 	k_work_init_delayable(&conn->ack_timer, tcp_send_ack);
+#if defined(CONFIG_NET_TCP_RACK)
+	k_work_init_delayable(&conn->rack_timer, tcp_rack_timeout);
+#endif
 	k_work_init(&conn->conn_release, tcp_conn_release);
 	keep_alive_timer_init(conn);
 
@@ -2734,6 +3543,11 @@ static void tcp_out_of_order_data(struct tcp *conn, struct net_pkt *pkt,
 		return;
 	}
 
+#ifdef CONFIG_NET_TCP_SACK
+	/* Reported in the first SACK block of the ACK sent in return */
+	conn->sack.recv_seq = seq;
+#endif
+
 	/* We received out-of-order data. Try to queue it.
 	 */
 	tcp_queue_recv_data(conn, pkt, data_len, seq);
@@ -2849,8 +3663,12 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto out;
 	}
 
+#ifdef CONFIG_NET_TCP_SACK
+	conn->recv_options.sack_blocks = 0U;
+#endif
+
 	if (tcp_options_len && !tcp_options_check(&conn->recv_options, pkt,
-						  tcp_options_len)) {
+						  tcp_options_len, fl)) {
 		NET_DBG("DROP: Invalid TCP option list");
 		tcp_out(conn, RST);
 		do_close = true;
@@ -2939,6 +3757,9 @@ next_state:
 				accept_cb = conn->accepted_conn->accept_cb;
 				context = conn->accepted_conn->context;
 				keep_alive_param_copy(conn, conn->accepted_conn);
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+				conn->ca_ops = conn->accepted_conn->ca_ops;
+#endif
 			}
 
 			k_work_cancel_delayable(&conn->establish_timer);
@@ -3111,6 +3932,10 @@ next_state:
 		 */
 		keep_alive_timer_restart(conn);
 
+		if (th) {
+			tcp_sack_ack_received(conn, th_ack(th));
+		}
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (th && (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0)) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3128,9 +3953,12 @@ next_state:
 				conn->dup_ack_cnt = 0;
 			}
 
-			/* Only do fast retransmit when not already in a resend state */
+			/* Only do fast retransmit when not already in a resend state,
+			 * or recovering from the losses reported by SACK
+			 */
 			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
-			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
+			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) &&
+			    !tcp_sack_in_recovery(conn)) {
 				/* Apply a fast retransmit */
 				int temp_unacked_len = conn->unacked_len;
 
@@ -4051,6 +4879,11 @@ int net_tcp_finalize(struct net_pkt *pkt, bool force_chksum)
 
 	tcp_hdr->chksum = 0U;
 
+	/* Each segment gets its own checksum once the packet is split */
+	if (net_pkt_gso_size(pkt) > 0U) {
+		return net_pkt_set_data(pkt, &tcp_access);
+	}
+
 	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt)) || force_chksum) {
 		tcp_hdr->chksum = net_calc_chksum_tcp(pkt);
 		net_pkt_set_chksum_done(pkt, true);
@@ -4064,9 +4897,11 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 {
 	struct net_tcp_hdr *tcp_hdr;
 
+	/* The segments merged by GRO have been checked already */
 	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
 	    (net_if_need_calc_rx_checksum(net_pkt_iface(pkt)) ||
 	     net_pkt_is_ip_reassembled(pkt)) &&
+	    net_pkt_gso_size(pkt) == 0U &&
 	    net_calc_chksum_tcp(pkt) != 0U) {
 		NET_DBG("DROP: checksum mismatch");
 		goto drop;
@@ -4427,6 +5262,9 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = set_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = set_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4464,6 +5302,9 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = get_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = get_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * BBR congestion control, version 1 (draft-cardwell-iccrg-bbr-congestion-control-00)
+ *
+ * The stack has no pacing, so the congestion window is the only control:
+ * it is set to the pacing gain of the current phase times the estimated
+ * bandwidth-delay product, plus a few segments absorbing the delayed and
+ * aggregated ACKs. The delivery rate is sampled once per round trip.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/random/random.h>
+#include <zephyr/sys/util.h>
+#include "tcp_internal.h"
+
+/* Gains are in 1/256 units */
+#define BBR_UNIT 256
+/* 2/ln(2), to double the delivery rate every round in startup */
+#define BBR_HIGH_GAIN (BBR_UNIT * 2885 / 1000 + 1)
+/* The delivery rate must grow by 25% within 3 rounds to keep on startup */
+#define BBR_FULL_BW_THRESH (BBR_UNIT * 5 / 4)
+#define BBR_FULL_BW_ROUNDS 3
+/* Window of the max filter of the delivery rate, in rounds */
+#define BBR_BW_ROUNDS 10
+/* Window of the min filter of the RTT */
+#define BBR_MIN_RTT_WIN_US (10 * USEC_PER_SEC)
+#define BBR_PROBE_RTT_US (200 * USEC_PER_MSEC)
+#define BBR_MIN_CWND_SEGS 4
+#define BBR_ACK_AGGR_SEGS 3
+#define BBR_CYCLE_LEN 8
+
+#define bbr(_conn) (&(_conn)->ca_priv.bbr)
+
+/* Probe for more bandwidth, drain the queue it created, then cruise */
+static const uint16_t bbr_cycle_gain[BBR_CYCLE_LEN] = {
+	BBR_UNIT * 5 / 4, BBR_UNIT * 3 / 4,
+	BBR_UNIT, BBR_UNIT, BBR_UNIT, BBR_UNIT, BBR_UNIT, BBR_UNIT,
+};
+
+static void tcp_bbr_log(struct tcp *conn, char *step)
+{
+	NET_DBG("conn: %p, ca %s, cwnd=%d, mode=%d, bw=%u, min_rtt=%u",
+		conn, step, conn->ca.cwnd, bbr(conn)->mode, bbr(conn)->bw,
+		bbr(conn)->min_rtt);
+}
+
+static uint32_t tcp_bbr_min_cwnd(struct tcp *conn)
+{
+	return BBR_MIN_CWND_SEGS * conn_mss(conn);
+}
+
+/* Bandwidth-delay product scaled by gain, UINT16_MAX if not known yet */
+static uint32_t tcp_bbr_bdp(struct tcp *conn, uint32_t gain)
+{
+	struct tcp_ca_bbr *ca = bbr(conn);
+	uint64_t bdp;
+
+	if (!ca->min_rtt_valid || ca->bw == 0) {
+		return UINT16_MAX;
+	}
+
+	bdp = (uint64_t)ca->bw * ca->min_rtt / USEC_PER_SEC;
+
+	return MIN(bdp * gain / BBR_UNIT, UINT16_MAX);
+}
+
+static uint32_t tcp_bbr_gain(struct tcp *conn)
+{
+	struct tcp_ca_bbr *ca = bbr(conn);
+
+	switch (ca->mode) {
+	case TCP_BBR_STARTUP:
+		return BBR_HIGH_GAIN;
+	case TCP_BBR_PROBE_BW:
+		return bbr_cycle_gain[ca->cycle_idx];
+	default:
+		return BBR_UNIT;
+	}
+}
+
+static void tcp_bbr_init(struct tcp *conn)
+{
+	struct tcp_ca_bbr *ca = bbr(conn);
+	uint32_t now = tcp_ca_now_us();
+
+	memset(ca, 0, sizeof(struct tcp_ca_bbr));
+
+	ca->mode = TCP_BBR_STARTUP;
+	ca->round_start = now;
+	ca->round_end_seq = conn->seq;
+	ca->min_rtt_stamp = now;
+
+	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
+	conn->ca.ssthresh = UINT16_MAX;
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	tcp_bbr_log(conn, "init");
+}
+
+static void tcp_bbr_enter_probe_bw(struct tcp *conn, uint32_t now)
+{
+	struct tcp_ca_bbr *ca = bbr(conn);
+
+	ca->mode = TCP_BBR_PROBE_BW;
+	ca->cycle_stamp = now;
+	/* Start at a random phase, but the draining one, to avoid flows
+	 * probing in sync.
+	 */
+	ca->cycle_idx = (BBR_CYCLE_LEN - sys_rand32_get() % (BBR_CYCLE_LEN - 1)) %
+			BBR_CYCLE_LEN;
+}
+
+/* Sample the delivery rate of the round trip which just ended */
+static void tcp_bbr_round_end(struct tcp *conn, uint32_t now)
+{
+	struct tcp_ca_bbr *ca = bbr(conn);
+	uint32_t interval = MAX(now - ca->round_start, 1U);
+	uint32_t sample;
+
+	sample = MIN((uint64_t)ca->delivered * USEC_PER_SEC / interval, UINT32_MAX);
+
+	/* A sample limited by the application only tells the bandwidth is
+	 * at least that much.
+	 */
+	if (!ca->app_limited || sample >= ca->bw) {
+		if (sample >= ca->bw || ++ca->bw_rounds >= BBR_BW_ROUNDS) {
+			ca->bw = sample;
+			ca->bw_rounds = 0;
+		}
+
+		if (!ca->full_bw_reached && !ca->app_limited) {
+			if ((uint64_t)ca->bw * BBR_UNIT >=
+			    (uint64_t)ca->full_bw * BBR_FULL_BW_THRESH) {
+				ca->full_bw = ca->bw;
+				ca->full_bw_cnt = 0;
+			} else if (++ca->full_bw_cnt >= BBR_FULL_BW_ROUNDS) {
+				ca->full_bw_reached = true;
+			}
+		}
+	}
+
+	ca->round_start = now;
+	ca->round_end_seq = conn->seq + conn->unacked_len;
+	ca->delivered = 0;
+	ca->app_limited = false;
+}
+
+static void tcp_bbr_update_mode(struct tcp *conn, uint32_t now,
+				uint32_t inflight)
+{
+	struct tcp_ca_bbr *ca = bbr(conn);
+
+	switch (ca->mode) {
+	case TCP_BBR_STARTUP:
+		if (ca->full_bw_reached) {
+			ca->mode = TCP_BBR_DRAIN;
+			tcp_bbr_log(conn, "drain");
+		}
+
+		break;
+	case TCP_BBR_DRAIN:
+		if (inflight <= tcp_bbr_bdp(conn, BBR_UNIT)) {
+			tcp_bbr_enter_probe_bw(conn, now);
+			tcp_bbr_log(conn, "probe_bw");
+		}
+
+		break;
+	case TCP_BBR_PROBE_BW:
+		if (now - ca->cycle_stamp > ca->min_rtt) {
+			ca->cycle_idx = (ca->cycle_idx + 1) % BBR_CYCLE_LEN;
+			ca->cycle_stamp = now;
+		}
+
+		break;
+	case TCP_BBR_PROBE_RTT:
+		if (!ca->probe_rtt_pending) {
+			if (inflight <= tcp_bbr_min_cwnd(conn)) {
+				ca->probe_rtt_done = now + BBR_PROBE_RTT_US;
+				ca->probe_rtt_pending = true;
+			}
+		} else if ((int32_t)(now - ca->probe_rtt_done) >= 0) {
+			ca->min_rtt_stamp = now;
+			ca->probe_rtt_pending = false;
+			conn->ca.cwnd = MAX(conn->ca.cwnd, ca->prior_cwnd);
+
+			if (ca->full_bw_reached) {
+				tcp_bbr_enter_probe_bw(conn, now);
+			} else {
+				ca->mode = TCP_BBR_STARTUP;
+			}
+
+			tcp_bbr_log(conn, "probe_rtt done");
+		}
+
+		break;
+	}
+}
+
+static void tcp_bbr_set_cwnd(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_ca_bbr *ca = bbr(conn);
+	uint32_t min_cwnd = tcp_bbr_min_cwnd(conn);
+	uint32_t cwnd = conn->ca.cwnd;
+	uint32_t target;
+
+	if (ca->mode == TCP_BBR_PROBE_RTT) {
+		conn->ca.cwnd = MIN(cwnd, min_cwnd);
+		return;
+	}
+
+	target = tcp_bbr_bdp(conn, tcp_bbr_gain(conn));
+	target = MAX(target + BBR_ACK_AGGR_SEGS * conn_mss(conn), min_cwnd);
+
+	if (ca->full_bw_reached) {
+		cwnd = MIN(cwnd + acked_len, target);
+	} else if (cwnd < target) {
+		cwnd += acked_len;
+	}
+
+	conn->ca.cwnd = CLAMP(cwnd, min_cwnd, UINT16_MAX);
+}
+
+static void tcp_bbr_fast_retransmit(struct tcp *conn)
+{
+	struct tcp_ca_bbr *ca = bbr(conn);
+
+	/* The model is kept, only send as much as was delivered while
+	 * recovering.
+	 */
+	ca->prior_cwnd = conn->ca.cwnd;
+	conn->ca.cwnd = MIN(conn->ca.cwnd,
+			    MAX(conn->unacked_len, tcp_bbr_min_cwnd(conn)));
+	tcp_bbr_log(conn, "fast_retransmit");
+}
+
+static void tcp_bbr_timeout(struct tcp *conn)
+{
+	struct tcp_ca_bbr *ca = bbr(conn);
+
+	ca->prior_cwnd = conn->ca.cwnd;
+	conn->ca.cwnd = conn_mss(conn);
+
+	/* The data in flight is resent, start a new round */
+	ca->round_start = tcp_ca_now_us();
+	ca->round_end_seq = conn->seq + conn->unacked_len;
+	ca->delivered = 0;
+	tcp_bbr_log(conn, "timeout");
+}
+
+static void tcp_bbr_dup_ack(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static void tcp_bbr_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_ca_bbr *ca = bbr(conn);
+	uint32_t now = tcp_ca_now_us();
+	uint32_t inflight = 0;
+
+	if (conn->unacked_len > acked_len) {
+		inflight = conn->unacked_len - acked_len;
+	}
+
+	/* Nothing more to send, the round does not use the whole window */
+	if (conn->send_data_total <= conn->unacked_len &&
+	    inflight < conn->ca.cwnd) {
+		ca->app_limited = true;
+	}
+
+	ca->delivered += acked_len;
+
+	if (!net_tcp_seq_greater(ca->round_end_seq, conn->seq + acked_len)) {
+		tcp_bbr_round_end(conn, now);
+	}
+
+	tcp_bbr_update_mode(conn, now, inflight);
+	tcp_bbr_set_cwnd(conn, acked_len);
+	tcp_bbr_log(conn, "pkts_acked");
+}
+
+static void tcp_bbr_rtt_sample(struct tcp *conn, uint32_t rtt)
+{
+	struct tcp_ca_bbr *ca = bbr(conn);
+	uint32_t now = tcp_ca_now_us();
+	bool expired;
+
+	expired = ca->min_rtt_valid &&
+		  (now - ca->min_rtt_stamp > BBR_MIN_RTT_WIN_US);
+
+	if (!ca->min_rtt_valid || rtt <= ca->min_rtt || expired) {
+		ca->min_rtt = MAX(rtt, 1U);
+		ca->min_rtt_stamp = now;
+		ca->min_rtt_valid = true;
+	}
+
+	/* Let the queue drain to measure the RTT of the path again */
+	if (expired && ca->mode != TCP_BBR_PROBE_RTT) {
+		ca->mode = TCP_BBR_PROBE_RTT;
+		ca->prior_cwnd = conn->ca.cwnd;
+		ca->probe_rtt_pending = false;
+		tcp_bbr_log(conn, "probe_rtt");
+	}
+}
+
+const struct tcp_ca_ops tcp_ca_bbr = {
+	.name = "bbr",
+	.init = tcp_bbr_init,
+	.fast_retransmit = tcp_bbr_fast_retransmit,
+	.timeout = tcp_bbr_timeout,
+	.dup_ack = tcp_bbr_dup_ack,
+	.pkts_acked = tcp_bbr_pkts_acked,
+	.rtt_sample = tcp_bbr_rtt_sample,
+};
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * CUBIC congestion control, RFC 9438
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include "tcp_internal.h"
+
+/* The constants of the RFC, C = 0.4 and beta = 0.7 */
+#define CUBIC_C_NUM 4
+#define CUBIC_C_DEN 10
+#define CUBIC_BETA_NUM 7
+#define CUBIC_BETA_DEN 10
+/* Additive increase of the Reno friendly region, 3 * (1 - beta) / (1 + beta) */
+#define CUBIC_ALPHA_NUM 9
+#define CUBIC_ALPHA_DEN 17
+
+/* Bound the time in the cubic function, so that it cannot overflow */
+#define CUBIC_MAX_T_MS (30 * MSEC_PER_SEC)
+
+#define cubic(_conn) (&(_conn)->ca_priv.cubic)
+
+static void tcp_cubic_log(struct tcp *conn, char *step)
+{
+	NET_DBG("conn: %p, ca %s, cwnd=%d, ssthres=%d, w_max=%d, k=%u",
+		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
+		cubic(conn)->w_max, cubic(conn)->k);
+}
+
+/* Integer cube root, rounded down */
+static uint32_t tcp_cubic_root(uint64_t a)
+{
+	uint64_t y = 0;
+
+	for (int s = 63; s >= 0; s -= 3) {
+		uint64_t b;
+
+		y <<= 1;
+		b = 3 * y * (y + 1) + 1;
+		if ((a >> s) >= b) {
+			a -= b << s;
+			y++;
+		}
+	}
+
+	return (uint32_t)y;
+}
+
+static void tcp_cubic_init(struct tcp *conn)
+{
+	memset(cubic(conn), 0, sizeof(struct tcp_ca_cubic));
+
+	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
+	/* Slow start until the first congestion event, as the RFC suggests */
+	conn->ca.ssthresh = UINT16_MAX;
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	tcp_cubic_log(conn, "init");
+}
+
+/* Remember the window at the congestion event and reduce it by beta */
+static void tcp_cubic_congestion(struct tcp *conn)
+{
+	struct tcp_ca_cubic *ca = cubic(conn);
+	uint32_t cwnd = conn->ca.cwnd;
+
+	/* Fast convergence, release bandwidth to the new flows */
+	if (cwnd < ca->w_max) {
+		ca->w_max = cwnd * (CUBIC_BETA_DEN + CUBIC_BETA_NUM) /
+			    (2 * CUBIC_BETA_DEN);
+	} else {
+		ca->w_max = cwnd;
+	}
+
+	ca->in_epoch = false;
+	conn->ca.ssthresh = MAX(cwnd * CUBIC_BETA_NUM / CUBIC_BETA_DEN,
+				conn_mss(conn) * 2);
+}
+
+static void tcp_cubic_fast_retransmit(struct tcp *conn)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		tcp_cubic_congestion(conn);
+		/* Account for the lost segments, as New Reno */
+		conn->ca.cwnd = MIN(conn_mss(conn) * 3 + conn->ca.ssthresh,
+				    UINT16_MAX);
+		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+		tcp_cubic_log(conn, "fast_retransmit");
+	}
+}
+
+static void tcp_cubic_timeout(struct tcp *conn)
+{
+	tcp_cubic_congestion(conn);
+	conn->ca.cwnd = conn_mss(conn);
+	tcp_cubic_log(conn, "timeout");
+}
+
+static void tcp_cubic_dup_ack(struct tcp *conn)
+{
+	int32_t new_win = conn->ca.cwnd;
+
+	new_win += conn_mss(conn);
+	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	tcp_cubic_log(conn, "dup_ack");
+}
+
+static void tcp_cubic_epoch_start(struct tcp *conn, uint32_t now)
+{
+	struct tcp_ca_cubic *ca = cubic(conn);
+	uint32_t cwnd = conn->ca.cwnd;
+
+	ca->in_epoch = true;
+	ca->epoch_start = now;
+	ca->cwnd_acc = 0;
+	ca->est_acc = 0;
+	ca->w_est = cwnd;
+
+	if (cwnd < ca->w_max) {
+		/* K = cubic_root((w_max - cwnd) / C), in segments and s */
+		ca->k = tcp_cubic_root((uint64_t)(ca->w_max - cwnd) *
+				       CUBIC_C_DEN * NSEC_PER_SEC /
+				       (CUBIC_C_NUM * conn_mss(conn)));
+		ca->origin = ca->w_max;
+	} else {
+		ca->k = 0;
+		ca->origin = cwnd;
+	}
+}
+
+/* W_cubic(t) = C * (t - K)^3 + W_max, in bytes for t in ms */
+static uint32_t tcp_cubic_window(struct tcp *conn, uint32_t t)
+{
+	struct tcp_ca_cubic *ca = cubic(conn);
+	int64_t d = (int64_t)MIN(t, CUBIC_MAX_T_MS) - ca->k;
+	int64_t w;
+
+	w = d * d * d * conn_mss(conn) / MSEC_PER_SEC;
+	w = w * CUBIC_C_NUM / (CUBIC_C_DEN * USEC_PER_SEC);
+	w += ca->origin;
+
+	return CLAMP(w, 0, UINT16_MAX);
+}
+
+static void tcp_cubic_avoidance(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_ca_cubic *ca = cubic(conn);
+	uint32_t now = k_uptime_get_32();
+	uint32_t cwnd = conn->ca.cwnd;
+	uint32_t target;
+	uint32_t t;
+
+	if (!ca->in_epoch) {
+		tcp_cubic_epoch_start(conn, now);
+	}
+
+	/* Aim at the window the cubic function reaches in one RTT */
+	t = now - ca->epoch_start + ca->min_rtt / USEC_PER_MSEC;
+	target = CLAMP(tcp_cubic_window(conn, t), cwnd, cwnd + cwnd / 2);
+
+	/* Increase of (target - cwnd) / cwnd per segment acknowledged */
+	ca->cwnd_acc += (target - cwnd) * acked_len;
+	cwnd += ca->cwnd_acc / conn->ca.cwnd;
+	ca->cwnd_acc %= conn->ca.cwnd;
+
+	/* Reno friendly region, where Reno would grow faster than CUBIC */
+	ca->est_acc += CUBIC_ALPHA_NUM * MIN(acked_len, conn_mss(conn)) *
+		       conn_mss(conn);
+	ca->w_est = MIN(ca->w_est + ca->est_acc / (CUBIC_ALPHA_DEN * conn->ca.cwnd),
+			UINT16_MAX);
+	ca->est_acc %= CUBIC_ALPHA_DEN * conn->ca.cwnd;
+
+	conn->ca.cwnd = MIN(MAX(cwnd, ca->w_est), UINT16_MAX);
+}
+
+static void tcp_cubic_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		if (conn->ca.cwnd < conn->ca.ssthresh) {
+			conn->ca.cwnd = MIN(conn->ca.cwnd +
+					    MIN(acked_len, conn_mss(conn)),
+					    UINT16_MAX);
+		} else {
+			tcp_cubic_avoidance(conn, acked_len);
+		}
+	} else {
+		/* Check if it is still in fast recovery mode */
+		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
+			conn->ca.pending_fast_retransmit_bytes = 0;
+			conn->ca.cwnd = conn->ca.ssthresh;
+		} else {
+			conn->ca.pending_fast_retransmit_bytes -= acked_len;
+			conn->ca.cwnd = MAX((int32_t)conn->ca.cwnd - (int32_t)acked_len,
+					    conn_mss(conn));
+		}
+	}
+	tcp_cubic_log(conn, "pkts_acked");
+}
+
+static void tcp_cubic_rtt_sample(struct tcp *conn, uint32_t rtt)
+{
+	struct tcp_ca_cubic *ca = cubic(conn);
+
+	if (ca->min_rtt == 0 || rtt < ca->min_rtt) {
+		ca->min_rtt = MAX(rtt, 1U);
+	}
+}
+
+const struct tcp_ca_ops tcp_ca_cubic = {
+	.name = "cubic",
+	.init = tcp_cubic_init,
+	.fast_retransmit = tcp_cubic_fast_retransmit,
+	.timeout = tcp_cubic_timeout,
+	.dup_ack = tcp_cubic_dup_ack,
+	.pkts_acked = tcp_cubic_pkts_acked,
+	.rtt_sample = tcp_cubic_rtt_sample,
+};
@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Generic receive offload, merge the consecutive segments of a TCP flow
+ * waiting in an RX queue before they go up the stack.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+#include "tcp_internal.h"
+
+/* The IP header of the merged packet must be able to tell its length */
+#define GRO_MAX_LEN (UINT16_MAX - NET_TCP_GRO_HDR_MAX)
+
+/* Headers of a received segment */
+struct tcp_gro_seg {
+	uint8_t hdr[NET_TCP_GRO_HDR_MAX];
+	uint8_t ip_hdr_len;
+	uint8_t hdr_len;
+	uint16_t len;
+};
+
+static inline struct net_tcp_hdr *tcp_gro_th(uint8_t *hdr, uint8_t ip_hdr_len)
+{
+	return (struct net_tcp_hdr *)(hdr + ip_hdr_len);
+}
+
+static bool tcp_gro_iface_ok(struct net_if *iface)
+{
+#if defined(CONFIG_NET_L2_ETHERNET)
+	/* Already done by the hardware */
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET) &&
+	    (net_eth_get_hw_capabilities(iface) & ETHERNET_HW_RX_TCP_COALESCE)) {
+		return false;
+	}
+#endif
+
+	return true;
+}
+
+/* Only plain data segments of IP packets without options are merged */
+static bool tcp_gro_parse(struct net_pkt *pkt, struct tcp_gro_seg *seg)
+{
+	size_t pkt_len = net_pkt_get_len(pkt);
+	struct net_tcp_hdr *tcp_hdr;
+	size_t tcp_hdr_len;
+	int ret;
+
+	if (net_pkt_is_ip_reassembled(pkt) ||
+	    pkt_len <= sizeof(struct net_ipv4_hdr) + sizeof(struct net_tcp_hdr)) {
+		return false;
+	}
+
+	net_pkt_cursor_init(pkt);
+	ret = net_pkt_read(pkt, seg->hdr, MIN(pkt_len, sizeof(seg->hdr)));
+	net_pkt_cursor_init(pkt);
+
+	if (ret < 0) {
+		return false;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && (seg->hdr[0] & 0xf0) == 0x40) {
+		struct net_ipv4_hdr *ip_hdr = (struct net_ipv4_hdr *)seg->hdr;
+
+		if (ip_hdr->vhl != 0x45 || ip_hdr->proto != IPPROTO_TCP ||
+		    (sys_get_be16(ip_hdr->offset) &
+		     (NET_IPV4_MORE_FRAG_MASK | NET_IPV4_FRAGH_OFFSET_MASK)) ||
+		    ntohs(ip_hdr->len) != pkt_len) {
+			return false;
+		}
+
+		seg->ip_hdr_len = sizeof(struct net_ipv4_hdr);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && (seg->hdr[0] & 0xf0) == 0x60) {
+		struct net_ipv6_hdr *ip_hdr = (struct net_ipv6_hdr *)seg->hdr;
+
+		if (ip_hdr->nexthdr != IPPROTO_TCP ||
+		    pkt_len <= sizeof(struct net_ipv6_hdr) + sizeof(struct net_tcp_hdr) ||
+		    ntohs(ip_hdr->len) + sizeof(struct net_ipv6_hdr) != pkt_len) {
+			return false;
+		}
+
+		seg->ip_hdr_len = sizeof(struct net_ipv6_hdr);
+	} else {
+		return false;
+	}
+
+	tcp_hdr = tcp_gro_th(seg->hdr, seg->ip_hdr_len);
+	tcp_hdr_len = (tcp_hdr->offset >> 4) * 4U;
+	seg->hdr_len = seg->ip_hdr_len + tcp_hdr_len;
+
+	if (tcp_hdr_len < sizeof(struct net_tcp_hdr) || seg->hdr_len >= pkt_len ||
+	    (tcp_hdr->flags & ~PSH) != ACK) {
+		return false;
+	}
+
+	seg->len = pkt_len - seg->hdr_len;
+
+	return true;
+}
+
+/* Segments which are forwarded must keep their size */
+static bool tcp_gro_is_local(struct tcp_gro_seg *seg)
+{
+	if (!IS_ENABLED(CONFIG_NET_ROUTING)) {
+		return true;
+	}
+
+	if (seg->ip_hdr_len == sizeof(struct net_ipv4_hdr)) {
+		return net_ipv4_is_my_addr(
+			(struct in_addr *)((struct net_ipv4_hdr *)seg->hdr)->dst);
+	}
+
+	return net_ipv6_is_my_addr(
+		(struct in6_addr *)((struct net_ipv6_hdr *)seg->hdr)->dst);
+}
+
+static void tcp_gro_set_ip(struct net_pkt *pkt, struct tcp_gro_seg *seg)
+{
+	if (seg->ip_hdr_len == sizeof(struct net_ipv4_hdr)) {
+		net_pkt_set_family(pkt, AF_INET);
+		net_pkt_set_ipv4_opts_len(pkt, 0U);
+	} else {
+		net_pkt_set_family(pkt, AF_INET6);
+		net_pkt_set_ipv6_ext_len(pkt, 0U);
+	}
+
+	net_pkt_set_ip_hdr_len(pkt, seg->ip_hdr_len);
+}
+
+/* Is this the next segment of the flow, with the same header fields
+ * except for the IP length, ID and checksum, and the TCP sequence number,
+ * PSH flag and checksum.
+ */
+static bool tcp_gro_match(struct net_tcp_gro *gro, struct net_pkt *pkt,
+			  struct tcp_gro_seg *seg)
+{
+	struct net_tcp_hdr *held = tcp_gro_th(gro->hdr, gro->ip_hdr_len);
+	struct net_tcp_hdr *tcp_hdr = tcp_gro_th(seg->hdr, seg->ip_hdr_len);
+	uint8_t *h = gro->hdr;
+	uint8_t *s = seg->hdr;
+
+	if (net_pkt_iface(gro->pkt) != net_pkt_iface(pkt) ||
+	    seg->ip_hdr_len != gro->ip_hdr_len || seg->hdr_len != gro->hdr_len) {
+		return false;
+	}
+
+	if (gro->ip_hdr_len == sizeof(struct net_ipv4_hdr)) {
+		/* Version, TOS, fragment flags, TTL, protocol and addresses */
+		if (memcmp(h, s, 2) || memcmp(h + 6, s + 6, 4) ||
+		    memcmp(h + 12, s + 12, 8)) {
+			return false;
+		}
+	} else {
+		/* Version, traffic class, flow label, hop limit and addresses */
+		if (memcmp(h, s, 4) || memcmp(h + 6, s + 6, 34)) {
+			return false;
+		}
+	}
+
+	if (held->src_port != tcp_hdr->src_port ||
+	    held->dst_port != tcp_hdr->dst_port ||
+	    memcmp(held->ack, tcp_hdr->ack, sizeof(held->ack)) ||
+	    held->flags != ACK ||
+	    memcmp(held->wnd, tcp_hdr->wnd, sizeof(held->wnd)) ||
+	    memcmp(held->optdata, tcp_hdr->optdata,
+		   gro->hdr_len - gro->ip_hdr_len - sizeof(struct net_tcp_hdr))) {
+		return false;
+	}
+
+	return sys_get_be32(tcp_hdr->seq) == sys_get_be32(held->seq) + gro->len &&
+	       seg->len <= gro->seg_len && gro->len + seg->len <= GRO_MAX_LEN;
+}
+
+/* Check a segment as the IP and TCP input would, they will not see it */
+static bool tcp_gro_verify(struct net_pkt *pkt)
+{
+	if (!net_if_need_calc_rx_checksum(net_pkt_iface(pkt))) {
+		return true;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET &&
+	    net_calc_chksum_ipv4(pkt) != 0U) {
+		return false;
+	}
+
+	return !IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) || net_calc_chksum_tcp(pkt) == 0U;
+}
+
+/* Remove the headers without moving the payload, if possible */
+static int tcp_gro_strip(struct net_pkt *pkt, size_t hdr_len)
+{
+	if (pkt->buffer->len > hdr_len) {
+		net_buf_pull(pkt->buffer, hdr_len);
+		net_pkt_cursor_init(pkt);
+
+		return 0;
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	return net_pkt_pull(pkt, hdr_len);
+}
+
+static int tcp_gro_merge(struct net_tcp_gro *gro, struct net_pkt *pkt,
+			 struct tcp_gro_seg *seg)
+{
+	/* The first segment is checked once it is known to be merged */
+	if (gro->segs == 1U && !tcp_gro_verify(gro->pkt)) {
+		return -EBADMSG;
+	}
+
+	if (!tcp_gro_verify(pkt)) {
+		return -EBADMSG;
+	}
+
+	if (tcp_gro_strip(pkt, seg->hdr_len) < 0) {
+		return -ENOBUFS;
+	}
+
+	net_pkt_append_buffer(gro->pkt, pkt->buffer);
+	pkt->buffer = NULL;
+	net_pkt_unref(pkt);
+
+	tcp_gro_th(gro->hdr, gro->ip_hdr_len)->flags |=
+		tcp_gro_th(seg->hdr, seg->ip_hdr_len)->flags;
+	gro->len += seg->len;
+	gro->segs++;
+
+	return 0;
+}
+
+static void tcp_gro_hold(struct net_tcp_gro *gro, struct net_pkt *pkt,
+			 struct tcp_gro_seg *seg, bool is_loopback)
+{
+	gro->pkt = pkt;
+	memcpy(gro->hdr, seg->hdr, seg->hdr_len);
+	gro->ip_hdr_len = seg->ip_hdr_len;
+	gro->hdr_len = seg->hdr_len;
+	gro->seg_len = seg->len;
+	gro->len = seg->len;
+	gro->segs = 1U;
+	gro->is_loopback = is_loopback;
+}
+
+/* Make the headers of the first segment cover all the merged ones */
+static int tcp_gro_update(struct net_tcp_gro *gro, struct net_pkt *pkt)
+{
+	uint16_t len = gro->hdr_len + gro->len;
+	int ret;
+
+	if (gro->ip_hdr_len == sizeof(struct net_ipv4_hdr)) {
+		struct net_ipv4_hdr *ip_hdr = (struct net_ipv4_hdr *)gro->hdr;
+
+		ip_hdr->len = htons(len);
+		ip_hdr->chksum = 0U;
+	} else {
+		struct net_ipv6_hdr *ip_hdr = (struct net_ipv6_hdr *)gro->hdr;
+
+		ip_hdr->len = htons(len - sizeof(struct net_ipv6_hdr));
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	ret = net_pkt_write(pkt, gro->hdr, gro->hdr_len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (gro->ip_hdr_len == sizeof(struct net_ipv4_hdr)) {
+		NET_IPV4_HDR(pkt)->chksum = net_calc_chksum_ipv4(pkt);
+	}
+
+	/* Tells the TCP input the segments have been checked already */
+	net_pkt_set_gso_size(pkt, gro->seg_len);
+
+	return 0;
+}
+
+void net_tcp_gro_flush(struct net_tcp_gro *gro)
+{
+	struct net_pkt *pkt = gro->pkt;
+	enum net_verdict verdict;
+
+	if (pkt == NULL) {
+		return;
+	}
+
+	gro->pkt = NULL;
+
+	if (gro->segs > 1U) {
+		NET_DBG("pkt %p merged %u segments, len %u", pkt, gro->segs,
+			gro->len);
+
+		if (tcp_gro_update(gro, pkt) < 0) {
+			net_pkt_unref(pkt);
+			return;
+		}
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_family(pkt) == AF_INET) {
+		verdict = net_ipv4_input(pkt, gro->is_loopback);
+	} else {
+		verdict = net_ipv6_input(pkt, gro->is_loopback);
+	}
+
+	if (verdict != NET_OK) {
+		NET_DBG("Dropping pkt %p", pkt);
+		net_pkt_unref(pkt);
+	}
+}
+
+enum net_verdict net_tcp_gro_receive(struct net_tcp_gro *gro,
+				     struct net_pkt *pkt, bool is_loopback)
+{
+	struct tcp_gro_seg seg;
+	uint8_t flags;
+
+	if (!tcp_gro_iface_ok(net_pkt_iface(pkt)) || !tcp_gro_parse(pkt, &seg)) {
+		net_tcp_gro_flush(gro);
+		return NET_CONTINUE;
+	}
+
+	tcp_gro_set_ip(pkt, &seg);
+	flags = tcp_gro_th(seg.hdr, seg.ip_hdr_len)->flags;
+
+	if (gro->pkt != NULL && tcp_gro_match(gro, pkt, &seg) &&
+	    tcp_gro_merge(gro, pkt, &seg) == 0) {
+		/* A pushed or a short segment ends the data sent at once */
+		if ((flags & PSH) || seg.len < gro->seg_len ||
+		    gro->segs >= CONFIG_NET_TCP_GRO_MAX_SEGS) {
+			net_tcp_gro_flush(gro);
+		}
+
+		return NET_OK;
+	}
+
+	net_tcp_gro_flush(gro);
+
+	if ((flags & PSH) || !tcp_gro_is_local(&seg)) {
+		return NET_CONTINUE;
+	}
+
+	tcp_gro_hold(gro, pkt, &seg, is_loopback);
+
+	return NET_OK;
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Generic segmentation offload, split a TCP packet into MSS sized segments
+ * just before it is handed to the driver.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+#include "ipv4.h"
+#include "ipv6.h"
+#include "tcp_internal.h"
+
+/* Timeout for the allocation of the segments */
+#define NET_BUF_TIMEOUT K_MSEC(100)
+
+static int tcp_gso_hdr_len(struct net_pkt *pkt)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	size_t ip_hdr_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	struct net_tcp_hdr *tcp_hdr;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, ip_hdr_len)) {
+		return -ENOBUFS;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data(pkt, &tcp_access);
+	if (!tcp_hdr) {
+		return -ENOBUFS;
+	}
+
+	return ip_hdr_len + (tcp_hdr->offset >> 4) * 4U;
+}
+
+/* Fix the headers copied from the original packet */
+static int tcp_gso_finalize(struct net_pkt *seg, uint32_t offset, bool last)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	struct net_tcp_hdr *tcp_hdr;
+
+	net_pkt_cursor_init(seg);
+	net_pkt_set_overwrite(seg, true);
+
+	if (net_pkt_skip(seg, net_pkt_ip_hdr_len(seg) + net_pkt_ip_opts_len(seg))) {
+		return -ENOBUFS;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data(seg, &tcp_access);
+	if (!tcp_hdr) {
+		return -ENOBUFS;
+	}
+
+	sys_put_be32(sys_get_be32(tcp_hdr->seq) + offset, tcp_hdr->seq);
+
+	/* Only the last segment ends the data of the packet */
+	if (!last) {
+		tcp_hdr->flags &= ~(FIN | PSH);
+	}
+
+	net_pkt_set_data(seg, &tcp_access);
+	net_pkt_cursor_init(seg);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(seg) == AF_INET) {
+		NET_IPV4_HDR(seg)->chksum = 0U;
+
+		return net_ipv4_finalize(seg, IPPROTO_TCP);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(seg) == AF_INET6) {
+		return net_ipv6_finalize(seg, IPPROTO_TCP);
+	}
+
+	return -EINVAL;
+}
+
+static struct net_pkt *tcp_gso_segment(struct net_pkt *pkt, size_t hdr_len,
+				       uint32_t offset, size_t len, bool last)
+{
+	struct net_pkt *seg;
+
+	seg = net_pkt_alloc_with_buffer(net_pkt_iface(pkt), hdr_len + len,
+					AF_UNSPEC, 0, NET_BUF_TIMEOUT);
+	if (!seg) {
+		return NULL;
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_copy(seg, pkt, hdr_len) ||
+	    net_pkt_skip(pkt, offset) ||
+	    net_pkt_copy(seg, pkt, len)) {
+		goto fail;
+	}
+
+	net_pkt_copy_attributes(pkt, seg);
+	net_pkt_set_gso_size(seg, 0U);
+
+	if (tcp_gso_finalize(seg, offset, last) < 0) {
+		goto fail;
+	}
+
+	net_pkt_cursor_init(seg);
+
+	return seg;
+
+fail:
+	net_pkt_unref(seg);
+
+	return NULL;
+}
+
+int net_tcp_gso_send(struct net_if *iface, struct net_pkt *pkt,
+		     int (*send)(struct net_if *iface, struct net_pkt *pkt))
+{
+	size_t mss = net_pkt_gso_size(pkt);
+	size_t payload_len;
+	uint32_t offset;
+	int hdr_len;
+	int sent = 0;
+	int ret;
+
+	hdr_len = tcp_gso_hdr_len(pkt);
+	if (hdr_len < 0) {
+		return hdr_len;
+	}
+
+	payload_len = net_pkt_get_len(pkt) - hdr_len;
+
+	for (offset = 0U; offset < payload_len; offset += mss) {
+		size_t len = MIN(mss, payload_len - offset);
+		struct net_pkt *seg;
+
+		seg = tcp_gso_segment(pkt, hdr_len, offset, len,
+				      offset + len == payload_len);
+		if (!seg) {
+			NET_DBG("pkt %p cannot allocate segment at %u", pkt, offset);
+			return -ENOMEM;
+		}
+
+		ret = send(iface, seg);
+		if (ret < 0) {
+			net_pkt_unref(seg);
+			return ret;
+		}
+
+		sent += ret;
+	}
+
+	NET_DBG("pkt %p sent as %zu segments", pkt, DIV_ROUND_UP(payload_len, mss));
+
+	net_pkt_unref(pkt);
+
+	return sent;
+}
@@ -36,6 +36,7 @@ enum tcp_conn_option {
 	TCP_OPT_KEEPIDLE = 3,
 	TCP_OPT_KEEPINTVL = 4,
 	TCP_OPT_KEEPCNT = 5,
+	TCP_OPT_CONGESTION = 6,
 };
 
 /**
@@ -286,6 +287,104 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 }
 #endif
 
+/** Longest headers of a TCP segment, IPv6 and TCP with options */
+#define NET_TCP_GRO_HDR_MAX (sizeof(struct net_ipv6_hdr) + 60)
+
+/**
+ * @brief Receive coalescing state of an RX queue
+ */
+struct net_tcp_gro {
+	/** Packet being coalesced, not passed up the stack yet */
+	struct net_pkt *pkt;
+	/** Copy of its IP and TCP headers */
+	uint8_t hdr[NET_TCP_GRO_HDR_MAX];
+	/** Length of the IP header and of both headers */
+	uint8_t ip_hdr_len;
+	uint8_t hdr_len;
+	/** Payload length of the first segment */
+	uint16_t seg_len;
+	/** Total payload length */
+	uint16_t len;
+	/** Number of segments merged */
+	uint8_t segs;
+	/** Was the packet received from the loopback interface */
+	bool is_loopback;
+};
+
+/**
+ * @brief Send a packet holding several TCP segments
+ *
+ * @details The packet is split into segments of net_pkt_gso_size()
+ * bytes of payload, each of them being given to the send function.
+ * Both this function and the send function follow the convention of
+ * the L2 send: the packet is released on success only.
+ *
+ * @param iface Network interface the packet is sent to
+ * @param pkt Network packet
+ * @param send Function sending one segment
+ *
+ * @return Number of bytes sent on success, negative errno otherwise.
+ */
+#if defined(CONFIG_NET_TCP_GSO)
+int net_tcp_gso_send(struct net_if *iface, struct net_pkt *pkt,
+		     int (*send)(struct net_if *iface, struct net_pkt *pkt));
+#else
+static inline int net_tcp_gso_send(struct net_if *iface, struct net_pkt *pkt,
+				   int (*send)(struct net_if *iface,
+					       struct net_pkt *pkt))
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(send);
+
+	return -ENOTSUP;
+}
+#endif
+
+/**
+ * @brief Coalesce a received TCP segment
+ *
+ * @details Called with packets whose L2 header has been handled. The
+ * packet is merged with the one held if it is the next segment of the
+ * same flow, otherwise the held packet is passed up the stack first.
+ *
+ * @param gro Coalescing state of the RX queue
+ * @param pkt Network packet
+ * @param is_loopback Packet was received from the loopback interface
+ *
+ * @return NET_OK if the packet was held or merged, NET_CONTINUE if the
+ * caller should pass it up the stack.
+ */
+#if defined(CONFIG_NET_TCP_GRO)
+enum net_verdict net_tcp_gro_receive(struct net_tcp_gro *gro,
+				     struct net_pkt *pkt, bool is_loopback);
+#else
+static inline enum net_verdict net_tcp_gro_receive(struct net_tcp_gro *gro,
+						   struct net_pkt *pkt,
+						   bool is_loopback)
+{
+	ARG_UNUSED(gro);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(is_loopback);
+
+	return NET_CONTINUE;
+}
+#endif
+
+/**
+ * @brief Pass the coalesced packet, if any, up the stack
+ *
+ * @param gro Coalescing state of the RX queue
+ */
+#if defined(CONFIG_NET_TCP_GRO)
+void net_tcp_gro_flush(struct net_tcp_gro *gro);
+#else
+static inline void net_tcp_gro_flush(struct net_tcp_gro *gro)
+{
+	ARG_UNUSED(gro);
+}
+#endif
+
 /**
  * @brief Enqueue data for transmission
  *
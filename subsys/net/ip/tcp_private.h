@@ -227,28 +227,167 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_SIZE         2 /* Without the blocks */
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* Maximum number of blocks in a SACK option, as 4 blocks and the two
+ * NOPs aligning them use 36 of the 40 bytes of TCP options.
+ */
+#define NET_TCP_SACK_MAX_BLOCKS 4
+
+struct tcp_sack_block {
+	uint32_t left;  /* First sequence number of the block */
+	uint32_t right; /* Sequence number following the block */
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block sack[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t sack_blocks;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_perm_found : 1;
+#endif
+};
+
+#ifdef CONFIG_NET_TCP_SACK
+
+enum tcp_seg_flags {
+	TCP_SEG_SACKED  = BIT(0), /* Selectively acknowledged by the peer */
+	TCP_SEG_LOST    = BIT(1), /* Deemed lost, to be retransmitted */
+	TCP_SEG_RETRANS = BIT(2), /* Retransmitted at least once */
+};
+
+/* Data sent and not cumulatively acknowledged yet */
+struct tcp_seg {
+	uint32_t seq;
+	uint32_t sent; /* Uptime of the last transmission, in ms */
+	uint16_t len;
+	uint8_t flags;
+};
+
+struct tcp_sack {
+	/* Scoreboard: ring of the segments in flight, in sequence order */
+	struct tcp_seg segs[CONFIG_NET_TCP_SACK_SEGMENTS];
+	uint32_t recovery_point; /* Loss recovery ends once this is acked */
+	uint32_t recv_seq; /* Latest out of order data received */
+#ifdef CONFIG_NET_TCP_RACK
+	uint32_t rack_sent; /* Latest send time of the delivered segments */
+	uint32_t rack_end;  /* End of the segment sent at rack_sent */
+	uint32_t rack_rtt;  /* RTT of the segment sent at rack_sent */
+	uint32_t min_rtt;
+	uint32_t srtt;
+#endif
+	uint8_t first;
+	uint8_t count;
+	bool in_recovery : 1;
+#ifdef CONFIG_NET_TCP_RACK
+	bool rack_valid : 1;
+	bool rtt_valid : 1;
+	bool reo_timeout : 1; /* rack_timer is the reordering timer */
+	bool tlp_sent : 1;
+#endif
 };
+#endif /* CONFIG_NET_TCP_SACK */
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
+/* Define the number of MSS sections the congestion window is initialized at */
+#define TCP_CONGESTION_INITIAL_WIN 1
+#define TCP_CONGESTION_INITIAL_SSTHRESH 3
+
+/* Maximum length of a congestion control algorithm name, as Linux */
+#define TCP_CA_NAME_MAX 16
+
+/* Timestamp in microseconds used by the congestion control algorithms */
+#define tcp_ca_now_us() ((uint32_t)k_ticks_to_us_floor64(k_uptime_ticks()))
+
 struct tcp_collision_avoidance_reno {
 	uint16_t cwnd;
 	uint16_t ssthresh;
 	uint16_t pending_fast_retransmit_bytes;
 };
+
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+struct tcp_ca_cubic {
+	uint32_t epoch_start; /* Start of the congestion avoidance epoch (ms) */
+	uint32_t k;           /* Time to grow back to w_max in the epoch (ms) */
+	uint32_t min_rtt;     /* us, 0 if not measured yet */
+	uint32_t cwnd_acc;    /* Remainders of the window increments */
+	uint32_t est_acc;
+	uint16_t w_max;       /* Window before the last congestion event */
+	uint16_t origin;      /* Window the cubic function plateaus at */
+	uint16_t w_est;       /* Window Reno would have */
+	bool in_epoch : 1;
+};
+#endif
+
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+enum tcp_bbr_mode {
+	TCP_BBR_STARTUP,
+	TCP_BBR_DRAIN,
+	TCP_BBR_PROBE_BW,
+	TCP_BBR_PROBE_RTT,
+};
+
+struct tcp_ca_bbr {
+	uint32_t bw;             /* Max delivery rate of the last rounds (B/s) */
+	uint32_t full_bw;        /* Delivery rate of the last full pipe check */
+	uint32_t min_rtt;        /* us */
+	uint32_t min_rtt_stamp;  /* us */
+	uint32_t round_start;    /* us */
+	uint32_t round_end_seq;  /* The round ends once it is acknowledged */
+	uint32_t delivered;      /* Bytes acknowledged in the round */
+	uint32_t cycle_stamp;    /* us */
+	uint32_t probe_rtt_done; /* us */
+	uint16_t prior_cwnd;
+	uint8_t mode;
+	uint8_t bw_rounds;       /* Rounds since bw was sampled */
+	uint8_t full_bw_cnt;
+	uint8_t cycle_idx;
+	bool min_rtt_valid : 1;
+	bool full_bw_reached : 1;
+	bool probe_rtt_pending : 1; /* probe_rtt_done is set */
+	bool app_limited : 1;       /* The round did not use the whole window */
+};
+#endif
+
+struct tcp;
+
+/* Congestion control algorithm, the window is kept in struct tcp ca.cwnd */
+struct tcp_ca_ops {
+	const char *name;
+	void (*init)(struct tcp *conn);
+	void (*fast_retransmit)(struct tcp *conn);
+	void (*timeout)(struct tcp *conn);
+	void (*dup_ack)(struct tcp *conn);
+	/* Called before the acknowledged data is removed from the send queue */
+	void (*pkts_acked)(struct tcp *conn, uint32_t acked_len);
+	/* Optional, RTT in us of a segment acknowledged without ambiguity */
+	void (*rtt_sample)(struct tcp *conn, uint32_t rtt);
+};
+
+extern const struct tcp_ca_ops tcp_ca_new_reno;
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+extern const struct tcp_ca_ops tcp_ca_cubic;
+#endif
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+extern const struct tcp_ca_ops tcp_ca_bbr;
 #endif
+#endif /* CONFIG_NET_TCP_CONGESTION_AVOIDANCE */
 
 struct tcp;
 typedef void (*net_tcp_closed_cb_t)(struct tcp *conn, void *user_data);
@@ -282,6 +421,9 @@ struct tcp { /* TCP connection */
 	struct k_work_delayable timewait_timer;
 	struct k_work_delayable persist_timer;
 	struct k_work_delayable ack_timer;
+#if defined(CONFIG_NET_TCP_RACK)
+	struct k_work_delayable rack_timer;
+#endif /* CONFIG_NET_TCP_RACK */
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
 	struct k_work_delayable keepalive_timer;
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
@@ -323,6 +465,22 @@ struct tcp { /* TCP connection */
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 	struct tcp_collision_avoidance_reno ca;
+	const struct tcp_ca_ops *ca_ops;
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC) || defined(CONFIG_NET_TCP_CONGESTION_BBR)
+	union {
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+		struct tcp_ca_cubic cubic;
+#endif
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+		struct tcp_ca_bbr bbr;
+#endif
+	} ca_priv;
+#endif
+	uint32_t ca_rtt_seq; /* The RTT is measured once this is acknowledged */
+	uint32_t ca_rtt_start;
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack sack;
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
@@ -337,6 +495,9 @@ struct tcp { /* TCP connection */
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
 	bool tcp_nodelay : 1;
 	bool addr_ref_done : 1;
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+	bool ca_rtt_pending : 1;
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
@@ -420,6 +420,25 @@ static void print_tc_rx_stats(const struct shell *sh, struct net_if *iface)
 #endif /* NET_TC_RX_COUNT > 1 */
 }
 
+static void print_tc_rx_flow_stats(const struct shell *sh, struct net_if *iface)
+{
+#if NET_TC_RX_FLOW_COUNT > 1
+	int i;
+
+	PR("RX best effort queue statistics:\n");
+	PR("Queue\tRecv pkts\tbytes\n");
+
+	for (i = 0; i < NET_TC_RX_FLOW_COUNT; i++) {
+		PR("[%d]\t%d\t\t%d\n", i,
+		   GET_STAT(iface, rx_flow[i].pkts),
+		   GET_STAT(iface, rx_flow[i].bytes));
+	}
+#else
+	ARG_UNUSED(sh);
+	ARG_UNUSED(iface);
+#endif
+}
+
 static void print_net_pm_stats(const struct shell *sh, struct net_if *iface)
 {
 #if defined(CONFIG_NET_STATISTICS_POWER_MANAGEMENT)
@@ -544,6 +563,7 @@ static void net_shell_print_statistics(struct net_if *iface, void *user_data)
 
 	print_tc_tx_stats(sh, iface);
 	print_tc_rx_stats(sh, iface);
+	print_tc_rx_flow_stats(sh, iface);
 
 #if defined(CONFIG_NET_STATISTICS_ETHERNET) && \
 					defined(CONFIG_NET_STATISTICS_USER_API)
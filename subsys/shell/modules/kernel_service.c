@@ -300,6 +300,131 @@ static int cmd_kernel_heap(const struct shell *sh,
 }
 #endif
 
+#if defined(CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS) && defined(CONFIG_OBJ_CORE_STATS)
+struct shell_latency_data {
+	const struct shell *sh;
+	const char *type_name;
+};
+
+static uint32_t shell_hist_total(const struct k_usage_hist *hist)
+{
+	uint32_t total = 0U;
+
+	for (int i = 0; i < K_USAGE_HIST_BUCKETS; i++) {
+		total += hist->buckets[i];
+	}
+
+	return total;
+}
+
+static void shell_hist_print(const struct shell *sh, const char *name,
+			     const struct k_usage_hist *hist)
+{
+	if (shell_hist_total(hist) == 0U) {
+		return;
+	}
+
+	shell_fprintf(sh, SHELL_NORMAL, "\t%-12s", name);
+	for (int i = 0; i < K_USAGE_HIST_BUCKETS; i++) {
+		if (hist->buckets[i] != 0U) {
+			shell_fprintf(sh, SHELL_NORMAL, " 2^%d:%u", i,
+				      hist->buckets[i]);
+		}
+	}
+	shell_fprintf(sh, SHELL_NORMAL, "\n");
+}
+
+#ifdef CONFIG_OBJ_CORE_STATS_THREAD
+static int shell_thread_latency(struct k_obj_core *obj_core, void *user_data)
+{
+	const struct shell *sh = user_data;
+	struct k_thread *thread = CONTAINER_OF(obj_core, struct k_thread,
+					       obj_core);
+	struct k_cycle_stats stats;
+	const char *tname;
+
+	if (k_obj_core_stats_raw(obj_core, &stats, sizeof(stats)) != 0) {
+		return 0;
+	}
+
+	tname = k_thread_name_get(thread);
+
+	shell_print(sh, "thread %p %s", thread, tname ? tname : "NA");
+	shell_hist_print(sh, "ready->run", &stats.sched_delay);
+	shell_hist_print(sh, "run slice", &stats.run_slice);
+
+	return 0;
+}
+#endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+static int shell_waitq_latency(struct k_obj_core *obj_core, void *user_data)
+{
+	const struct shell_latency_data *data = user_data;
+	struct k_usage_hist hist;
+
+	if ((k_obj_core_stats_raw(obj_core, &hist, sizeof(hist)) != 0) ||
+	    (shell_hist_total(&hist) == 0U)) {
+		return 0;
+	}
+
+	shell_print(data->sh, "%s %p", data->type_name,
+		    (char *)obj_core - obj_core->type->obj_core_offset);
+	shell_hist_print(data->sh, "blocked", &hist);
+
+	return 0;
+}
+#endif
+
+static int cmd_kernel_latency(const struct shell *sh,
+			      size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	struct k_obj_type *type;
+
+	shell_print(sh, "Durations in cycles, as 2^<bucket>:<count>");
+
+#ifdef CONFIG_OBJ_CORE_STATS_THREAD
+	type = k_obj_type_find(K_OBJ_TYPE_THREAD_ID);
+	if (type != NULL) {
+		k_obj_type_walk_unlocked(type, shell_thread_latency,
+					 (void *)sh);
+	}
+#endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+	static const struct {
+		uint32_t id;
+		const char *name;
+	} waitq_types[] = {
+		{ K_OBJ_TYPE_MUTEX_ID, "mutex" },
+		{ K_OBJ_TYPE_SEM_ID, "sem" },
+		{ K_OBJ_TYPE_MSGQ_ID, "msgq" },
+		{ K_OBJ_TYPE_STACK_ID, "stack" },
+	};
+
+	for (int i = 0; i < ARRAY_SIZE(waitq_types); i++) {
+		struct shell_latency_data data = {
+			.sh = sh,
+			.type_name = waitq_types[i].name,
+		};
+
+		type = k_obj_type_find(waitq_types[i].id);
+		if (type != NULL) {
+			k_obj_type_walk_unlocked(type, shell_waitq_latency,
+						 &data);
+		}
+	}
+#endif
+
+	ARG_UNUSED(type);
+
+	return 0;
+}
+#endif
+
 static int cmd_kernel_sleep(const struct shell *sh,
 			    size_t argc, char **argv)
 {
@@ -400,6 +525,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
 #endif
 #if defined(CONFIG_SYS_HEAP_RUNTIME_STATS) && (K_HEAP_MEM_POOL_SIZE > 0)
 	SHELL_CMD(heap, NULL, "System heap usage statistics.", cmd_kernel_heap),
+#endif
+#if defined(CONFIG_SCHED_THREAD_USAGE_HISTOGRAMS) && defined(CONFIG_OBJ_CORE_STATS)
+	SHELL_CMD(latency, NULL, "Scheduling latency histograms.",
+		  cmd_kernel_latency),
 #endif
 	SHELL_CMD_ARG(uptime, NULL, "Kernel uptime. Can be called with the -p or --pretty options",
 		      cmd_kernel_uptime, 1, 1),
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/sys_heap.h>
+
+/* Fragmentation and latency of sys_heap under a mixed-size workload.
+ * Run the plain and "tlsf" variants to compare the bucket search of the
+ * default allocator with the two-level segregated fit mode.
+ */
+
+#define HEAP_SIZE     (64 * 1024)
+#define MAX_BLOCKS    512
+#define NUM_OPS       20000
+#define FILL_PERCENT  80
+#define SAMPLE_PERIOD 1000
+
+static uint8_t heap_mem[HEAP_SIZE] __aligned(8);
+static struct sys_heap test_heap;
+static void *blocks[MAX_BLOCKS];
+
+struct op_stats {
+	uint64_t sum;
+	uint32_t max;
+	uint32_t count;
+};
+
+/* Same LCRNG as lib/heap/heap_stress.c, for repeatable sequences */
+static uint32_t rand32(void)
+{
+	static uint64_t state = 123456789;
+
+	state = state * 2862933555777941757UL + 3037000493UL;
+
+	return (uint32_t)(state >> 32);
+}
+
+/* Mostly small blocks with a long tail of larger ones, as seen by
+ * typical buffer and object allocations.
+ */
+static size_t rand_size(void)
+{
+	uint32_t r = rand32();
+
+	switch (r % 8U) {
+	case 0:
+		return 256U + (r >> 8) % 2048U;
+	case 1:
+	case 2:
+		return 64U + (r >> 8) % 192U;
+	default:
+		return 8U + (r >> 8) % 56U;
+	}
+}
+
+static void record(struct op_stats *s, uint32_t start)
+{
+	uint32_t cycles = k_cycle_get_32() - start;
+
+	s->sum += cycles;
+	s->max = MAX(s->max, cycles);
+	s->count++;
+}
+
+/* Largest block that can currently be allocated */
+static size_t largest_free_block(void)
+{
+	size_t lo = 0;
+	size_t hi = HEAP_SIZE;
+
+	while (lo < hi) {
+		size_t mid = (lo + hi + 1) / 2;
+		void *p = sys_heap_alloc(&test_heap, mid);
+
+		if (p != NULL) {
+			sys_heap_free(&test_heap, p);
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	return lo;
+}
+
+ZTEST(heap_perf, test_heap_mixed_sizes)
+{
+	struct op_stats alloc_stats = {0};
+	struct op_stats free_stats = {0};
+	struct sys_memory_stats mem;
+	uint32_t failed = 0;
+	uint32_t frag_sum = 0;
+	uint32_t frag_max = 0;
+	uint32_t samples = 0;
+	uint32_t start;
+
+	sys_heap_init(&test_heap, heap_mem, sizeof(heap_mem));
+
+	for (uint32_t i = 0; i < NUM_OPS; i++) {
+		uint32_t idx = rand32() % MAX_BLOCKS;
+
+		sys_heap_runtime_stats_get(&test_heap, &mem);
+
+		if (blocks[idx] != NULL) {
+			start = k_cycle_get_32();
+			sys_heap_free(&test_heap, blocks[idx]);
+			record(&free_stats, start);
+			blocks[idx] = NULL;
+		} else if (mem.allocated_bytes * 100U < HEAP_SIZE * FILL_PERCENT) {
+			size_t sz = rand_size();
+
+			start = k_cycle_get_32();
+			blocks[idx] = sys_heap_alloc(&test_heap, sz);
+			record(&alloc_stats, start);
+			if (blocks[idx] == NULL) {
+				failed++;
+			}
+		}
+
+		/* Fragmentation as the share of free memory that cannot
+		 * be allocated as a single block, in percent.
+		 */
+		if ((i % SAMPLE_PERIOD) == (SAMPLE_PERIOD - 1)) {
+			size_t largest = largest_free_block();
+			uint32_t frag;
+
+			sys_heap_runtime_stats_get(&test_heap, &mem);
+			frag = (mem.free_bytes == 0U) ? 0U :
+			       100U - (uint32_t)(largest * 100U / mem.free_bytes);
+			frag_sum += frag;
+			frag_max = MAX(frag_max, frag);
+			samples++;
+		}
+	}
+
+	zassert_true(sys_heap_validate(&test_heap), "heap is corrupted");
+
+	TC_PRINT("heap %s\n", IS_ENABLED(CONFIG_SYS_HEAP_TLSF) ? "tlsf" : "buckets");
+	TC_PRINT("alloc cycles avg %llu max %u (%u ops, %u failed)\n",
+		 alloc_stats.sum / MAX(alloc_stats.count, 1U), alloc_stats.max,
+		 alloc_stats.count, failed);
+	TC_PRINT("free cycles avg %llu max %u (%u ops)\n",
+		 free_stats.sum / MAX(free_stats.count, 1U), free_stats.max,
+		 free_stats.count);
+	TC_PRINT("fragmentation avg %u%% max %u%%\n",
+		 frag_sum / MAX(samples, 1U), frag_max);
+}
+
+ZTEST_SUITE(heap_perf, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/printk.h>
+
+/* Multi-thread k_heap throughput test.  Two threads per CPU, all at the
+ * same preemptible priority, run sys_heap_stress() against a shared
+ * k_heap, each within its own share of the heap.  The random number
+ * generator of the stress rig is shared by all threads, so the exact
+ * sequence of operations is not repeatable, which does not matter for
+ * a throughput measurement.
+ */
+
+#define THREADS_PER_CPU 2
+#define N_THREADS       (THREADS_PER_CPU * CONFIG_MP_MAX_NUM_CPUS)
+#define HEAP_SIZE       (32 * 1024)
+#define OPS_PER_THREAD  20000
+#define TARGET_PERCENT  50
+#define MAX_BLOCKS      128
+#define STACK_SIZE      (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* Mirrors the block record of lib/heap/heap_stress.c for sizing */
+struct stress_block {
+	void *ptr;
+	size_t sz;
+};
+
+K_HEAP_DEFINE(bench_heap, HEAP_SIZE);
+
+#ifdef CONFIG_HEAP_MAGAZINES
+static struct k_heap_cache bench_cache;
+#endif
+
+static K_THREAD_STACK_ARRAY_DEFINE(stress_stacks, N_THREADS, STACK_SIZE);
+static struct k_thread stress_threads[N_THREADS];
+static struct stress_block scratch[N_THREADS][MAX_BLOCKS];
+static struct z_heap_stress_result results[N_THREADS];
+static size_t share_bytes;
+
+static void *bench_alloc(void *arg, size_t bytes)
+{
+	return k_heap_alloc(arg, bytes, K_NO_WAIT);
+}
+
+static void bench_free(void *arg, void *p)
+{
+	k_heap_free(arg, p);
+}
+
+static void stress_fn(void *arg1, void *arg2, void *arg3)
+{
+	uintptr_t i = (uintptr_t)arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	sys_heap_stress(bench_alloc, bench_free, &bench_heap, share_bytes,
+			OPS_PER_THREAD, scratch[i], sizeof(scratch[i]),
+			TARGET_PERCENT, &results[i]);
+}
+
+int main(void)
+{
+	unsigned int num_threads = THREADS_PER_CPU * arch_num_cpus();
+	int prio = k_thread_priority_get(k_current_get()) + 1;
+	uint64_t ops = 0U;
+	int64_t start;
+	int64_t ms;
+
+#ifdef CONFIG_HEAP_MAGAZINES
+	k_heap_cache_attach(&bench_heap, &bench_cache);
+#endif
+
+	share_bytes = HEAP_SIZE / num_threads;
+
+	start = k_uptime_get();
+	for (unsigned int i = 0; i < num_threads; i++) {
+		k_thread_create(&stress_threads[i], stress_stacks[i],
+				K_THREAD_STACK_SIZEOF(stress_stacks[i]),
+				stress_fn, (void *)(uintptr_t)i, NULL, NULL,
+				prio, 0, K_NO_WAIT);
+	}
+
+	for (unsigned int i = 0; i < num_threads; i++) {
+		k_thread_join(&stress_threads[i], K_FOREVER);
+		ops += results[i].total_allocs + results[i].total_frees;
+	}
+	ms = MAX(k_uptime_get() - start, 1);
+
+	printk("heap cpus %u threads %u ops %llu ops/ms %llu\n",
+	       arch_num_cpus(), num_threads, ops, ops / (uint64_t)ms);
+
+#ifdef CONFIG_HEAP_MAGAZINES
+	struct k_heap_cache_stats stats;
+
+	(void)k_heap_cache_stats_get(&bench_heap, &stats);
+	printk("cache alloc hits %llu misses %llu free hits %llu "
+	       "refills %llu flushes %llu\n",
+	       stats.alloc_hits, stats.alloc_misses, stats.free_hits,
+	       stats.refills, stats.flushes);
+#endif
+
+	printk("fin\n");
+	return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time to wake many threads at once
+ *
+ * This file contains the tests that measure the time taken by a
+ * k_condvar_broadcast() and a k_event_post() to wake
+ * CONFIG_BENCHMARK_NUM_WAITERS threads.  The scheduler is locked while
+ * measuring so that the time to run the woken threads is not included.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+
+#define NUM_WAITERS CONFIG_BENCHMARK_NUM_WAITERS
+#define WAITER_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_ARRAY_DEFINE(waiter_stacks, NUM_WAITERS,
+				   WAITER_STACK_SIZE);
+static struct k_thread waiter_threads[NUM_WAITERS];
+
+static K_CONDVAR_DEFINE(bcast_condvar);
+static K_MUTEX_DEFINE(bcast_mutex);
+static K_EVENT_DEFINE(bcast_event);
+
+static void condvar_waiter(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_mutex_lock(&bcast_mutex, K_FOREVER);
+	while (true) {
+		k_condvar_wait(&bcast_condvar, &bcast_mutex, K_FOREVER);
+	}
+}
+
+static void event_waiter(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_event_wait(&bcast_event, BIT(0), true, K_FOREVER);
+	}
+}
+
+/*
+ * The waiters have a higher priority than the measuring thread, so they
+ * have all pended again by the time it runs after k_sched_unlock().
+ */
+static void start_waiters(k_thread_entry_t entry)
+{
+	int priority = k_thread_priority_get(k_current_get()) - 1;
+
+	for (uint32_t i = 0; i < NUM_WAITERS; i++) {
+		k_thread_create(&waiter_threads[i], waiter_stacks[i],
+				K_THREAD_STACK_SIZEOF(waiter_stacks[i]),
+				entry, NULL, NULL, NULL,
+				priority, 0, K_NO_WAIT);
+	}
+}
+
+static void stop_waiters(void)
+{
+	for (uint32_t i = 0; i < NUM_WAITERS; i++) {
+		k_thread_abort(&waiter_threads[i]);
+	}
+}
+
+void broadcast_ops(uint32_t num_iterations)
+{
+	timing_t  start;
+	timing_t  finish;
+	uint64_t  sum_condvar = 0ULL;
+	uint64_t  sum_event = 0ULL;
+	uint32_t  i;
+	char      description[120];
+
+	timing_start();
+
+	start_waiters(condvar_waiter);
+	for (i = 0; i < num_iterations; i++) {
+		k_sched_lock();
+		start = timing_timestamp_get();
+		k_condvar_broadcast(&bcast_condvar);
+		finish = timing_timestamp_get();
+		k_sched_unlock();
+
+		sum_condvar += timing_cycles_get(&start, &finish);
+	}
+	stop_waiters();
+
+	start_waiters(event_waiter);
+	for (i = 0; i < num_iterations; i++) {
+		k_sched_lock();
+		start = timing_timestamp_get();
+		k_event_post(&bcast_event, BIT(0));
+		finish = timing_timestamp_get();
+		k_sched_unlock();
+
+		sum_event += timing_cycles_get(&start, &finish);
+	}
+	stop_waiters();
+
+	timing_stop();
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Broadcast a condvar (%u waiters)",
+		 "condvar.broadcast.wake", NUM_WAITERS);
+	PRINT_STATS_AVG(description, (uint32_t)sum_condvar, num_iterations,
+			false, "");
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Post an event (%u waiters)",
+		 "events.post.wake", NUM_WAITERS);
+	PRINT_STATS_AVG(description, (uint32_t)sum_event, num_iterations,
+			false, "");
+}
@@ -59,6 +59,8 @@ extern int stack_ops(uint32_t num_iterations, uint32_t options);
 extern int stack_blocking_ops(uint32_t num_iterations, uint32_t start_options,
 			       uint32_t alt_options);
 extern void heap_malloc_free(void);
+extern void timeout_arm_cancel(uint32_t num_iterations);
+extern void broadcast_ops(uint32_t num_iterations);
 
 static void test_thread(void *arg1, void *arg2, void *arg3)
 {
@@ -176,6 +178,10 @@ static void test_thread(void *arg1, void *arg2, void *arg3)
 
 	heap_malloc_free();
 
+	timeout_arm_cancel(CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	broadcast_ops(CONFIG_BENCHMARK_NUM_ITERATIONS);
+
 	TC_END_REPORT(error_count);
 }
 
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time to arm and cancel timeouts
+ *
+ * This file contains the tests that measure the time to add a timeout to
+ * and abort a timeout from a timeout queue that already holds
+ * CONFIG_BENCHMARK_NUM_TIMEOUTS armed timeouts.  This exposes the
+ * scaling of the selected CONFIG_TIMEOUT_QUEUE_* backend.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+
+#define NUM_TIMEOUTS CONFIG_BENCHMARK_NUM_TIMEOUTS
+
+static struct k_timer timers[NUM_TIMEOUTS];
+static struct k_timer bench_timer;
+
+/*
+ * Spread the armed timeouts over a wide range of expiry times so that
+ * insertion into a sorted queue has to walk past a variable number of
+ * them.  None of them is expected to expire while the benchmark runs.
+ */
+static k_timeout_t background_timeout(uint32_t i)
+{
+	return K_TICKS(1000000 + (i * 7919U) % (NUM_TIMEOUTS * 64U));
+}
+
+void timeout_arm_cancel(uint32_t num_iterations)
+{
+	timing_t  start;
+	timing_t  finish;
+	uint64_t  sum_start = 0ULL;
+	uint64_t  sum_stop = 0ULL;
+	uint32_t  i;
+	char      description[120];
+
+	for (i = 0; i < NUM_TIMEOUTS; i++) {
+		k_timer_init(&timers[i], NULL, NULL);
+		k_timer_start(&timers[i], background_timeout(i), K_NO_WAIT);
+	}
+	k_timer_init(&bench_timer, NULL, NULL);
+
+	timing_start();
+
+	for (i = 0; i < num_iterations; i++) {
+		k_timeout_t timeout = background_timeout(i * 31U);
+
+		start = timing_timestamp_get();
+		k_timer_start(&bench_timer, timeout, K_NO_WAIT);
+		finish = timing_timestamp_get();
+		sum_start += timing_cycles_get(&start, &finish);
+
+		start = timing_timestamp_get();
+		k_timer_stop(&bench_timer);
+		finish = timing_timestamp_get();
+		sum_stop += timing_cycles_get(&start, &finish);
+	}
+
+	timing_stop();
+
+	for (i = 0; i < NUM_TIMEOUTS; i++) {
+		k_timer_stop(&timers[i]);
+	}
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Arm a timeout (%u armed)",
+		 "timeout.add.immediate", NUM_TIMEOUTS);
+	PRINT_STATS_AVG(description, (uint32_t)sum_start, num_iterations,
+			false, "");
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Abort a timeout (%u armed)",
+		 "timeout.abort.immediate", NUM_TIMEOUTS);
+	PRINT_STATS_AVG(description, (uint32_t)sum_stop, num_iterations,
+			false, "");
+}
@@ -29,6 +29,8 @@
  * average for all cycles run.
  */
 
+extern void smp_switch_throughput(void);
+
 #define N_RUNS 1000
 #define N_SETTLE 10
 
@@ -88,6 +90,55 @@ static void partner_fn(void *arg1, void *arg2, void *arg3)
 	}
 }
 
+#ifdef CONFIG_SCHED_DEADLINE
+/* Deadline load test: N_DL_THREADS threads of the same priority sit
+ * in the ready queue (at a priority below main, so they never run
+ * during the test) while main keeps moving their deadlines forward
+ * with k_thread_deadline_set(), as periodic EDF work does.  Each call
+ * removes the thread from the ready queue and re-adds it at its new
+ * deadline position, exercising the backend's add/remove paths with
+ * a populated priority level.
+ */
+#define N_DL_THREADS 16
+#define N_DL_RUNS    1000
+
+static K_THREAD_STACK_ARRAY_DEFINE(dl_stacks, N_DL_THREADS, 512);
+static struct k_thread dl_threads[N_DL_THREADS];
+
+static void dl_fn(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+}
+
+static void deadline_load(void)
+{
+	int prio = k_thread_priority_get(k_current_get()) + 1;
+	uint64_t tot = 0U;
+
+	for (int i = 0; i < N_DL_THREADS; i++) {
+		k_thread_create(&dl_threads[i], dl_stacks[i],
+				K_THREAD_STACK_SIZEOF(dl_stacks[i]),
+				dl_fn, NULL, NULL, NULL, prio, 0, K_NO_WAIT);
+		k_thread_deadline_set(&dl_threads[i], 1000 + i * 100);
+	}
+
+	for (int i = 0; i < N_DL_RUNS; i++) {
+		uint32_t start = _stamp(UNPENDING);
+
+		k_thread_deadline_set(&dl_threads[i % N_DL_THREADS],
+				      1000 + N_DL_THREADS * 100);
+		tot += _stamp(YIELDED) - start;
+	}
+
+	printk("deadline_set threads %d avg %d\n", N_DL_THREADS,
+	       (uint32_t)(tot / N_DL_RUNS));
+
+	/* The load threads run (and exit) once main is done */
+}
+#endif /* CONFIG_SCHED_DEADLINE */
+
 int main(void)
 {
 	z_waitq_init(&waitq);
@@ -150,6 +201,15 @@ int main(void)
 		       stamps[4] - stamps[3],
 		       whole, avg);
 	}
+
+#ifdef CONFIG_SCHED_DEADLINE
+	deadline_load();
+#endif /* CONFIG_SCHED_DEADLINE */
+
+	if (IS_ENABLED(CONFIG_SMP)) {
+		smp_switch_throughput();
+	}
+
 	printk("fin\n");
 	return 0;
 }
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* SMP context switch throughput test.  Two threads per CPU, all at the
+ * same preemptible priority, do nothing but k_yield() for a fixed
+ * amount of time.  The total number of yields completed is reported,
+ * which with an ideally scaling scheduler grows linearly with the
+ * number of CPUs.  Each thread counts in its own cache line to keep
+ * the counters themselves out of the measurement.
+ */
+
+#define THREADS_PER_CPU 2
+#define N_THREADS       (THREADS_PER_CPU * CONFIG_MP_MAX_NUM_CPUS)
+#define RUN_MS          1000
+#define STACK_SIZE      (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct yield_count {
+	uint32_t count;
+} __aligned(64);
+
+static K_THREAD_STACK_ARRAY_DEFINE(yield_stacks, N_THREADS, STACK_SIZE);
+static struct k_thread yield_threads[N_THREADS];
+static struct yield_count counts[N_THREADS];
+static volatile bool stop;
+
+static void yield_fn(void *arg1, void *arg2, void *arg3)
+{
+	struct yield_count *c = arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (!stop) {
+		k_yield();
+		c->count++;
+	}
+}
+
+void smp_switch_throughput(void)
+{
+	unsigned int num_threads = THREADS_PER_CPU * arch_num_cpus();
+	int prio = k_thread_priority_get(k_current_get()) + 1;
+	uint64_t total = 0U;
+
+	stop = false;
+	for (unsigned int i = 0; i < num_threads; i++) {
+		counts[i].count = 0U;
+		k_thread_create(&yield_threads[i], yield_stacks[i],
+				K_THREAD_STACK_SIZEOF(yield_stacks[i]),
+				yield_fn, &counts[i], NULL, NULL,
+				prio, 0, K_NO_WAIT);
+	}
+
+	k_msleep(RUN_MS);
+	stop = true;
+
+	for (unsigned int i = 0; i < num_threads; i++) {
+		k_thread_join(&yield_threads[i], K_FOREVER);
+		total += counts[i].count;
+	}
+
+	printk("smp cpus %u threads %u yields/s %llu (per cpu %llu)\n",
+	       arch_num_cpus(), num_threads,
+	       total * 1000U / RUN_MS,
+	       total * 1000U / RUN_MS / arch_num_cpus());
+}
@@ -117,6 +117,81 @@ static int exec_test(uint8_t nb_threads)
 }
 
 
+#ifdef CONFIG_DYNAMIC_OBJECTS
+#define NB_DYN_OBJECTS 40
+
+static void *dyn_objects[NB_DYN_OBJECTS];
+
+static void syscall_entry(void *_thread, void *_sem, void *p3)
+{
+	struct k_app_thread *thread = (struct k_app_thread *) _thread;
+	int ret;
+
+	struct k_mem_partition *parts[] = {
+		thread->partition,
+	};
+
+	ret = k_mem_domain_init(&thread->domain, ARRAY_SIZE(parts), parts);
+	if (ret != 0) {
+		printk("k_mem_domain_init failed %d\n", ret);
+		yielder_status = 1;
+		return;
+	}
+
+	k_mem_domain_add_thread(&thread->domain, k_current_get());
+
+	k_thread_user_mode_enter(syscall_sem_loop, _sem, NULL, NULL);
+}
+
+/* Time system calls on a semaphore allocated at runtime, among others
+ * allocated at runtime too: validating it is what dynamic objects cost.
+ */
+static int exec_syscall_test(void)
+{
+	struct k_sem *sem = NULL;
+	k_tid_t tid;
+
+	yielder_status = 0;
+
+	for (size_t i = 0; i < NB_DYN_OBJECTS; i++) {
+		dyn_objects[i] = k_object_alloc(K_OBJ_SEM);
+		if (dyn_objects[i] == NULL) {
+			printk("k_object_alloc failed\n");
+			return 1;
+		}
+		k_sem_init(dyn_objects[i], 0, 1);
+	}
+	sem = dyn_objects[NB_DYN_OBJECTS - 1];
+
+	app_threads[0].partition = app_partitions[0];
+	tid = k_thread_create(&app_threads[0].thread, app_thread_stacks[0],
+			      APP_STACKSIZE, syscall_entry,
+			      &app_threads[0], sem, NULL,
+			      THREADS_PRIO, 0, K_FOREVER);
+	k_object_access_grant(sem, tid);
+
+	k_thread_priority_set(k_current_get(), MAIN_PRIO);
+
+	stamp(MEAS_START);
+	k_thread_start(tid);
+	k_thread_join(tid, K_FOREVER);
+	stamp(MEAS_END);
+
+	uint32_t full_time = stamps[MEAS_END] - stamps[MEAS_START];
+	uint64_t time_ns = k_cyc_to_ns_near64(full_time) / (2 * NB_SYSCALLS);
+
+	printk("Syscalls on 1 of %d dynamic objects: %8" PRIu32 " cyc & %6" PRIu32
+	       " rounds -> %6" PRIu64 " ns per syscall\n", NB_DYN_OBJECTS,
+	       full_time, 2 * NB_SYSCALLS, time_ns);
+
+	for (size_t i = 0; i < NB_DYN_OBJECTS; i++) {
+		k_object_free(dyn_objects[i]);
+	}
+
+	return yielder_status;
+}
+#endif /* CONFIG_DYNAMIC_OBJECTS */
+
 int main(void)
 {
 	int ret;
@@ -136,6 +211,17 @@ int main(void)
 		}
 	}
 
+#ifdef CONFIG_DYNAMIC_OBJECTS
+	printk("============================\n");
+	printk("user syscalls on dynamic objects\n");
+
+	ret = exec_syscall_test();
+	if (ret != 0) {
+		printk("FAIL\n");
+		return 0;
+	}
+#endif /* CONFIG_DYNAMIC_OBJECTS */
+
 	printk("SUCCESS\n");
 	return 0;
 }
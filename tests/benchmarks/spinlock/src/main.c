@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* Spinlock throughput test.  One thread per CPU takes the shared lock
+ * OPS_PER_THREAD times, touching a cache line of shared data under the
+ * lock, and spins for a bit outside of it so that the lock is not
+ * always handed over to the same CPU.
+ */
+
+#define OPS_PER_THREAD  100000
+#define OUTSIDE_SPINS   16
+#define SHARED_WORDS    8
+#define STACK_SIZE      (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static struct k_spinlock bench_lock = K_SPINLOCK_MCS_INIT;
+static volatile uint32_t shared[SHARED_WORDS];
+
+static K_THREAD_STACK_ARRAY_DEFINE(bench_stacks, CONFIG_MP_MAX_NUM_CPUS,
+				   STACK_SIZE);
+static struct k_thread bench_threads[CONFIG_MP_MAX_NUM_CPUS];
+
+static void bench_fn(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	for (int i = 0; i < OPS_PER_THREAD; i++) {
+		K_SPINLOCK(&bench_lock) {
+			for (int j = 0; j < SHARED_WORDS; j++) {
+				shared[j]++;
+			}
+		}
+
+		for (volatile int j = 0; j < OUTSIDE_SPINS; j++) {
+		}
+	}
+}
+
+int main(void)
+{
+	unsigned int num_threads = arch_num_cpus();
+	int prio = k_thread_priority_get(k_current_get()) + 1;
+	uint64_t ops = (uint64_t)num_threads * OPS_PER_THREAD;
+	int64_t start;
+	int64_t ms;
+
+	start = k_uptime_get();
+	for (unsigned int i = 0; i < num_threads; i++) {
+		k_thread_create(&bench_threads[i], bench_stacks[i],
+				K_THREAD_STACK_SIZEOF(bench_stacks[i]),
+				bench_fn, NULL, NULL, NULL,
+				prio, 0, K_FOREVER);
+#ifdef CONFIG_SCHED_CPU_MASK
+		(void)k_thread_cpu_pin(&bench_threads[i], i);
+#endif
+		k_thread_start(&bench_threads[i]);
+	}
+
+	for (unsigned int i = 0; i < num_threads; i++) {
+		k_thread_join(&bench_threads[i], K_FOREVER);
+	}
+	ms = MAX(k_uptime_get() - start, 1);
+
+	if (shared[0] != (uint32_t)ops) {
+		printk("lost updates: %u of %llu\n", shared[0], ops);
+	}
+
+	printk("spinlock cpus %u ops %llu ops/ms %llu\n",
+	       num_threads, ops, ops / (uint64_t)ms);
+
+#ifdef CONFIG_MCS_SPINLOCK_STATS
+	struct k_spinlock_stats stats;
+
+	k_spin_stats_get(&bench_lock, &stats);
+	printk("stats acquisitions %llu contended %llu spins %llu\n",
+	       stats.acquisitions, stats.contended, stats.spins);
+#endif
+
+	printk("fin\n");
+	return 0;
+}
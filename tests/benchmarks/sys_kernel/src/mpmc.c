@@ -0,0 +1,169 @@
+/* mpmc.c */
+
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "syskernel.h"
+
+#define NUM_PRODUCERS 2
+#define NUM_CONSUMERS 2
+#define MPMC_CAPACITY 16
+
+K_THREAD_STACK_DEFINE(thread_stack3, STACK_SIZE);
+K_THREAD_STACK_DEFINE(thread_stack4, STACK_SIZE);
+static struct k_thread thread_data3;
+static struct k_thread thread_data4;
+
+static struct k_fifo mpmc_fifo;
+
+#ifdef CONFIG_FIFO_MPMC
+K_MPMC_DEFINE(mpmc_ring, MPMC_CAPACITY);
+#endif
+
+/* First word reserved for k_queue, second holds the sequence number */
+static intptr_t elements[NUMBER_OF_LOOPS][2];
+
+static atomic_t consumed;
+
+
+/**
+ *
+ * @brief Producer thread
+ *
+ * @param par1   Index of the producer.
+ * @param par2   Number of elements to put.
+ * @param par3   unused
+ *
+ */
+static void mpmc_producer(void *par1, void *par2, void *par3)
+{
+	int id = POINTER_TO_INT(par1);
+	int num_loops = POINTER_TO_INT(par2);
+
+	ARG_UNUSED(par3);
+
+	for (int i = id; i < num_loops; i += NUM_PRODUCERS) {
+		elements[i][1] = i;
+		k_fifo_put(&mpmc_fifo, elements[i]);
+	}
+}
+
+
+/**
+ *
+ * @brief Consumer thread
+ *
+ * @param par1   Address of the counter of elements received.
+ * @param par2   Number of elements to get.
+ * @param par3   unused
+ *
+ */
+static void mpmc_consumer(void *par1, void *par2, void *par3)
+{
+	int *pcounter = par1;
+	int num_loops = POINTER_TO_INT(par2);
+	intptr_t *pelement;
+
+	ARG_UNUSED(par3);
+
+	while (atomic_inc(&consumed) < num_loops) {
+		pelement = k_fifo_get(&mpmc_fifo, K_FOREVER);
+		if ((pelement[1] < 0) || (pelement[1] >= num_loops)) {
+			break;
+		}
+		(*pcounter)++;
+	}
+}
+
+
+/**
+ *
+ * @brief Run two producers and two consumers on mpmc_fifo
+ *
+ * @return number of elements received
+ */
+static int mpmc_run(void)
+{
+	k_thread_stack_t *stacks[] = {
+		thread_stack1, thread_stack2, thread_stack3, thread_stack4,
+	};
+	struct k_thread *threads[] = {
+		&thread_data1, &thread_data2, &thread_data3, &thread_data4,
+	};
+	int counters[NUM_CONSUMERS] = {0};
+	int i;
+
+	atomic_set(&consumed, 0);
+
+	for (i = 0; i < NUM_CONSUMERS; i++) {
+		k_thread_create(threads[i], stacks[i], STACK_SIZE,
+				mpmc_consumer, &counters[i],
+				INT_TO_POINTER(number_of_loops), NULL,
+				K_PRIO_COOP(3), 0, K_NO_WAIT);
+	}
+	for (i = 0; i < NUM_PRODUCERS; i++) {
+		k_thread_create(threads[NUM_CONSUMERS + i],
+				stacks[NUM_CONSUMERS + i], STACK_SIZE,
+				mpmc_producer, INT_TO_POINTER(i),
+				INT_TO_POINTER(number_of_loops), NULL,
+				K_PRIO_COOP(3), 0, K_NO_WAIT);
+	}
+	for (i = 0; i < NUM_CONSUMERS + NUM_PRODUCERS; i++) {
+		k_thread_join(threads[i], K_FOREVER);
+	}
+
+	return counters[0] + counters[1];
+}
+
+
+/**
+ *
+ * @brief The main test entry
+ *
+ * @return 1 if success and 0 on failure
+ */
+int mpmc_test(void)
+{
+	uint32_t t;
+	int i;
+	int return_value = 0;
+
+	fprintf(output_file, sz_test_case_fmt,
+			"MPMC #1");
+	fprintf(output_file, sz_description,
+			"\n\tk_fifo_init"
+			"\n\tk_fifo_get(K_FOREVER) from 2 threads"
+			"\n\tk_fifo_put from 2 threads");
+	printf(sz_test_start_fmt);
+
+	k_fifo_init(&mpmc_fifo);
+
+	t = BENCH_START();
+	i = mpmc_run();
+	t = TIME_STAMP_DELTA_GET(t);
+
+	return_value += check_result(i, t);
+
+#ifdef CONFIG_FIFO_MPMC
+	fprintf(output_file, sz_test_case_fmt,
+			"MPMC #2");
+	fprintf(output_file, sz_description,
+			"\n\tk_fifo_init_mpmc"
+			"\n\tk_fifo_get(K_FOREVER) from 2 threads"
+			"\n\tk_fifo_put from 2 threads");
+	printf(sz_test_start_fmt);
+
+	k_fifo_init_mpmc(&mpmc_fifo, &mpmc_ring);
+
+	t = BENCH_START();
+	i = mpmc_run();
+	t = TIME_STAMP_DELTA_GET(t);
+
+	return_value += check_result(i, t);
+#endif /* CONFIG_FIFO_MPMC */
+
+	return return_value;
+}
@@ -162,10 +162,13 @@ int main(void)
 		test_result += fifo_test();
 		test_result += stack_test();
 		test_result += mem_slab_test();
+		test_result += mpmc_test();
 
 		if (test_result) {
-			/* sema/lifo/fifo/stack/mem_slab account for 14 tests in total */
-			if (test_result == 14) {
+			/* sema/lifo/fifo/stack/mem_slab account for 14 tests in total,
+			 * plus the MPMC tests
+			 */
+			if (test_result == 14 + MPMC_TEST_COUNT) {
 				fprintf(output_file, sz_module_result_fmt,
 					sz_success);
 			} else {
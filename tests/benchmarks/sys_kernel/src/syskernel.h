@@ -21,6 +21,9 @@
 #define NUMBER_OF_LOOPS 1000
 #endif
 
+/* MPMC #2 runs on an MPMC queue backed FIFO */
+#define MPMC_TEST_COUNT (IS_ENABLED(CONFIG_FIFO_MPMC) ? 2 : 1)
+
 
 K_THREAD_STACK_DECLARE(thread_stack1, STACK_SIZE);
 K_THREAD_STACK_DECLARE(thread_stack2, STACK_SIZE);
@@ -57,6 +60,7 @@ int lifo_test(void);
 int fifo_test(void);
 int stack_test(void);
 int mem_slab_test(void);
+int mpmc_test(void);
 void begin_test(void);
 
 static inline uint32_t BENCH_START(void)
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_fifo.h"
+
+#ifdef CONFIG_FIFO_MPMC
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define CAPACITY 4
+
+/**TESTPOINT: init via K_FIFO_MPMC_DEFINE*/
+K_FIFO_MPMC_DEFINE(kfifo_mpmc, CAPACITY);
+
+static struct z_mpmc_cell cells[CAPACITY];
+static struct k_mpmc ring;
+static struct k_fifo fifo_mpmc;
+
+static fdata_t data[CAPACITY + 1];
+
+static K_THREAD_STACK_DEFINE(tstack, STACK_SIZE);
+static struct k_thread thread;
+
+static int isr_put_ret;
+
+static void t_put_entry(void *p1, void *p2, void *p3)
+{
+	k_sleep(K_MSEC(10));
+	k_fifo_put((struct k_fifo *)p1, p2);
+}
+
+static void tIsr_entry_put_full(const void *p)
+{
+	isr_put_ret = k_fifo_put((struct k_fifo *)p, &data[CAPACITY]);
+}
+
+static void tfifo_mpmc(struct k_fifo *pfifo)
+{
+	sys_slist_t list;
+	fdata_t *rx;
+	int i;
+
+	zassert_true(k_fifo_is_empty(pfifo));
+	zassert_is_null(k_fifo_peek_head(pfifo));
+	zassert_is_null(k_fifo_peek_tail(pfifo));
+
+	for (i = 0; i < CAPACITY; i++) {
+		data[i].data = i;
+		zassert_equal(k_fifo_alloc_put(pfifo, &data[i]), 0);
+	}
+	zassert_false(k_fifo_is_empty(pfifo));
+	zassert_equal_ptr(k_fifo_peek_head(pfifo), &data[0]);
+	zassert_equal_ptr(k_fifo_peek_tail(pfifo), &data[CAPACITY - 1]);
+
+	/* A full FIFO does not accept more items */
+	zassert_equal(k_fifo_alloc_put(pfifo, &data[CAPACITY]), -ENOMEM);
+
+	/* An ISR cannot wait for room, and gets the item back */
+	isr_put_ret = 0;
+	irq_offload(tIsr_entry_put_full, (const void *)pfifo);
+	zassert_equal(isr_put_ret, -ENOMEM);
+	zassert_equal_ptr(k_fifo_peek_tail(pfifo), &data[CAPACITY - 1]);
+
+	for (i = 0; i < CAPACITY; i++) {
+		rx = k_fifo_get(pfifo, K_NO_WAIT);
+		zassert_equal_ptr(rx, &data[i]);
+		zassert_equal(rx->data, i);
+	}
+	zassert_true(k_fifo_is_empty(pfifo));
+	zassert_is_null(k_fifo_get(pfifo, K_NO_WAIT));
+
+	/* The first word of the items is left alone */
+	sys_slist_init(&list);
+	for (i = 0; i < CAPACITY; i++) {
+		sys_slist_append(&list, &data[i].snode);
+	}
+	k_fifo_put_slist(pfifo, &list);
+	for (i = 0; i < CAPACITY; i++) {
+		rx = k_fifo_get(pfifo, K_NO_WAIT);
+		zassert_equal_ptr(rx, &data[i]);
+	}
+	zassert_equal_ptr(sys_slist_peek_next(&data[0].snode), &data[1].snode);
+
+	/* A getter blocks until a producer puts an item */
+	k_tid_t tid = k_thread_create(&thread, tstack, STACK_SIZE,
+				      t_put_entry, pfifo, &data[CAPACITY], NULL,
+				      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	rx = k_fifo_get(pfifo, K_MSEC(500));
+	k_thread_join(tid, K_FOREVER);
+	zassert_equal_ptr(rx, &data[CAPACITY]);
+
+	zassert_is_null(k_fifo_get(pfifo, K_MSEC(10)));
+}
+
+/**
+ * @addtogroup kernel_fifo_tests
+ * @{
+ */
+
+/**
+ * @brief Test FIFOs backed by an MPMC queue.
+ * @see k_fifo_init_mpmc(), K_FIFO_MPMC_DEFINE(), k_fifo_put(),
+ * k_fifo_alloc_put(), k_fifo_put_slist(), k_fifo_get()
+ */
+ZTEST(fifo_api_1cpu, test_fifo_mpmc)
+{
+	/**TESTPOINT: init via k_fifo_init_mpmc*/
+	zassert_equal(k_mpmc_init(&ring, cells, CAPACITY), 0);
+	k_fifo_init_mpmc(&fifo_mpmc, &ring);
+	tfifo_mpmc(&fifo_mpmc);
+
+	/**TESTPOINT: test K_FIFO_MPMC_DEFINEed fifo*/
+	tfifo_mpmc(&kfifo_mpmc);
+}
+
+/**
+ * @}
+ */
+
+#endif /* CONFIG_FIFO_MPMC */
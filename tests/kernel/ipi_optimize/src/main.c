@@ -7,6 +7,7 @@
 #include <zephyr/tc_util.h>
 #include <zephyr/ztest.h>
 #include <zephyr/kernel.h>
+#include <zephyr/kernel/smp.h>
 #include <ksched.h>
 #include <ipi.h>
 #include <zephyr/kernel_structs.h>
@@ -19,11 +20,14 @@
 
 static struct k_thread thread[NUM_THREADS];
 static struct k_thread alt_thread;
+static struct k_thread burst_thread[NUM_THREADS];
 
 static bool alt_thread_created;
+static bool burst_threads_created;
 
 static K_THREAD_STACK_ARRAY_DEFINE(stack, NUM_THREADS, STACK_SIZE);
 static K_THREAD_STACK_DEFINE(alt_stack, STACK_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(burst_stack, NUM_THREADS, STACK_SIZE);
 
 static uint32_t ipi_count[CONFIG_MP_MAX_NUM_CPUS];
 static struct k_spinlock ipilock;
@@ -31,6 +35,7 @@ static atomic_t busy_started;
 static volatile bool alt_thread_done;
 
 static K_SEM_DEFINE(sem, 0, 1);
+static K_SEM_DEFINE(burst_sem, 0, 1);
 
 void z_trace_sched_ipi(void)
 {
@@ -106,6 +111,19 @@ static void pending_thread_entry(void *p1, void *p2, void *p3)
 	}
 }
 
+static void burst_thread_entry(void *p1, void *p2, void *p3)
+{
+	int  key;
+
+	(void)k_sem_take(&burst_sem, K_FOREVER);
+
+	while (!alt_thread_done) {
+		key = arch_irq_lock();
+		arch_spin_relax();
+		arch_irq_unlock(key);
+	}
+}
+
 static void alt_thread_create(int priority, const char *desc)
 {
 	k_thread_create(&alt_thread, alt_stack, STACK_SIZE,
@@ -330,6 +348,18 @@ ZTEST(ipi, test_high_thread_wakes_some_ipis)
 	zassert_true(z_is_thread_ready(&alt_thread),
 		     "High priority thread is not ready.\n");
 
+#if defined(CONFIG_IPI_TARGETED) && defined(CONFIG_ARCH_HAS_DIRECTED_IPIS)
+	/*
+	 * Only the CPU that was executing the lowest priority busy thread
+	 * ought to be signalled, and it is now executing the woken thread.
+	 */
+	bool targeted[CONFIG_MP_MAX_NUM_CPUS];
+
+	for (i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		targeted[i] = (_kernel.cpus[i].current == &alt_thread);
+	}
+#endif
+
 	alt_thread_done = true;
 
 	for (i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
@@ -337,12 +367,95 @@ ZTEST(ipi, test_high_thread_wakes_some_ipis)
 			continue;
 		}
 
+#if defined(CONFIG_IPI_TARGETED) && defined(CONFIG_ARCH_HAS_DIRECTED_IPIS)
+		if (targeted[i]) {
+			zassert_true(set[i] == 1, "CPU%u got %u IPIs", i, set[i]);
+		} else {
+			zassert_true(set[i] == 0, "CPU%u got %u IPI(s)", i, set[i]);
+		}
+#else
 		zassert_true(set[i] == 1, "CPU%u got %u IPIs", i, set[i]);
+#endif
 	}
 
 	zassert_true(set[id] == 0, "Current CPU got %u IPI(s).\n", set[id]);
 }
 
+/**
+ * Verify that waking several threads in one go results in at most one IPI
+ * per CPU.
+ */
+ZTEST(ipi, test_burst_wakes_one_ipi_per_cpu)
+{
+	uint32_t  set[CONFIG_MP_MAX_NUM_CPUS];
+	uint32_t  id;
+	int priority;
+	unsigned int i;
+
+	priority = k_thread_priority_get(k_current_get());
+	atomic_clear(&busy_started);
+
+	for (i = 0; i < NUM_THREADS; i++) {
+		k_thread_create(&burst_thread[i], burst_stack[i], STACK_SIZE,
+				burst_thread_entry, NULL, NULL, NULL,
+				priority - 1 - NUM_THREADS, 0, K_NO_WAIT);
+	}
+	burst_threads_created = true;
+
+	k_busy_wait(10000);
+	for (i = 0; i < NUM_THREADS; i++) {
+		zassert_true(z_is_thread_pending(&burst_thread[i]),
+			     "Burst thread %u has not pended.\n", i);
+	}
+
+	id = busy_threads_create(priority - 1);
+
+	busy_threads_priority_set(0, 1);
+	k_busy_wait(DELAY_FOR_IPIS);
+
+	/*
+	 * High priority threads are pended. Current thread is cooperative.
+	 * Other CPUs are executing preemptible threads. Waking all of the
+	 * pended threads at once ought to signal each other CPU once.
+	 */
+
+	clear_ipi_counts();
+#ifdef CONFIG_SCHED_IPI_STATS
+	k_ipi_stats_reset();
+#endif
+	k_sem_reset(&burst_sem);
+	k_busy_wait(DELAY_FOR_IPIS);
+	get_ipi_counts(set, CONFIG_MP_MAX_NUM_CPUS);
+
+	alt_thread_done = true;
+
+	for (i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		if (i == id) {
+			zassert_true(set[i] == 0, "Current CPU got %u IPI(s).\n",
+				     set[i]);
+		} else {
+			zassert_true(set[i] == 1, "CPU%u got %u IPIs", i, set[i]);
+		}
+
+#ifdef CONFIG_SCHED_IPI_STATS
+		struct k_ipi_stats stats;
+
+		zassert_equal(k_ipi_stats_get(i, &stats), 0);
+		zassert_equal(stats.received, set[i],
+			      "CPU%u handled %u IPIs, traced %u", i,
+			      stats.received, set[i]);
+		zassert_equal(stats.sent, (i == id) ? 0 : 1,
+			      "CPU%u was sent %u IPIs", i, stats.sent);
+#endif
+	}
+
+#ifdef CONFIG_SCHED_IPI_STATS
+	struct k_ipi_stats stats;
+
+	zassert_equal(k_ipi_stats_get(CONFIG_MP_MAX_NUM_CPUS, &stats), -EINVAL);
+#endif
+}
+
 /**
  * Verify that lowering the priority of an active thread results in an IPI.
  * If directed IPIs are enabled, then only the CPU executing that active
@@ -469,6 +582,13 @@ static void cleanup_threads(void *fixture)
 	}
 	alt_thread_created = false;
 
+	if (burst_threads_created) {
+		for (i = 0; i < NUM_THREADS; i++) {
+			k_thread_abort(&burst_thread[i]);
+		}
+	}
+	burst_threads_created = false;
+
 	alt_thread_done = false;
 }
 
@@ -265,3 +265,61 @@ ZTEST(k_heap_api, test_k_heap_alloc_pending_null)
 
 	k_heap_free(&k_heap_test, p);
 }
+
+#ifdef CONFIG_HEAP_MAGAZINES
+K_HEAP_DEFINE(cached_heap, HEAP_SIZE);
+static struct k_heap_cache heap_cache;
+
+/**
+ * @brief Validate the per-CPU magazine cache of a k_heap.
+ *
+ * @details Fill a heap with small blocks and free them, so that some of
+ * them stay in the magazines.  A request for most of the heap must
+ * still succeed, the cache being flushed before it fails.
+ *
+ * @ingroup kernel_heap_tests
+ */
+ZTEST(k_heap_api, test_k_heap_cache)
+{
+	struct k_heap_cache_stats stats;
+	void *blocks[HEAP_SIZE / 32];
+	unsigned int n;
+	char *p;
+
+	zassert_equal(k_heap_cache_stats_get(&cached_heap, &stats), -EINVAL);
+	k_heap_cache_attach(&cached_heap, &heap_cache);
+
+	for (n = 0; n < ARRAY_SIZE(blocks); n++) {
+		blocks[n] = k_heap_alloc(&cached_heap, 24, K_NO_WAIT);
+		if (blocks[n] == NULL) {
+			break;
+		}
+	}
+	zassert_true(n > 0, "no block allocated");
+
+	for (unsigned int i = 0; i < n; i++) {
+		k_heap_free(&cached_heap, blocks[i]);
+	}
+
+	zassert_ok(k_heap_cache_stats_get(&cached_heap, &stats));
+	zassert_true(stats.free_hits > 0, "no block was cached");
+	zassert_true(stats.cached_bytes > 0, "no byte cached");
+
+	/* Served from the magazine just filled */
+	p = k_heap_alloc(&cached_heap, 20, K_NO_WAIT);
+	zassert_not_null(p, "k_heap_alloc operation failed");
+	zassert_ok(k_heap_cache_stats_get(&cached_heap, &stats));
+	zassert_true(stats.alloc_hits > 0, "allocation missed the cache");
+	k_heap_free(&cached_heap, p);
+
+	p = k_heap_alloc(&cached_heap, ALLOC_SIZE_2, K_NO_WAIT);
+	zassert_not_null(p, "cached blocks were not returned to the heap");
+	zassert_ok(k_heap_cache_stats_get(&cached_heap, &stats));
+	zassert_equal(stats.cached_bytes, 0);
+	k_heap_free(&cached_heap, p);
+
+	k_heap_cache_flush(&cached_heap);
+	zassert_ok(k_heap_cache_stats_get(&cached_heap, &stats));
+	zassert_equal(stats.cached_bytes, 0);
+}
+#endif /* CONFIG_HEAP_MAGAZINES */
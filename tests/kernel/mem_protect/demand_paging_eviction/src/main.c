@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel/mm.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+
+#ifdef CONFIG_BACKING_STORE_RAM_PAGES
+#define EXTRA_PAGES	(CONFIG_BACKING_STORE_RAM_PAGES - 1)
+#else
+#error "Unsupported configuration"
+#endif
+
+#if defined(CONFIG_EVICTION_NRU)
+#define EVICTION_NAME	"NRU"
+#elif defined(CONFIG_EVICTION_CLOCK)
+#define EVICTION_NAME	"CLOCK"
+#elif defined(CONFIG_EVICTION_LRU_AGING)
+#define EVICTION_NAME	"LRU aging"
+#else
+#define EVICTION_NAME	"custom"
+#endif
+
+#define PAGE_SIZE	CONFIG_MMU_PAGE_SIZE
+
+/* Synthetic trace: a hot working set, written to on every round, and a
+ * cold region read by a sequential scan a few pages at a time. The cold
+ * scan is what makes NRU-like algorithms evict the hot pages.
+ */
+#define TRACE_ROUNDS	64
+#define HOT_REPEAT	4
+#define COLD_PER_ROUND	2
+
+/* Rounds over the hot working set alone, after the trace */
+#define HOT_ROUNDS	8
+
+static char *arena;
+static size_t arena_pages;
+static size_t hot_pages;
+
+static unsigned long faults_get(void)
+{
+	struct k_mem_paging_stats_t stats;
+
+	k_mem_paging_stats_get(&stats);
+
+	return stats.pagefaults.cnt;
+}
+
+static unsigned long evictions_get(void)
+{
+	struct k_mem_paging_stats_t stats;
+
+	k_mem_paging_stats_get(&stats);
+
+	return stats.eviction.clean + stats.eviction.dirty;
+}
+
+static void touch_hot(unsigned int round)
+{
+	for (size_t i = 0; i < hot_pages; i++) {
+		arena[i * PAGE_SIZE] = (char)round;
+	}
+}
+
+static void report(const char *phase, unsigned long faults,
+		   unsigned long evictions, unsigned long accesses)
+{
+	printk("%s %s: %lu faults, %lu evictions for %lu accesses "
+	       "(%lu faults per 1000 accesses)\n",
+	       EVICTION_NAME, phase, faults, evictions, accesses,
+	       faults * 1000UL / accesses);
+}
+
+static void *eviction_setup(void)
+{
+	size_t free_pages = k_mem_free_get() / PAGE_SIZE;
+
+	/* Map more than fits in RAM so that pages have to be evicted,
+	 * with half of the backing store to spare
+	 */
+	arena_pages = free_pages + (EXTRA_PAGES / 2);
+	hot_pages = MAX(free_pages / 2, 1);
+
+	arena = k_mem_map(arena_pages * PAGE_SIZE, K_MEM_PERM_RW);
+	zassert_not_null(arena, "failed to map %zu pages", arena_pages);
+	printk("%zu pages mapped, %zu free, %zu hot\n", arena_pages, free_pages,
+	       hot_pages);
+
+	return NULL;
+}
+
+/**
+ * @brief Replay a synthetic access trace and report the fault rate
+ *
+ * The fault rates printed by each variant of this test can be compared to
+ * choose an eviction algorithm. Each cold access may fault, but the hot
+ * working set fits in RAM: except with NRU, which does not track recency,
+ * the test fails if the hot set is paged in more than twice during the
+ * trace. With any algorithm it fails if the hot set keeps being paged out
+ * once the cold scan stops.
+ */
+ZTEST(demand_paging_eviction, test_eviction_trace)
+{
+	size_t cold_pages = arena_pages - hot_pages;
+	size_t cold = 0;
+	unsigned long accesses = 0;
+	unsigned long cold_accesses = 0;
+	unsigned long faults, evictions, max_faults;
+	volatile char sink;
+
+	faults = faults_get();
+	evictions = evictions_get();
+
+	for (unsigned int round = 0; round < TRACE_ROUNDS; round++) {
+		for (unsigned int i = 0; i < HOT_REPEAT; i++) {
+			touch_hot(round);
+			accesses += hot_pages;
+		}
+
+		for (unsigned int i = 0; i < COLD_PER_ROUND; i++) {
+			sink = arena[(hot_pages + cold) * PAGE_SIZE];
+			cold = (cold + 1) % cold_pages;
+			cold_accesses++;
+		}
+
+		/* Let periodic algorithms sample the accessed state */
+		k_msleep(1);
+	}
+
+	accesses += cold_accesses;
+	faults = faults_get() - faults;
+	report("trace", faults, evictions_get() - evictions, accesses);
+
+	/* The unavoidable cold misses, and the hot set paged in twice */
+	max_faults = cold_accesses + 2UL * hot_pages;
+	if (!IS_ENABLED(CONFIG_EVICTION_NRU)) {
+		zassert_true(faults <= max_faults,
+			     "hot working set evicted by the cold scan: "
+			     "%lu faults, at most %lu expected", faults,
+			     max_faults);
+	}
+
+	faults = faults_get();
+	evictions = evictions_get();
+
+	for (unsigned int round = 0; round < HOT_ROUNDS; round++) {
+		touch_hot(round);
+	}
+
+	faults = faults_get() - faults;
+	report("hot set", faults, evictions_get() - evictions,
+	       HOT_ROUNDS * hot_pages);
+
+	zassert_true(faults < (HOT_ROUNDS * hot_pages) / 2,
+		     "hot working set thrashing: %lu faults", faults);
+
+	ARG_UNUSED(sink);
+}
+
+#if CONFIG_DEMAND_PAGING_READ_AHEAD > 0
+#define READ_AHEAD_PAGES	4
+
+/**
+ * @brief Test that sequential page faults read the next pages ahead
+ */
+ZTEST(demand_paging_eviction, test_read_ahead)
+{
+	char *region = arena + (arena_pages - READ_AHEAD_PAGES) * PAGE_SIZE;
+	unsigned long faults;
+	unsigned int key;
+	int ret;
+
+	/* Lock IRQs to prevent other pagefaults from happening while we
+	 * are measuring stuff
+	 */
+	key = irq_lock();
+
+	/* Paging out frees page frames to read ahead into */
+	ret = k_mem_page_out(region, READ_AHEAD_PAGES * PAGE_SIZE);
+	zassert_equal(ret, 0, "k_mem_page_out failed with %d", ret);
+
+	faults = faults_get();
+	for (size_t i = 0; i < READ_AHEAD_PAGES; i++) {
+		region[i * PAGE_SIZE] = (char)i;
+	}
+	faults = faults_get() - faults;
+	irq_unlock(key);
+
+	printk("%lu faults for %d sequential pages\n", faults,
+	       READ_AHEAD_PAGES);
+	zassert_true(faults < READ_AHEAD_PAGES,
+		     "no page read ahead: %lu faults", faults);
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD > 0 */
+
+ZTEST_SUITE(demand_paging_eviction, NULL, eviction_setup, NULL, NULL, NULL);
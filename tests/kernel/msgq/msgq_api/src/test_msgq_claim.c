@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#ifdef CONFIG_MSGQ_CLAIM
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+extern struct k_msgq msgq;
+static char __aligned(4) tbuffer[MSG_SIZE * MSGQ_LEN];
+static uint32_t rx_data;
+
+static void get_entry(void *p1, void *p2, void *p3)
+{
+	int ret = k_msgq_get((struct k_msgq *)p1, &rx_data, K_FOREVER);
+
+	zassert_equal(ret, 0);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test writing a message in place in a message queue
+ * @see k_msgq_put_claim(), k_msgq_put_commit()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_put_claim)
+{
+	uint32_t msg1 = MSG1;
+	uint32_t rx;
+	void *slot;
+	void *other;
+
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MSGQ_LEN);
+
+	zassert_equal(k_msgq_put_claim(&msgq, &slot, K_NO_WAIT), 0);
+	zassert_true((char *)slot >= tbuffer && (char *)slot < tbuffer + sizeof(tbuffer));
+	/**TESTPOINT: only one slot can be claimed at a time*/
+	zassert_equal(k_msgq_put_claim(&msgq, &other, K_NO_WAIT), -ENOMSG);
+
+	/**TESTPOINT: messages put meanwhile are queued after the claimed one*/
+	zassert_equal(k_msgq_put(&msgq, &msg1, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_num_free_get(&msgq), 0);
+	zassert_equal(k_msgq_num_used_get(&msgq), 0);
+	zassert_equal(k_msgq_get(&msgq, &rx, K_NO_WAIT), -ENOMSG);
+
+	*(uint32_t *)slot = MSG0;
+	zassert_equal(k_msgq_put_commit(&msgq, slot), 0);
+	zassert_equal(k_msgq_num_used_get(&msgq), 2);
+
+	zassert_equal(k_msgq_get(&msgq, &rx, K_NO_WAIT), 0);
+	zassert_equal(rx, MSG0);
+	zassert_equal(k_msgq_get(&msgq, &rx, K_NO_WAIT), 0);
+	zassert_equal(rx, MSG1);
+}
+
+/**
+ * @brief Test committing a message to a thread waiting for it
+ * @see k_msgq_put_claim(), k_msgq_put_commit(), k_msgq_get()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_put_commit_to_waiter)
+{
+	void *slot;
+
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MSGQ_LEN);
+	rx_data = 0;
+
+	k_tid_t tid = k_thread_create(&tdata, tstack, STACK_SIZE,
+				      get_entry, &msgq, NULL, NULL,
+				      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	k_msleep(TIMEOUT_MS >> 1);
+	zassert_equal(k_msgq_put_claim(&msgq, &slot, K_NO_WAIT), 0);
+	*(uint32_t *)slot = MSG0;
+	zassert_equal(k_msgq_put_commit(&msgq, slot), 0);
+
+	k_thread_join(tid, K_FOREVER);
+	zassert_equal(rx_data, MSG0);
+	zassert_equal(k_msgq_num_used_get(&msgq), 0);
+}
+
+/**
+ * @brief Test reading a message in place from a message queue
+ * @see k_msgq_get_claim(), k_msgq_get_release()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_get_claim)
+{
+	uint32_t data[MSGQ_LEN] = { MSG0, MSG1 };
+	uint32_t rx;
+	void *slot;
+	void *other;
+
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MSGQ_LEN);
+
+	zassert_equal(k_msgq_get_claim(&msgq, &slot, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_get_claim(&msgq, &slot, TIMEOUT), -EAGAIN);
+
+	for (int i = 0; i < MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_put(&msgq, &data[i], K_NO_WAIT), 0);
+	}
+
+	zassert_equal(k_msgq_get_claim(&msgq, &slot, K_NO_WAIT), 0);
+	zassert_equal(*(uint32_t *)slot, MSG0);
+	zassert_equal(k_msgq_get_claim(&msgq, &other, K_NO_WAIT), -ENOMSG);
+
+	/**TESTPOINT: received slots are not reused until the release*/
+	zassert_equal(k_msgq_get(&msgq, &rx, K_NO_WAIT), 0);
+	zassert_equal(rx, MSG1);
+	zassert_equal(k_msgq_num_free_get(&msgq), 0);
+	zassert_equal(k_msgq_put(&msgq, &data[0], K_NO_WAIT), -ENOMSG);
+	zassert_equal(*(uint32_t *)slot, MSG0);
+
+	zassert_equal(k_msgq_get_release(&msgq, slot), 0);
+	zassert_equal(k_msgq_num_free_get(&msgq), MSGQ_LEN);
+	zassert_equal(k_msgq_put(&msgq, &data[0], K_NO_WAIT), 0);
+}
+
+#ifdef CONFIG_POLL
+/**
+ * @brief Test k_poll() on a message queue written in place
+ * @see k_msgq_put_claim(), k_msgq_put_commit(), k_poll()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_put_claim_poll)
+{
+	struct k_poll_event event =
+		K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
+					 K_POLL_MODE_NOTIFY_ONLY, &msgq);
+	void *slot;
+
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MSGQ_LEN);
+
+	zassert_equal(k_msgq_put_claim(&msgq, &slot, K_NO_WAIT), 0);
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+
+	*(uint32_t *)slot = MSG0;
+	zassert_equal(k_msgq_put_commit(&msgq, slot), 0);
+	event.state = K_POLL_STATE_NOT_READY;
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), 0);
+	zassert_equal(event.state, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+
+	k_msgq_purge(&msgq);
+}
+#endif /* CONFIG_POLL */
+
+/**
+ * @}
+ */
+
+#endif /* CONFIG_MSGQ_CLAIM */
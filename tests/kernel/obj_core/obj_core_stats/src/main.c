@@ -693,6 +693,132 @@ ZTEST(obj_core_stats_mem_slab, test_obj_core_stats_mem_slab)
 	k_mem_slab_free(&mem_slab, mem2);
 }
 
+/***************** WAIT QUEUES ******************/
+
+#if defined(CONFIG_OBJ_CORE_STATS_WAIT) && defined(CONFIG_OBJ_CORE_STATS_THREAD) && \
+	!defined(CONFIG_ARCH_POSIX) && !defined(CONFIG_SPARC) && !defined(CONFIG_MIPS)
+#define WAIT_US 2000
+
+K_SEM_DEFINE(wait_sem, 0, 1);
+K_THREAD_STACK_DEFINE(wait_thread_stack, 1024 + CONFIG_TEST_EXTRA_STACK_SIZE);
+struct k_thread wait_thread;
+
+static void wait_thread_entry(void *p1, void *p2, void *p3)
+{
+	k_sem_take(&wait_sem, K_FOREVER);
+	k_sem_take(&wait_sem, K_FOREVER);
+}
+
+static uint32_t hist_total(const struct k_usage_hist *hist, unsigned int from)
+{
+	uint32_t total = 0U;
+
+	for (unsigned int i = from; i < K_USAGE_HIST_BUCKETS; i++) {
+		total += hist->buckets[i];
+	}
+
+	return total;
+}
+
+ZTEST(obj_core_stats_wait, test_obj_core_stats_wait)
+{
+	struct k_usage_hist  hist;
+	struct k_cycle_stats raw;
+	uint32_t cycles = k_us_to_cyc_floor32(WAIT_US / 2);
+	unsigned int bucket = MIN(find_msb_set(cycles), K_USAGE_HIST_BUCKETS) - 1U;
+	int    status;
+
+	k_thread_create(&wait_thread, wait_thread_stack,
+			K_THREAD_STACK_SIZEOF(wait_thread_stack),
+			wait_thread_entry, NULL, NULL, NULL,
+			K_HIGHEST_THREAD_PRIO, 0, K_NO_WAIT);
+
+	/* wait_thread blocks on wait_sem right away */
+
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&wait_sem), &hist,
+				      sizeof(hist));
+	zassert_equal(status, 0, "Expected 0, got %d", status);
+	zassert_equal(hist_total(&hist, 0), 0, "Unexpected blocked time");
+
+	k_busy_wait(WAIT_US);
+	k_sem_give(&wait_sem);
+
+	/* wait_thread ran and blocked on wait_sem again: one wait is over */
+
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&wait_sem), &hist,
+				      sizeof(hist));
+	zassert_equal(status, 0, "Expected 0, got %d", status);
+	zassert_equal(hist_total(&hist, 0), 1, "Expected 1 wait, got %u",
+		      hist_total(&hist, 0));
+	zassert_equal(hist_total(&hist, bucket), 1, "Wait shorter than expected");
+
+	/* wait_thread ran twice, having been made ready each time */
+
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&wait_thread), &raw,
+				      sizeof(raw));
+	zassert_equal(status, 0, "Expected 0, got %d", status);
+	zassert_equal(hist_total(&raw.sched_delay, 0), 2,
+		      "Expected 2 delays, got %u",
+		      hist_total(&raw.sched_delay, 0));
+	zassert_equal(hist_total(&raw.run_slice, 0), 2,
+		      "Expected 2 usage windows, got %u",
+		      hist_total(&raw.run_slice, 0));
+
+	k_thread_abort(&wait_thread);
+
+	status = k_obj_core_stats_reset(K_OBJ_CORE(&wait_sem));
+	zassert_equal(status, 0, "Expected 0, got %d", status);
+
+	status = k_obj_core_stats_query(K_OBJ_CORE(&wait_sem), &hist,
+					sizeof(hist));
+	zassert_equal(status, 0, "Expected 0, got %d", status);
+	zassert_equal(hist_total(&hist, 0), 0, "Stats not reset");
+}
+
+K_MUTEX_DEFINE(wait_mutex);
+K_CONDVAR_DEFINE(wait_condvar);
+K_SEM_DEFINE(broadcast_sem, 0, 1);
+
+static void broadcast_thread_entry(void *p1, void *p2, void *p3)
+{
+	k_mutex_lock(&wait_mutex, K_FOREVER);
+	k_condvar_wait(&wait_condvar, &wait_mutex, K_FOREVER);
+	k_mutex_unlock(&wait_mutex);
+	k_sem_take(&broadcast_sem, K_FOREVER);
+}
+
+ZTEST(obj_core_stats_wait, test_obj_core_stats_wait_broadcast)
+{
+	struct k_cycle_stats raw;
+	int    status;
+
+	k_thread_create(&wait_thread, wait_thread_stack,
+			K_THREAD_STACK_SIZEOF(wait_thread_stack),
+			broadcast_thread_entry, NULL, NULL, NULL,
+			K_HIGHEST_THREAD_PRIO, 0, K_NO_WAIT);
+
+	/* wait_thread blocks on wait_condvar right away */
+
+	k_condvar_broadcast(&wait_condvar);
+
+	/* wait_thread was woken with the waiters of wait_condvar, and ran
+	 * until blocking on broadcast_sem
+	 */
+
+	status = k_obj_core_stats_raw(K_OBJ_CORE(&wait_thread), &raw,
+				      sizeof(raw));
+	zassert_equal(status, 0, "Expected 0, got %d", status);
+	zassert_equal(hist_total(&raw.sched_delay, 0), 2,
+		      "Expected 2 delays, got %u",
+		      hist_total(&raw.sched_delay, 0));
+
+	k_thread_abort(&wait_thread);
+}
+
+ZTEST_SUITE(obj_core_stats_wait, NULL, NULL,
+	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
+#endif
+
 ZTEST_SUITE(obj_core_stats_system, NULL, NULL,
 	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
 
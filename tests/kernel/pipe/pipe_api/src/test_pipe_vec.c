@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_error_hook.h>
+
+#ifdef CONFIG_PIPES_VEC
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define PIPE_LEN 16
+#define DATA_LEN 12
+
+static const unsigned char vec_data[DATA_LEN] = "0123456789ab";
+static unsigned char __aligned(4) vec_pipe_buf[PIPE_LEN];
+static struct k_pipe vec_pipe;
+
+static ZTEST_DMEM unsigned char rx_a[5];
+static ZTEST_DMEM unsigned char rx_b[7];
+
+static struct k_thread vec_thread;
+static K_THREAD_STACK_DEFINE(vec_stack, STACK_SIZE);
+
+/* Three buffers, the middle one empty, gathering vec_data */
+static ZTEST_DMEM unsigned char tx_a[4] = "0123";
+static ZTEST_DMEM unsigned char tx_b[8] = "456789ab";
+
+static void vec_rx_check(void)
+{
+	zassert_mem_equal(rx_a, vec_data, sizeof(rx_a));
+	zassert_mem_equal(rx_b, &vec_data[sizeof(rx_a)], sizeof(rx_b));
+	memset(rx_a, 0, sizeof(rx_a));
+	memset(rx_b, 0, sizeof(rx_b));
+}
+
+static void vec_put(struct k_pipe *pipe, k_timeout_t timeout)
+{
+	struct k_pipe_vec vec[] = {
+		{ tx_a, sizeof(tx_a) },
+		{ NULL, 0 },
+		{ tx_b, sizeof(tx_b) },
+	};
+	size_t written;
+
+	zassert_equal(k_pipe_put_vec(pipe, vec, ARRAY_SIZE(vec), &written,
+				     DATA_LEN, timeout), 0);
+	zassert_equal(written, DATA_LEN);
+}
+
+static void vec_get(struct k_pipe *pipe, k_timeout_t timeout)
+{
+	struct k_pipe_vec vec[] = {
+		{ rx_a, sizeof(rx_a) },
+		{ rx_b, sizeof(rx_b) },
+	};
+	size_t read;
+
+	zassert_equal(k_pipe_get_vec(pipe, vec, ARRAY_SIZE(vec), &read,
+				     DATA_LEN, timeout), 0);
+	zassert_equal(read, DATA_LEN);
+}
+
+static void vec_get_entry(void *p1, void *p2, void *p3)
+{
+	vec_get(p1, K_FOREVER);
+}
+
+static void vec_put_entry(void *p1, void *p2, void *p3)
+{
+	vec_put(p1, K_FOREVER);
+}
+
+/**
+ * @brief Test scatter/gather transfers through the pipe buffer
+ * @ingroup kernel_pipe_tests
+ * @see k_pipe_put_vec(), k_pipe_get_vec()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_vec_buffered)
+{
+	size_t read;
+
+	k_pipe_init(&vec_pipe, vec_pipe_buf, PIPE_LEN);
+
+	vec_put(&vec_pipe, K_NO_WAIT);
+	zassert_equal(k_pipe_read_avail(&vec_pipe), DATA_LEN);
+	vec_get(&vec_pipe, K_NO_WAIT);
+	vec_rx_check();
+
+	/**TESTPOINT: buffers are filled across the pipe buffer wrap around */
+	vec_put(&vec_pipe, K_NO_WAIT);
+	vec_get(&vec_pipe, K_NO_WAIT);
+	vec_rx_check();
+	zassert_equal(k_pipe_read_avail(&vec_pipe), 0);
+
+	/**TESTPOINT: a plain read gets the data of a gathered write */
+	unsigned char rx[DATA_LEN];
+
+	vec_put(&vec_pipe, K_NO_WAIT);
+	zassert_equal(k_pipe_get(&vec_pipe, rx, sizeof(rx), &read,
+				 sizeof(rx), K_NO_WAIT), 0);
+	zassert_mem_equal(rx, vec_data, sizeof(rx));
+}
+
+/**
+ * @brief Test scatter/gather transfers with a thread waiting on the
+ * other end of an unbuffered pipe
+ * @ingroup kernel_pipe_tests
+ * @see k_pipe_put_vec(), k_pipe_get_vec()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_vec_direct)
+{
+	k_tid_t tid;
+
+	k_pipe_init(&vec_pipe, NULL, 0);
+
+	/**TESTPOINT: data goes straight to the buffers of a waiting reader */
+	tid = k_thread_create(&vec_thread, vec_stack, STACK_SIZE,
+			      vec_get_entry, &vec_pipe, NULL, NULL,
+			      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_sleep(K_MSEC(10));
+	vec_put(&vec_pipe, K_NO_WAIT);
+	k_thread_join(tid, K_FOREVER);
+	vec_rx_check();
+
+	/**TESTPOINT: data comes straight from the buffers of a waiting writer */
+	tid = k_thread_create(&vec_thread, vec_stack, STACK_SIZE,
+			      vec_put_entry, &vec_pipe, NULL, NULL,
+			      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_sleep(K_MSEC(10));
+	vec_get(&vec_pipe, K_NO_WAIT);
+	k_thread_join(tid, K_FOREVER);
+	vec_rx_check();
+}
+
+/**
+ * @brief Test scatter/gather transfer failure scenarios
+ * @ingroup kernel_pipe_tests
+ * @see k_pipe_put_vec(), k_pipe_get_vec()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_vec_fail)
+{
+	struct k_pipe_vec vec[] = {
+		{ tx_a, SIZE_MAX },
+		{ tx_b, sizeof(tx_b) },
+	};
+	size_t bytes;
+
+	k_pipe_init(&vec_pipe, vec_pipe_buf, PIPE_LEN);
+
+	/**TESTPOINT: the total size of the buffers must not overflow */
+	zassert_equal(k_pipe_put_vec(&vec_pipe, vec, ARRAY_SIZE(vec), &bytes,
+				     0, K_NO_WAIT), -EINVAL);
+	zassert_equal(k_pipe_get_vec(&vec_pipe, vec, ARRAY_SIZE(vec), &bytes,
+				     0, K_NO_WAIT), -EINVAL);
+
+	/**TESTPOINT: min_xfer must not exceed the total size */
+	vec[0].len = sizeof(tx_a);
+	zassert_equal(k_pipe_put_vec(&vec_pipe, vec, ARRAY_SIZE(vec), &bytes,
+				     DATA_LEN + 1, K_NO_WAIT), -EINVAL);
+	zassert_equal(k_pipe_get_vec(&vec_pipe, vec, ARRAY_SIZE(vec), &bytes,
+				     DATA_LEN + 1, K_NO_WAIT), -EINVAL);
+
+	/**TESTPOINT: nothing to read */
+	zassert_equal(k_pipe_get_vec(&vec_pipe, vec, ARRAY_SIZE(vec), &bytes,
+				     1, K_NO_WAIT), -EIO);
+}
+
+#ifdef CONFIG_USERSPACE
+/**
+ * @brief Test scatter/gather transfers by a user thread
+ * @ingroup kernel_pipe_tests
+ * @see k_pipe_put_vec(), k_pipe_get_vec()
+ */
+ZTEST_USER(pipe_api_1cpu, test_pipe_vec_user)
+{
+	struct k_pipe *p = k_object_alloc(K_OBJ_PIPE);
+
+	zassert_true(p != NULL);
+	zassert_false(k_pipe_alloc_init(p, PIPE_LEN));
+
+	vec_put(p, K_NO_WAIT);
+	vec_get(p, K_NO_WAIT);
+	vec_rx_check();
+}
+
+/**
+ * @brief Test a user thread passing too many buffers
+ * @ingroup kernel_pipe_tests
+ * @see k_pipe_put_vec()
+ */
+ZTEST_USER(pipe_api_1cpu, test_pipe_vec_user_too_many)
+{
+	static ZTEST_DMEM struct k_pipe_vec vec[CONFIG_PIPES_VEC_MAX + 1];
+	struct k_pipe *p = k_object_alloc(K_OBJ_PIPE);
+	size_t written;
+
+	zassert_true(p != NULL);
+	zassert_false(k_pipe_alloc_init(p, PIPE_LEN));
+
+	ztest_set_fault_valid(true);
+	(void)k_pipe_put_vec(p, vec, ARRAY_SIZE(vec), &written, 0, K_NO_WAIT);
+	ztest_test_fail();
+}
+#endif /* CONFIG_USERSPACE */
+
+#endif /* CONFIG_PIPES_VEC */
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#ifdef CONFIG_POLL_SET
+
+#define SIGNAL_RESULT 0x5e7
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct fifo_msg {
+	void *private;
+	uint32_t msg;
+};
+
+static struct k_poll_set set;
+static struct k_sem set_sem;
+static struct k_fifo set_fifo;
+static struct k_poll_signal set_signal;
+static struct k_poll_event set_events[3];
+
+static struct k_thread set_thread;
+static K_THREAD_STACK_DEFINE(set_stack, STACK_SIZE);
+
+static void set_raise_entry(void *p1, void *p2, void *p3)
+{
+	k_msleep(50);
+	k_poll_signal_raise(&set_signal, SIGNAL_RESULT);
+}
+
+static void set_setup(void)
+{
+	k_poll_set_init(&set);
+	k_sem_init(&set_sem, 0, 1);
+	k_fifo_init(&set_fifo);
+	k_poll_signal_init(&set_signal);
+
+	k_poll_event_init(&set_events[0], K_POLL_TYPE_SEM_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_sem);
+	k_poll_event_init(&set_events[1], K_POLL_TYPE_FIFO_DATA_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_fifo);
+	k_poll_event_init(&set_events[2], K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_signal);
+
+	for (int i = 0; i < ARRAY_SIZE(set_events); i++) {
+		zassert_equal(k_poll_set_add(&set, &set_events[i]), 0);
+	}
+}
+
+static void set_teardown(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(set_events); i++) {
+		zassert_equal(k_poll_set_remove(&set, &set_events[i]), 0);
+	}
+}
+
+/**
+ * @brief Test waiting on a poll set without blocking
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_init(), k_poll_set_add(), k_poll_set_remove(),
+ * k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_no_wait)
+{
+	struct fifo_msg msg = { NULL, 0 };
+	struct k_poll_event *ready[3];
+
+	set_setup();
+
+	/**TESTPOINT: an event is in one set at a time */
+	zassert_equal(k_poll_set_add(&set, &set_events[0]), -EBUSY);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_NO_WAIT), -EAGAIN);
+
+	/**TESTPOINT: events are returned in the order they became ready */
+	k_fifo_put(&set_fifo, &msg);
+	k_sem_give(&set_sem);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_NO_WAIT), 2);
+	zassert_equal_ptr(ready[0], &set_events[1]);
+	zassert_equal(ready[0]->state, K_POLL_STATE_FIFO_DATA_AVAILABLE);
+	zassert_equal_ptr(ready[1], &set_events[0]);
+	zassert_equal(ready[1]->state, K_POLL_STATE_SEM_AVAILABLE);
+
+	/**TESTPOINT: events are level triggered */
+	zassert_equal(k_sem_take(&set_sem, K_NO_WAIT), 0);
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &set_events[1]);
+	zassert_equal_ptr(k_fifo_get(&set_fifo, K_NO_WAIT), &msg);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_NO_WAIT), -EAGAIN);
+
+	/**TESTPOINT: events are still registered after being returned */
+	k_sem_give(&set_sem);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &set_events[0]);
+
+	/**TESTPOINT: removed events are not returned anymore */
+	zassert_equal(k_poll_set_remove(&set, &set_events[0]), 0);
+	zassert_equal(k_poll_set_remove(&set, &set_events[0]), -EINVAL);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_NO_WAIT), -EAGAIN);
+	zassert_equal(k_poll_set_add(&set, &set_events[0]), 0);
+
+	zassert_equal(k_sem_take(&set_sem, K_NO_WAIT), 0);
+	set_teardown();
+}
+
+/**
+ * @brief Test waiting on a poll set
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait(), k_poll_signal_raise()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_wait)
+{
+	struct k_poll_event *ready[3];
+	unsigned int signaled;
+	int result;
+
+	set_setup();
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_MSEC(10)), -EAGAIN);
+
+	k_tid_t tid = k_thread_create(&set_thread, set_stack,
+				      K_THREAD_STACK_SIZEOF(set_stack),
+				      set_raise_entry, NULL, NULL, NULL,
+				      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_FOREVER), 1);
+	zassert_equal_ptr(ready[0], &set_events[2]);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SIGNALED);
+	k_poll_signal_check(&set_signal, &signaled, &result);
+	zassert_equal(signaled, 1);
+	zassert_equal(result, SIGNAL_RESULT);
+	k_thread_join(tid, K_FOREVER);
+
+	/**TESTPOINT: a signal stays ready until reset */
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_NO_WAIT), 1);
+	k_poll_signal_reset(&set_signal);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+				      K_NO_WAIT), -EAGAIN);
+
+	set_teardown();
+}
+
+#endif /* CONFIG_POLL_SET */
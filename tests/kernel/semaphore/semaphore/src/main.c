@@ -66,6 +66,7 @@ K_SEM_DEFINE(mid_prio_sem, SEM_INIT_VAL, SEM_MAX_VAL);
 K_SEM_DEFINE(high_prio_long_sem, SEM_INIT_VAL, SEM_MAX_VAL);
 K_SEM_DEFINE(high_prio_sem, SEM_INIT_VAL, SEM_MAX_VAL);
 K_SEM_DEFINE(multiple_thread_sem, SEM_INIT_VAL, SEM_MAX_VAL);
+K_SEM_DEFINE(unlimited_sem, SEM_INIT_VAL, UINT_MAX);
 
 K_THREAD_STACK_DEFINE(stack_1, STACK_SIZE);
 K_THREAD_STACK_DEFINE(stack_2, STACK_SIZE);
@@ -240,6 +241,26 @@ ZTEST_USER(semaphore, test_k_sem_define)
 		     "- got %u, expected %u");
 }
 
+/**
+ * @brief Test semaphores without limit
+ * @details
+ * - Define and initialize semaphores with a limit of UINT_MAX.
+ * - Verify their limit is K_SEM_MAX_LIMIT.
+ * @ingroup kernel_semaphore_tests
+ * @see k_sem_init(), #K_SEM_DEFINE(x)
+ */
+ZTEST(semaphore, test_sem_unlimited)
+{
+	zassert_equal(unlimited_sem.limit, K_SEM_MAX_LIMIT,
+		      "defined limit %u, expected %u", unlimited_sem.limit,
+		      K_SEM_MAX_LIMIT);
+
+	expect_k_sem_init_nomsg(&msg_sema, SEM_INIT_VAL, UINT_MAX, 0);
+	zassert_equal(msg_sema.limit, K_SEM_MAX_LIMIT,
+		      "initialized limit %u, expected %u", msg_sema.limit,
+		      K_SEM_MAX_LIMIT);
+}
+
 /**
  * @brief Test synchronization of threads with semaphore
  * @see k_sem_init(), #K_SEM_DEFINE(x)
@@ -275,6 +296,7 @@ ZTEST(semaphore, test_sem_thread2isr)
  * @details
  * - Initialize a semaphore with valid count and max limit.
  * - Initialize a semaphore with invalid max limit.
+ * - Initialize a semaphore without limit.
  * - Initialize a semaphore with invalid count.
  * @ingroup kernel_semaphore_tests
  */
@@ -288,6 +310,9 @@ ZTEST_USER(semaphore, test_k_sem_init)
 	/* initialize a semaphore with invalid max limit */
 	expect_k_sem_init_nomsg(&msg_sema, SEM_INIT_VAL, 0, -EINVAL);
 
+	/* initialize a semaphore without limit */
+	expect_k_sem_init_nomsg(&msg_sema, SEM_INIT_VAL, UINT_MAX, 0);
+
 	/* initialize a semaphore with invalid count */
 	expect_k_sem_init_nomsg(&msg_sema, SEM_MAX_VAL + 1, SEM_MAX_VAL, -EINVAL);
 }
@@ -228,6 +228,103 @@ ZTEST(spinlock, test_trylock)
 	zassert_true(trylock_successes > 0);
 }
 
+#ifdef CONFIG_MCS_SPINLOCKS
+/* More locks than MCS queue nodes per CPU */
+#define NEST_DEPTH (CONFIG_MCS_SPINLOCK_NODES + 2)
+
+static struct k_spinlock nest_locks[NEST_DEPTH];
+
+static void nest_inner_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	/* Queue behind, or take over from, a CPU holding the innermost
+	 * lock without a queue node
+	 */
+	while (!bounce_done) {
+		k_spinlock_key_t key = k_spin_lock(&nest_locks[NEST_DEPTH - 1]);
+
+		bounce_owner = 4321;
+		k_busy_wait(1);
+		zassert_true(bounce_owner == 4321, "Locked data changed");
+		k_spin_unlock(&nest_locks[NEST_DEPTH - 1], key);
+	}
+}
+#endif /* CONFIG_MCS_SPINLOCKS */
+
+/**
+ * @brief Test nesting more MCS spinlocks than there are queue nodes
+ *
+ * @details A CPU out of MCS queue nodes spins until the lock is free
+ * instead.  Check that it excludes a CPU taking the same lock with a
+ * queue node, in both directions.
+ *
+ * @ingroup kernel_spinlock_tests
+ *
+ * @see k_spin_lock(), k_spin_trylock(), k_spin_unlock()
+ */
+ZTEST(spinlock, test_spinlock_mcs_nested)
+{
+#ifdef CONFIG_MCS_SPINLOCKS
+	k_spinlock_key_t keys[NEST_DEPTH];
+	k_spinlock_key_t key;
+	int i, j;
+
+	for (i = 0; i < NEST_DEPTH; i++) {
+		nest_locks[i] = (struct k_spinlock)K_SPINLOCK_MCS_INIT;
+	}
+
+	k_thread_create(&cpu1_thread, cpu1_stack, CPU1_STACK_SIZE,
+			nest_inner_fn, NULL, NULL, NULL,
+			0, 0, K_NO_WAIT);
+
+	k_busy_wait(10);
+
+	for (i = 0; i < 1000; i++) {
+		for (j = 0; j < NEST_DEPTH; j++) {
+			keys[j] = k_spin_lock(&nest_locks[j]);
+			zassert_true(z_spin_is_locked(&nest_locks[j]),
+				     "Spinlock failed to lock");
+		}
+
+		bounce_owner = 1234;
+		k_busy_wait(1);
+		zassert_true(bounce_owner == 1234, "Locked data changed");
+
+		/* Release out of order, as z_pend_curr() does */
+		for (j = NEST_DEPTH - 2; j >= 0; j--) {
+			k_spin_unlock(&nest_locks[j], keys[j]);
+		}
+		k_spin_unlock(&nest_locks[NEST_DEPTH - 1], keys[NEST_DEPTH - 1]);
+	}
+
+	/* Trylock without a free queue node */
+	for (j = 0; j < NEST_DEPTH - 1; j++) {
+		keys[j] = k_spin_lock(&nest_locks[j]);
+	}
+	while (k_spin_trylock(&nest_locks[NEST_DEPTH - 1], &key) != 0) {
+		trylock_failures++;
+	}
+	k_spin_unlock(&nest_locks[NEST_DEPTH - 1], key);
+	for (j = NEST_DEPTH - 2; j >= 0; j--) {
+		k_spin_unlock(&nest_locks[j], keys[j]);
+	}
+
+	bounce_done = 1;
+
+	k_thread_join(&cpu1_thread, K_FOREVER);
+
+	for (i = 0; i < NEST_DEPTH; i++) {
+		zassert_false(z_spin_is_locked(&nest_locks[i]),
+			      "Spinlock failed to unlock");
+	}
+#else
+	ztest_test_skip();
+#endif /* CONFIG_MCS_SPINLOCKS */
+}
+
 static void before(void *ctx)
 {
 	ARG_UNUSED(ctx);
@@ -7,6 +7,7 @@
 #include <stdlib.h>
 #include <zephyr/ztest.h>
 #include <zephyr/types.h>
+#include <timeout_q.h>
 
 struct timer_data {
 	int expire_cnt;
@@ -64,6 +65,10 @@ static struct k_timer status_timer;
 static struct k_timer status_anytime_timer;
 static struct k_timer status_sync_timer;
 static struct k_timer remain_timer;
+static struct k_timer slack_timer;
+static struct k_timer slack_batch_timer;
+static struct k_timer slack_arm_timer;
+static struct k_timer slack_armed_timer;
 
 static ZTEST_BMEM struct timer_data tdata;
 
@@ -829,6 +834,133 @@ ZTEST_USER(timer_api, test_sleep_abs)
 
 }
 
+static ZTEST_BMEM uint32_t slack_cyc[2];
+
+static void slack_expire(struct k_timer *timer)
+{
+	slack_cyc[(timer == &slack_timer) ? 0 : 1] = k_cycle_get_32();
+}
+
+/**
+ * @brief Test timer slack
+ *
+ * Validates that a timer given a slack expires together with another
+ * timer expiring within its slack, instead of on its own, and that it
+ * does not expire early.
+ *
+ * @ingroup kernel_timer_tests
+ *
+ * @see k_timer_slack_set()
+ */
+ZTEST_USER(timer_api, test_timer_slack)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	const int batch_ticks = 20;
+	const int slack_ticks = 10;
+	uint32_t start;
+
+	if (!IS_ENABLED(CONFIG_TICKLESS_KERNEL)) {
+		/* Every tick is announced, timeouts are not coalesced */
+		ztest_test_skip();
+	}
+
+	tick_sync();
+
+	start = k_cycle_get_32();
+	k_timer_start(&slack_batch_timer, K_TICKS(batch_ticks), K_NO_WAIT);
+	k_timer_slack_set(&slack_timer, K_TICKS(slack_ticks));
+	k_timer_start(&slack_timer, K_TICKS(batch_ticks - slack_ticks / 2),
+		      K_NO_WAIT);
+
+	k_timer_status_sync(&slack_batch_timer);
+	zassert_equal(k_timer_status_get(&slack_timer), 1);
+
+	/** TESTPOINT: timer did not expire before its duration */
+	zassert_true(slack_cyc[0] - start >=
+		     k_ticks_to_cyc_floor32(batch_ticks - slack_ticks / 2 - 1),
+		     "slack timer expired early");
+
+	/** TESTPOINT: both timers expired in the same batch */
+	zassert_true(slack_cyc[1] - slack_cyc[0] <
+		     k_ticks_to_cyc_floor32(slack_ticks / 2),
+		     "slack timer expired %u cycles before batch",
+		     slack_cyc[1] - slack_cyc[0]);
+
+	k_timer_slack_set(&slack_timer, K_NO_WAIT);
+#endif /* CONFIG_TIMEOUT_SLACK */
+}
+
+#define SLACK_ARMED_TICKS 5
+
+static uint32_t slack_arm_cyc[2];
+
+static void slack_arm_expire(struct k_timer *timer)
+{
+	slack_arm_cyc[0] = k_cycle_get_32();
+	k_timer_start(&slack_armed_timer, K_TICKS(SLACK_ARMED_TICKS), K_NO_WAIT);
+}
+
+static void slack_armed_expire(struct k_timer *timer)
+{
+	slack_arm_cyc[1] = k_cycle_get_32();
+}
+
+/**
+ * @brief Test a timer without slack started from a timer handler
+ *
+ * Validates that a timer without slack, started while the timeouts are
+ * being announced, is not delayed to the tick the system timer was
+ * programmed for before.
+ *
+ * @ingroup kernel_timer_tests
+ *
+ * @see k_timer_slack_set()
+ */
+ZTEST(timer_api, test_timer_slack_start_from_handler)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	const int batch_ticks = 40;
+	const int arm_ticks = 10;
+	k_ticks_t rem;
+	int32_t next;
+
+	tick_sync();
+
+	/* The system timer is programmed for the batch timer, which the
+	 * slack of the first timer tolerates.
+	 */
+	k_timer_start(&slack_batch_timer, K_TICKS(batch_ticks), K_NO_WAIT);
+	k_timer_slack_set(&slack_arm_timer, K_TICKS(batch_ticks));
+	k_timer_start(&slack_arm_timer, K_TICKS(arm_ticks), K_NO_WAIT);
+
+	k_timer_status_sync(&slack_arm_timer);
+
+	/* Unless it expired with the batch, as the intermediate ticks were
+	 * not announced, the system timer must now be programmed for the
+	 * timer started by the handler.
+	 */
+	rem = k_timer_remaining_ticks(&slack_armed_timer);
+	next = z_get_next_timeout_expiry();
+	if (rem > 0) {
+		/** TESTPOINT: the next wakeup is not after the timer */
+		zassert_true(next <= rem,
+			     "next wakeup in %d ticks, timer in %lld ticks",
+			     next, (long long)rem);
+	}
+
+	k_timer_status_sync(&slack_armed_timer);
+
+	/** TESTPOINT: the timer started by the handler was not delayed */
+	zassert_true(slack_arm_cyc[1] - slack_arm_cyc[0] <=
+		     k_ticks_to_cyc_ceil32(SLACK_ARMED_TICKS + 2),
+		     "timer expired %u cycles after being started",
+		     slack_arm_cyc[1] - slack_arm_cyc[0]);
+
+	k_timer_stop(&slack_batch_timer);
+	k_timer_slack_set(&slack_arm_timer, K_NO_WAIT);
+#endif /* CONFIG_TIMEOUT_SLACK */
+}
+
 static void timer_init(struct k_timer *timer, k_timer_expiry_t expiry_fn,
 		       k_timer_stop_t stop_fn)
 {
@@ -850,6 +982,10 @@ void *setup_timer_api(void)
 	timer_init(&status_anytime_timer, NULL, NULL);
 	timer_init(&status_sync_timer, duration_expire, duration_stop);
 	timer_init(&remain_timer, duration_expire, duration_stop);
+	timer_init(&slack_timer, slack_expire, NULL);
+	timer_init(&slack_batch_timer, slack_expire, NULL);
+	timer_init(&slack_arm_timer, slack_arm_expire, NULL);
+	timer_init(&slack_armed_timer, slack_armed_expire, NULL);
 
 	if (IS_ENABLED(CONFIG_MULTITHREADING)) {
 		k_thread_access_grant(k_current_get(), &ktimer, &timer0, &timer1,
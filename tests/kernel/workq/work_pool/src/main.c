@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define NUM_WORKERS CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+/* Lower than the test thread, so that workers only run when it blocks
+ * on a uniprocessor.
+ */
+#define WORKER_PRIO (CONFIG_ZTEST_THREAD_PRIORITY + 1)
+
+#define NUM_ITEMS 64
+#define NUM_CHILDREN 4
+
+K_WORK_POOL_DEFINE(test_pool, NUM_WORKERS, STACK_SIZE);
+
+static struct k_work items[NUM_ITEMS];
+static struct k_work children[NUM_ITEMS][NUM_CHILDREN];
+static atomic_t run_count;
+static K_SEM_DEFINE(done_sem, 0, NUM_ITEMS * (NUM_CHILDREN + 1));
+static K_SEM_DEFINE(started_sem, 0, 1);
+static K_SEM_DEFINE(gate_sem, 0, 1);
+
+static void count_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	atomic_inc(&run_count);
+	k_sem_give(&done_sem);
+}
+
+static void parent_handler(struct k_work *work)
+{
+	unsigned int i = work - items;
+
+	for (unsigned int j = 0; j < NUM_CHILDREN; j++) {
+		k_work_pool_submit(&test_pool, &children[i][j]);
+	}
+	count_handler(work);
+}
+
+static void gated_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_sem_give(&started_sem);
+	k_sem_take(&gate_sem, K_FOREVER);
+	count_handler(work);
+}
+
+#define NUM_SELF_RUNS 200
+
+static atomic_t self_active;
+static atomic_t self_runs;
+static bool self_overlap;
+static bool self_moved;
+static bool self_bad_ret;
+static k_tid_t self_thread;
+
+/* Resubmits itself from the handler, while other idle workers are
+ * woken up and would steal it if it were queued to the local deque.
+ */
+static void self_handler(struct k_work *work)
+{
+	if (atomic_inc(&self_active) != 0) {
+		self_overlap = true;
+	}
+
+	/* Only the worker running the item may run it again */
+	if (self_thread == NULL) {
+		self_thread = k_current_get();
+	} else if (self_thread != k_current_get()) {
+		self_moved = true;
+	}
+
+	k_busy_wait(50);
+
+	if (atomic_inc(&self_runs) + 1 < NUM_SELF_RUNS) {
+		if (k_work_pool_submit(&test_pool, work) != 2) {
+			self_bad_ret = true;
+		}
+	} else {
+		k_sem_give(&done_sem);
+	}
+
+	k_busy_wait(50);
+	(void)atomic_dec(&self_active);
+}
+
+static uint64_t total_executed(void)
+{
+	struct k_work_pool_stats stats;
+	uint64_t total = 0;
+
+	for (unsigned int i = 0; i < NUM_WORKERS; i++) {
+		zassert_ok(k_work_pool_stats_get(&test_pool, i, &stats));
+		total += stats.executed;
+	}
+
+	return total;
+}
+
+static void wait_done(unsigned int count)
+{
+	for (unsigned int i = 0; i < count; i++) {
+		zassert_ok(k_sem_take(&done_sem, K_SECONDS(5)),
+			   "work item %u of %u did not run", i, count);
+	}
+}
+
+ZTEST(work_pool, test_submit)
+{
+	uint64_t executed = total_executed();
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i], count_handler);
+		zassert_equal(k_work_pool_submit(&test_pool, &items[i]), 1);
+	}
+
+	wait_done(NUM_ITEMS);
+	zassert_equal(atomic_get(&run_count), NUM_ITEMS);
+	zassert_equal(total_executed() - executed, NUM_ITEMS);
+}
+
+ZTEST(work_pool, test_submit_to_cpu)
+{
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i], count_handler);
+		zassert_equal(k_work_pool_submit_to_cpu(&test_pool, &items[i],
+							i % NUM_WORKERS), 1);
+	}
+
+	wait_done(NUM_ITEMS);
+	zassert_equal(atomic_get(&run_count), NUM_ITEMS);
+}
+
+/* Items submitted from a handler go to the local deque, which is
+ * smaller than the number of children, and must all run.
+ */
+ZTEST(work_pool, test_submit_from_handler)
+{
+	uint64_t executed = total_executed();
+	unsigned int total = NUM_ITEMS * (NUM_CHILDREN + 1);
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i], parent_handler);
+		for (unsigned int j = 0; j < NUM_CHILDREN; j++) {
+			k_work_init(&children[i][j], count_handler);
+		}
+	}
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_pool_submit(&test_pool, &items[i]), 1);
+	}
+
+	wait_done(total);
+	zassert_equal(atomic_get(&run_count), total);
+	zassert_equal(total_executed() - executed, total);
+}
+
+ZTEST(work_pool, test_resubmit)
+{
+	struct k_work *work = &items[0];
+
+	k_work_init(work, gated_handler);
+
+	zassert_equal(k_work_pool_submit(&test_pool, work), 1);
+	zassert_ok(k_sem_take(&started_sem, K_SECONDS(5)));
+	zassert_true((k_work_busy_get(work) & K_WORK_RUNNING) != 0);
+
+	/* Running but not queued: queued again to its worker, then only
+	 * once
+	 */
+	zassert_equal(k_work_pool_submit(&test_pool, work), 2);
+	zassert_equal(k_work_pool_submit(&test_pool, work), 0);
+
+	k_sem_give(&gate_sem);
+	zassert_ok(k_sem_take(&started_sem, K_SECONDS(5)));
+	k_sem_give(&gate_sem);
+
+	wait_done(2);
+	zassert_equal(atomic_get(&run_count), 2);
+}
+
+/* An item resubmitted while it runs never runs on two workers at once */
+ZTEST(work_pool, test_resubmit_self)
+{
+	struct k_work *work = &items[0];
+
+	k_work_init(work, self_handler);
+	atomic_set(&self_active, 0);
+	atomic_set(&self_runs, 0);
+	self_overlap = false;
+	self_moved = false;
+	self_bad_ret = false;
+	self_thread = NULL;
+
+	zassert_equal(k_work_pool_submit(&test_pool, work), 1);
+
+	wait_done(1);
+	zassert_equal(atomic_get(&self_runs), NUM_SELF_RUNS);
+	zassert_false(self_overlap, "handler ran on two workers at once");
+	zassert_false(self_moved, "handler run again by another worker");
+	zassert_false(self_bad_ret, "resubmission from the handler not queued");
+}
+
+ZTEST(work_pool, test_stats)
+{
+	struct k_work_pool_stats stats;
+
+	zassert_equal(k_work_pool_stats_get(&test_pool, NUM_WORKERS, &stats),
+		      -EINVAL);
+
+	for (unsigned int i = 0; i < NUM_WORKERS; i++) {
+		zassert_ok(k_work_pool_stats_get(&test_pool, i, &stats));
+		zassert_equal(stats.depth, 0);
+		zassert_true(stats.stolen <= stats.executed);
+	}
+
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_POOL
+	struct k_work_pool_stats raw;
+
+	zassert_ok(k_obj_core_stats_raw(K_OBJ_CORE(&test_pool.workers[0]),
+					&raw, sizeof(raw)));
+	zassert_ok(k_obj_core_stats_reset(K_OBJ_CORE(&test_pool.workers[0])));
+	zassert_ok(k_work_pool_stats_get(&test_pool, 0, &stats));
+	zassert_equal(stats.executed, 0);
+	zassert_equal(stats.stolen, 0);
+#endif
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	atomic_set(&run_count, 0);
+	k_sem_reset(&done_sem);
+}
+
+static void *setup(void)
+{
+	static const struct k_work_queue_config cfg = {
+		.name = "test_pool",
+	};
+
+	zassert_ok(k_work_pool_start(&test_pool, WORKER_PRIO, &cfg));
+
+	return NULL;
+}
+
+ZTEST_SUITE(work_pool, NULL, setup, before, NULL, NULL);
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/arena.h>
+
+#define ARENA_SIZE 256
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+SYS_ARENA_DEFINE(static_arena, ARENA_SIZE);
+K_HEAP_DEFINE(arena_heap, 2 * ARENA_SIZE);
+
+static K_THREAD_STACK_DEFINE(child_stack, STACK_SIZE);
+static struct k_thread child_thread;
+
+ZTEST(arena, test_alloc)
+{
+	uint8_t *p1, *p2;
+
+	sys_arena_reset(&static_arena);
+
+	p1 = sys_arena_alloc(&static_arena, 1);
+	zassert_not_null(p1);
+	zassert_equal((uintptr_t)p1 % SYS_ARENA_ALIGN, 0);
+
+	p2 = sys_arena_alloc(&static_arena, 1);
+	zassert_equal(p2, p1 + SYS_ARENA_ALIGN, "allocations are not contiguous");
+
+	p2 = sys_arena_aligned_alloc(&static_arena, 64, 16);
+	zassert_not_null(p2);
+	zassert_equal((uintptr_t)p2 % 64, 0);
+
+	zassert_true(sys_arena_used_get(&static_arena) <= ARENA_SIZE);
+}
+
+ZTEST(arena, test_exhaust)
+{
+	sys_arena_reset(&static_arena);
+
+	zassert_not_null(sys_arena_alloc(&static_arena, ARENA_SIZE));
+	zassert_is_null(sys_arena_alloc(&static_arena, 1));
+
+	sys_arena_reset(&static_arena);
+	zassert_is_null(sys_arena_alloc(&static_arena, ARENA_SIZE + 1));
+	zassert_is_null(sys_arena_alloc(&static_arena, SIZE_MAX));
+	zassert_equal(sys_arena_used_get(&static_arena), 0,
+		      "failed allocations must not consume memory");
+	zassert_equal(sys_arena_max_used_get(&static_arena), ARENA_SIZE);
+}
+
+ZTEST(arena, test_checkpoints)
+{
+	sys_arena_mark_t outer, inner;
+	uint8_t *p1, *p2, *p3;
+
+	sys_arena_reset(&static_arena);
+
+	p1 = sys_arena_alloc(&static_arena, 16);
+	outer = sys_arena_checkpoint(&static_arena);
+	p2 = sys_arena_alloc(&static_arena, 16);
+	inner = sys_arena_checkpoint(&static_arena);
+	p3 = sys_arena_alloc(&static_arena, 16);
+	zassert_true(p1 != NULL && p2 != NULL && p3 != NULL);
+
+	sys_arena_rewind(&static_arena, inner);
+	zassert_equal(sys_arena_alloc(&static_arena, 16), p3);
+
+	sys_arena_rewind(&static_arena, outer);
+	zassert_equal(sys_arena_alloc(&static_arena, 16), p2);
+
+	sys_arena_reset(&static_arena);
+	zassert_equal(sys_arena_alloc(&static_arena, 16), p1);
+}
+
+ZTEST(arena, test_heap_backed)
+{
+	struct sys_arena arena, other;
+
+	zassert_equal(sys_arena_init_from_heap(&arena, &arena_heap,
+					       4 * ARENA_SIZE, K_NO_WAIT),
+		      -ENOMEM);
+
+	zassert_ok(sys_arena_init_from_heap(&arena, &arena_heap, ARENA_SIZE,
+					    K_NO_WAIT));
+	zassert_not_null(sys_arena_alloc(&arena, ARENA_SIZE));
+	zassert_is_null(sys_arena_alloc(&arena, 1));
+	sys_arena_release(&arena);
+
+	/* The buffer went back to the heap */
+	zassert_ok(sys_arena_init_from_heap(&arena, &arena_heap, ARENA_SIZE,
+					    K_NO_WAIT));
+	zassert_ok(sys_arena_init_from_heap(&other, &arena_heap, ARENA_SIZE / 2,
+					    K_NO_WAIT));
+	sys_arena_release(&other);
+	sys_arena_release(&arena);
+}
+
+static void child_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_is_null(sys_arena_scratch_get(),
+			"scratch arenas must not be inherited");
+}
+
+ZTEST(arena, test_thread_scratch)
+{
+	struct sys_arena *scratch;
+
+	sys_arena_reset(&static_arena);
+	sys_arena_thread_assign(k_current_get(), &static_arena);
+
+	scratch = sys_arena_scratch_get();
+	zassert_equal(scratch, &static_arena);
+	zassert_not_null(sys_arena_alloc(scratch, 32));
+
+	k_thread_create(&child_thread, child_stack, STACK_SIZE, child_fn,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_thread_join(&child_thread, K_FOREVER);
+
+	sys_arena_thread_assign(k_current_get(), NULL);
+	zassert_is_null(sys_arena_scratch_get());
+}
+
+ZTEST_SUITE(arena, NULL, NULL, NULL, NULL, NULL);
@@ -44,7 +44,12 @@
 /* With enabling SYS_HEAP_RUNTIME_STATS, the size of struct z_heap
  * will increase 16 bytes on 64 bit CPU.
  */
-#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+#if defined(CONFIG_SYS_HEAP_TLSF)
+/* The TLSF bitmap and additional free lists grow chunk0 to 19 units
+ * with the default 3 second level bits and runtime statistics.
+ */
+#define SOLO_FREE_HEADER_HEAP_SZ (184)
+#elif defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
 #define SOLO_FREE_HEADER_HEAP_SZ (80)
 #else
 #define SOLO_FREE_HEADER_HEAP_SZ (64)
@@ -354,7 +354,8 @@ void tcp_server_block_thread(void *vps_sock, void *unused2, void *unused3)
 	test_close(new_sock);
 }
 
-void test_send_recv_large_common(int tcp_nodelay, int family)
+static void test_send_recv_large_ca(int tcp_nodelay, int family,
+				    const char *congestion)
 {
 	int rv;
 	int c_sock;
@@ -393,6 +394,12 @@ void test_send_recv_large_common(int tcp_nodelay, int family)
 		&s_sock, NULL, NULL,
 		k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
 
+	if (congestion != NULL) {
+		rv = zsock_setsockopt(c_sock, IPPROTO_TCP, TCP_CONGESTION,
+				      congestion, strlen(congestion));
+		zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+	}
+
 	test_connect(c_sock, s_saddr, addrlen);
 
 	rv = zsock_setsockopt(c_sock, IPPROTO_TCP, TCP_NODELAY, (char *) &tcp_nodelay, sizeof(int));
@@ -437,6 +444,11 @@ void test_send_recv_large_common(int tcp_nodelay, int family)
 	k_sleep(TCP_TEARDOWN_TIMEOUT);
 }
 
+void test_send_recv_large_common(int tcp_nodelay, int family)
+{
+	test_send_recv_large_ca(tcp_nodelay, family, NULL);
+}
+
 /* Control the packet drop ratio at the loopback adapter 8 */
 static void set_packet_loss_ratio(void)
 {
@@ -490,6 +502,24 @@ ZTEST(net_socket_tcp, test_v6_send_recv_large_no_delay)
 	restore_packet_loss_ratio();
 }
 
+ZTEST(net_socket_tcp, test_v4_send_recv_large_cubic)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_CONGESTION_CUBIC);
+
+	set_packet_loss_ratio();
+	test_send_recv_large_ca(0, AF_INET, "cubic");
+	restore_packet_loss_ratio();
+}
+
+ZTEST(net_socket_tcp, test_v4_send_recv_large_bbr)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_CONGESTION_BBR);
+
+	set_packet_loss_ratio();
+	test_send_recv_large_ca(0, AF_INET, "bbr");
+	restore_packet_loss_ratio();
+}
+
 ZTEST(net_socket_tcp, test_v4_broken_link)
 {
 	/* Test if the data stops transmitting after the send returned with a timeout. */
@@ -2415,6 +2445,68 @@ ZTEST(net_socket_tcp, test_so_keepalive)
 	test_context_cleanup();
 }
 
+ZTEST(net_socket_tcp, test_tcp_congestion)
+{
+	struct sockaddr_in bind_addr4;
+	char name[16];
+	socklen_t optlen;
+	int sock, ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_CONGESTION_AVOIDANCE);
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &sock, &bind_addr4);
+
+	/* New Reno is the default algorithm */
+	optlen = sizeof(name);
+	ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_mem_equal(name, "reno", sizeof("reno"),
+			  "getsockopt got invalid value");
+	zassert_equal(optlen, sizeof("reno"), "getsockopt got invalid size");
+
+	/* The name is truncated to the buffer size */
+	optlen = 2;
+	ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_mem_equal(name, "re", 2, "getsockopt got invalid value");
+	zassert_equal(optlen, 2, "getsockopt got invalid size");
+
+	ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "vegas",
+			       strlen("vegas"));
+	zassert_equal(ret, -1, "setsockopt should fail");
+	zassert_equal(errno, ENOENT, "setsockopt got invalid errno (%d)", errno);
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_CUBIC)) {
+		ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "cubic",
+				       sizeof("cubic"));
+		zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+		optlen = sizeof(name);
+		ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name,
+				       &optlen);
+		zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+		zassert_mem_equal(name, "cubic", sizeof("cubic"),
+				  "getsockopt got invalid value");
+	}
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_BBR)) {
+		ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "bbr",
+				       strlen("bbr"));
+		zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+		optlen = sizeof(name);
+		ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name,
+				       &optlen);
+		zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+		zassert_mem_equal(name, "bbr", sizeof("bbr"),
+				  "getsockopt got invalid value");
+	}
+
+	test_close(sock);
+
+	test_context_cleanup();
+}
+
 ZTEST(net_socket_tcp, test_keepalive_timeout)
 {
 	struct sockaddr_in c_saddr, s_saddr;
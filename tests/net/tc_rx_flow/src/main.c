@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_TC_LOG_LEVEL);
+
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <zephyr/random/random.h>
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_mgmt.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_stats.h>
+
+#include "ipv4.h"
+#include "udp_internal.h"
+#include "connection.h"
+#include "net_private.h"
+
+#define ALLOC_TIMEOUT K_MSEC(500)
+#define WAIT_TIME K_SECONDS(1)
+
+#define MY_PORT 4242
+#define PEER_PORT_BASE 5000
+
+/* Flows differing by their source address and port */
+#define FLOW_COUNT 16
+#define PKTS_PER_FLOW 4
+#define DATA_LEN 64
+
+#define PKT_LEN (sizeof(struct net_ipv4_hdr) + sizeof(struct net_udp_hdr) + \
+		 DATA_LEN)
+
+static struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+
+struct dummy_context {
+	uint8_t mac_addr[6];
+};
+
+static struct dummy_context dummy_context;
+static struct net_if *test_iface;
+
+/* RX queue of the packets of each flow, -1 until one is received */
+static int flow_queue[FLOW_COUNT];
+static int flow_pkts[FLOW_COUNT];
+static bool flow_moved;
+static bool unknown_thread;
+static struct k_spinlock lock;
+static K_SEM_DEFINE(recv_sem, 0, UINT_MAX);
+
+static void flow_peer_addr(int flow, struct in_addr *addr)
+{
+	*addr = (struct in_addr){ { { 192, 0, 2, 10 + flow } } };
+}
+
+/* Index of the best effort RX queue handled by the current thread */
+static int current_queue(void)
+{
+	const char *name = k_thread_name_get(k_current_get());
+
+	if (name == NULL) {
+		return -1;
+	}
+
+	if (strncmp(name, "rx_f[", 5) == 0) {
+		return atoi(name + 5);
+	}
+
+	if (strncmp(name, "rx_q[", 5) == 0) {
+		return 0;
+	}
+
+	return -1;
+}
+
+static enum net_verdict udp_received(struct net_conn *conn,
+				     struct net_pkt *pkt,
+				     union net_ip_header *ip_hdr,
+				     union net_proto_header *proto_hdr,
+				     void *user_data)
+{
+	int flow = ntohs(proto_hdr->udp->src_port) - PEER_PORT_BASE;
+	int queue = current_queue();
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&lock);
+
+	if (queue < 0 || flow < 0 || flow >= FLOW_COUNT) {
+		unknown_thread = true;
+	} else {
+		if (flow_queue[flow] < 0) {
+			flow_queue[flow] = queue;
+		} else if (flow_queue[flow] != queue) {
+			flow_moved = true;
+		}
+
+		flow_pkts[flow]++;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	net_pkt_unref(pkt);
+	k_sem_give(&recv_sem);
+
+	return NET_OK;
+}
+
+static void dummy_iface_init(struct net_if *iface)
+{
+	const struct device *dev = net_if_get_device(iface);
+	struct dummy_context *context = dev->data;
+
+	net_if_set_link_addr(iface, context->mac_addr,
+			     sizeof(context->mac_addr),
+			     NET_LINK_DUMMY);
+}
+
+static int dummy_send(const struct device *dev, struct net_pkt *pkt)
+{
+	return 0;
+}
+
+static struct dummy_api api_funcs = {
+	.iface_api.init = dummy_iface_init,
+	.send = dummy_send,
+};
+
+static int dummy_init(const struct device *dev)
+{
+	struct dummy_context *context = dev->data;
+
+	/* 00-00-5E-00-53-xx Documentation RFC 7042 */
+	context->mac_addr[0] = 0x00;
+	context->mac_addr[1] = 0x00;
+	context->mac_addr[2] = 0x5E;
+	context->mac_addr[3] = 0x00;
+	context->mac_addr[4] = 0x53;
+	context->mac_addr[5] = sys_rand8_get();
+
+	return 0;
+}
+
+NET_DEVICE_INIT(net_tc_rx_flow_test, "net_tc_rx_flow_test",
+		dummy_init, NULL, &dummy_context, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &api_funcs,
+		DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2), 576);
+
+/* Create a best effort UDP packet of @a flow, as received by a driver */
+static struct net_pkt *udp_pkt_create(int flow)
+{
+	struct in_addr peer_addr;
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_rx_alloc_with_buffer(test_iface,
+					   sizeof(struct net_udp_hdr) + DATA_LEN,
+					   AF_INET, IPPROTO_UDP, ALLOC_TIMEOUT);
+	zassert_not_null(pkt, "Cannot allocate pkt");
+
+	net_pkt_set_priority(pkt, NET_PRIORITY_BE);
+
+	flow_peer_addr(flow, &peer_addr);
+	zassert_ok(net_ipv4_create(pkt, &peer_addr, &my_addr),
+		   "Cannot create IPv4 header");
+	zassert_ok(net_udp_create(pkt, htons(PEER_PORT_BASE + flow),
+				  htons(MY_PORT)),
+		   "Cannot create UDP header");
+
+	for (int i = 0; i < DATA_LEN; i++) {
+		zassert_ok(net_pkt_write_u8(pkt, flow), "Cannot write data");
+	}
+
+	net_pkt_cursor_init(pkt);
+	zassert_ok(net_ipv4_finalize(pkt, IPPROTO_UDP), "Cannot finalize");
+
+	return pkt;
+}
+
+ZTEST(net_tc_rx_flow, test_rx_flow_steering)
+{
+	struct net_stats before, after;
+	int queue_flows[NET_TC_RX_FLOW_COUNT] = { 0 };
+	int used_queues = 0;
+
+	zassert_ok(net_mgmt(NET_REQUEST_STATS_GET_ALL, test_iface, &before,
+			    sizeof(before)),
+		   "Cannot get statistics");
+
+	/* Interleave the flows so that each one can change of queue */
+	for (int i = 0; i < PKTS_PER_FLOW; i++) {
+		for (int flow = 0; flow < FLOW_COUNT; flow++) {
+			zassert_ok(net_recv_data(test_iface, udp_pkt_create(flow)),
+				   "Cannot receive pkt");
+		}
+
+		for (int flow = 0; flow < FLOW_COUNT; flow++) {
+			zassert_ok(k_sem_take(&recv_sem, WAIT_TIME),
+				   "Timeout while waiting pkt");
+		}
+	}
+
+	zassert_ok(net_mgmt(NET_REQUEST_STATS_GET_ALL, test_iface, &after,
+			    sizeof(after)),
+		   "Cannot get statistics");
+
+	zassert_false(unknown_thread, "Pkt not handled by a best effort RX queue");
+	zassert_false(flow_moved, "The pkts of a flow went to several queues");
+
+	for (int flow = 0; flow < FLOW_COUNT; flow++) {
+		zassert_equal(flow_pkts[flow], PKTS_PER_FLOW,
+			      "Flow %d: expected %d pkts, got %d", flow,
+			      PKTS_PER_FLOW, flow_pkts[flow]);
+		zassert_true(flow_queue[flow] < NET_TC_RX_FLOW_COUNT,
+			     "Flow %d in invalid queue %d", flow,
+			     flow_queue[flow]);
+
+		queue_flows[flow_queue[flow]]++;
+	}
+
+	/* The statistics of each queue count the pkts of its flows */
+	for (int q = 0; q < NET_TC_RX_FLOW_COUNT; q++) {
+		net_stats_t pkts = after.rx_flow[q].pkts - before.rx_flow[q].pkts;
+		net_stats_t bytes = after.rx_flow[q].bytes - before.rx_flow[q].bytes;
+
+		zassert_equal(pkts, queue_flows[q] * PKTS_PER_FLOW,
+			      "Queue %d: expected %d pkts, got %u", q,
+			      queue_flows[q] * PKTS_PER_FLOW, pkts);
+		zassert_equal(bytes, queue_flows[q] * PKTS_PER_FLOW * PKT_LEN,
+			      "Queue %d: expected %zu bytes, got %u", q,
+			      queue_flows[q] * PKTS_PER_FLOW * PKT_LEN, bytes);
+
+		if (queue_flows[q] > 0) {
+			used_queues++;
+		}
+	}
+
+	/* The hash spreads these flows over all the queues */
+	zassert_equal(used_queues, NET_TC_RX_FLOW_COUNT,
+		      "The flows were spread over %d of %d queues",
+		      used_queues, NET_TC_RX_FLOW_COUNT);
+}
+
+static void *net_tc_rx_flow_setup(void)
+{
+	struct sockaddr local = { 0 };
+	struct net_conn_handle *handle;
+
+	test_iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(test_iface, "No test interface");
+
+	zassert_not_null(net_if_ipv4_addr_add(test_iface, &my_addr,
+					      NET_ADDR_MANUAL, 0),
+			 "Cannot add IPv4 address");
+
+	net_if_up(test_iface);
+
+	local.sa_family = AF_INET;
+	net_ipaddr_copy(&net_sin(&local)->sin_addr, &my_addr);
+
+	zassert_ok(net_conn_register(IPPROTO_UDP, AF_INET, NULL, &local,
+				     0, MY_PORT, NULL, udp_received,
+				     NULL, &handle),
+		   "Cannot register UDP connection");
+
+	return NULL;
+}
+
+static void net_tc_rx_flow_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (int flow = 0; flow < FLOW_COUNT; flow++) {
+		flow_queue[flow] = -1;
+		flow_pkts[flow] = 0;
+	}
+
+	flow_moved = false;
+	unknown_thread = false;
+	k_sem_reset(&recv_sem);
+}
+
+ZTEST_SUITE(net_tc_rx_flow, NULL, net_tc_rx_flow_setup,
+	    net_tc_rx_flow_before, NULL, NULL);
@@ -133,6 +133,8 @@ static enum test_case_no {
 	TEST_CLIENT_CLOSING_FAILURE_IPV6 = 16,
 	TEST_CLIENT_FIN_WAIT_2_IPV4_FAILURE = 17,
 	TEST_CLIENT_FIN_ACK_WITH_DATA = 18,
+	TEST_CLIENT_SACK_RECOVERY = 19,
+	TEST_SERVER_SACK_BLOCKS = 20,
 } test_case_no;
 
 static enum test_state t_state;
@@ -157,6 +159,8 @@ static void handle_server_rst_on_closed_port(sa_family_t af, struct tcphdr *th);
 static void handle_server_rst_on_listening_port(sa_family_t af, struct tcphdr *th);
 static void handle_syn_invalid_ack(sa_family_t af, struct tcphdr *th);
 static void handle_client_fin_ack_with_data_test(sa_family_t af, struct tcphdr *th);
+static void handle_client_sack_recovery_test(struct net_pkt *pkt, struct tcphdr *th);
+static void handle_server_sack_blocks_test(struct net_pkt *pkt, struct tcphdr *th);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -254,23 +258,21 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
-static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
-					      uint16_t src_port,
-					      uint16_t dst_port,
-					      uint8_t flags,
-					      const uint8_t *data,
-					      size_t len)
+static struct net_pkt *tester_prepare_tcp_pkt_opts(sa_family_t af,
+						   uint16_t src_port,
+						   uint16_t dst_port,
+						   uint8_t flags,
+						   const uint8_t *opts,
+						   size_t opts_len,
+						   uint16_t win,
+						   const uint8_t *data,
+						   size_t len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct net_pkt *pkt;
 	struct tcphdr *th;
-	uint8_t opts_len = 0;
 	int ret = -EINVAL;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		opts_len = sizeof(tcp_options);
-	}
-
 	/* Allocate buffer */
 	pkt = net_pkt_alloc_with_buffer(net_iface,
 					sizeof(struct tcphdr) + len + opts_len,
@@ -303,14 +305,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		th->th_off = 10U;
-	} else {
-		th->th_off = 5U;
-	}
-
+	th->th_off = 5U + opts_len / 4U;
 	th->th_flags = flags;
-	th->th_win = NET_IPV6_MTU;
+	th->th_win = win;
 	th->th_seq = htonl(seq);
 
 	if (ACK & flags) {
@@ -322,9 +319,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if (opts_len) {
 		/* Add TCP Options */
-		ret = net_pkt_write(pkt, tcp_options, opts_len);
+		ret = net_pkt_write(pkt, opts, opts_len);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -357,6 +354,27 @@ fail:
 	return NULL;
 }
 
+static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
+					      uint16_t src_port,
+					      uint16_t dst_port,
+					      uint8_t flags,
+					      const uint8_t *data,
+					      size_t len)
+{
+	const uint8_t *opts = NULL;
+	size_t opts_len = 0;
+
+	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4 ||
+	     test_case_no == TEST_SERVER_SACK_BLOCKS) && (flags & SYN)) {
+		opts = tcp_options;
+		opts_len = sizeof(tcp_options);
+	}
+
+	return tester_prepare_tcp_pkt_opts(af, src_port, dst_port, flags,
+					   opts, opts_len, NET_IPV6_MTU,
+					   data, len);
+}
+
 static struct net_pkt *prepare_syn_packet(sa_family_t af, uint16_t src_port,
 					  uint16_t dst_port)
 {
@@ -509,6 +527,12 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_CLIENT_FIN_ACK_WITH_DATA:
 		handle_client_fin_ack_with_data_test(net_pkt_family(pkt), &th);
 		break;
+	case TEST_CLIENT_SACK_RECOVERY:
+		handle_client_sack_recovery_test(pkt, &th);
+		break;
+	case TEST_SERVER_SACK_BLOCKS:
+		handle_server_sack_blocks_test(pkt, &th);
+		break;
 
 	default:
 		zassert_true(false, "Undefined test case");
@@ -785,6 +809,7 @@ static void test_server_timeout(struct k_work *work)
 {
 	if (test_case_no == TEST_SERVER_IPV4 ||
 	    test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4 ||
+	    test_case_no == TEST_SERVER_SACK_BLOCKS ||
 	    test_case_no == TEST_SERVER_RST_ON_CLOSED_PORT ||
 	    test_case_no == TEST_SERVER_RST_ON_LISTENING_PORT_NO_ACTIVE_CONNECTION) {
 		handle_server_test(AF_INET, NULL);
@@ -2621,4 +2646,390 @@ ZTEST(net_tcp, test_client_fin_ack_with_data)
 	}
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+
+#define SACK_TEST_MSS 100
+#define SACK_TEST_WIN 2048
+#define SACK_TEST_DATA_LEN (5 * SACK_TEST_MSS)
+/* Offset of the segment lost */
+#define SACK_TEST_HOLE SACK_TEST_MSS
+
+static const uint8_t sack_syn_options[] = {
+	NET_TCP_MSS_OPT, NET_TCP_MSS_SIZE, 0, SACK_TEST_MSS,
+	NET_TCP_NOP_OPT, NET_TCP_NOP_OPT,
+	NET_TCP_SACK_PERM_OPT, NET_TCP_SACK_PERM_SIZE,
+};
+
+static struct tcp *sack_conn;
+static uint32_t sack_data_base;
+static uint32_t sack_data_end;
+static bool sack_hole_dropped;
+static bool sack_hole_recovered;
+static uint32_t sack_expected_ack;
+static struct tcp_sack_block sack_expected_block;
+
+/* Copy the TCP option of the given kind from the segment, returns its length
+ * or -ENOENT if there is none.
+ */
+static int read_tcp_option(struct net_pkt *pkt, struct tcphdr *th,
+			   uint8_t kind, uint8_t *opt)
+{
+	size_t opts_len = (th->th_off - 5U) * 4U;
+	uint8_t opts[40];
+	int ret = -ENOENT;
+	size_t i = 0;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) +
+			 net_pkt_ip_opts_len(pkt) + sizeof(struct tcphdr)) < 0 ||
+	    net_pkt_read(pkt, opts, opts_len) < 0) {
+		goto out;
+	}
+
+	while (i + 1U < opts_len && opts[i] != NET_TCP_END_OPT) {
+		if (opts[i] == NET_TCP_NOP_OPT) {
+			i++;
+			continue;
+		}
+
+		if (opts[i + 1U] < 2U || i + opts[i + 1U] > opts_len) {
+			break;
+		}
+
+		if (opts[i] == kind) {
+			memcpy(opt, &opts[i], opts[i + 1U]);
+			ret = opts[i + 1U];
+			break;
+		}
+
+		i += opts[i + 1U];
+	}
+
+out:
+	net_pkt_cursor_init(pkt);
+
+	return ret;
+}
+
+/* Returns the number of SACK blocks of the segment, and the first one */
+static int read_sack_block(struct net_pkt *pkt, struct tcphdr *th,
+			   struct tcp_sack_block *block)
+{
+	uint8_t opt[40];
+	int len;
+
+	len = read_tcp_option(pkt, th, NET_TCP_SACK_OPT, opt);
+	if (len < NET_TCP_SACK_SIZE + NET_TCP_SACK_BLOCK_SIZE) {
+		return 0;
+	}
+
+	block->left = ntohl(UNALIGNED_GET((uint32_t *)&opt[2]));
+	block->right = ntohl(UNALIGNED_GET((uint32_t *)&opt[6]));
+
+	return (len - NET_TCP_SACK_SIZE) / NET_TCP_SACK_BLOCK_SIZE;
+}
+
+static size_t tcp_data_len_get(struct net_pkt *pkt, struct tcphdr *th)
+{
+	return net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt) -
+	       net_pkt_ip_opts_len(pkt) - th->th_off * 4U;
+}
+
+static void handle_client_sack_recovery_test(struct net_pkt *pkt,
+					     struct tcphdr *th)
+{
+	uint8_t opts[2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_SIZE +
+		     NET_TCP_SACK_BLOCK_SIZE];
+	const uint8_t *reply_opts = NULL;
+	size_t reply_opts_len = 0;
+	struct net_pkt *reply;
+	uint8_t flags = ACK;
+	uint32_t offset;
+	size_t len;
+	int ret;
+
+	switch (t_state) {
+	case T_SYN:
+		test_verify_flags(th, SYN);
+		zassert_equal(read_tcp_option(pkt, th, NET_TCP_SACK_PERM_OPT, opts),
+			      NET_TCP_SACK_PERM_SIZE, "SACK not offered");
+		seq = 0U;
+		ack = ntohl(th->th_seq) + 1U;
+		sack_data_base = ack;
+		flags = SYN | ACK;
+		reply_opts = sack_syn_options;
+		reply_opts_len = sizeof(sack_syn_options);
+		t_state = T_SYN_ACK;
+		break;
+	case T_SYN_ACK:
+		test_verify_flags(th, ACK);
+		seq++;
+		t_state = T_DATA;
+		test_sem_give();
+		return;
+	case T_DATA:
+		offset = ntohl(th->th_seq) - sack_data_base;
+		len = tcp_data_len_get(pkt, th);
+
+		if (offset == SACK_TEST_HOLE) {
+			if (!sack_hole_dropped) {
+				/* Emulate the loss of the segment */
+				sack_hole_dropped = true;
+				return;
+			}
+
+			/* The retransmission fills the hole, acknowledge all */
+			sack_hole_recovered = sack_conn->sack.in_recovery;
+			ack = sack_data_base + sack_data_end;
+			t_state = T_DATA_ACK;
+			test_sem_give();
+			break;
+		}
+
+		if (offset == 0U) {
+			ack = sack_data_base + SACK_TEST_MSS;
+			break;
+		}
+
+		if (offset < sack_data_end) {
+			/* Only a tail loss probe may resend SACKed data */
+			zassert_equal(offset + len, SACK_TEST_DATA_LEN,
+				      "SACKed data at %u retransmitted", offset);
+			return;
+		}
+
+		/* Report what was received after the hole */
+		sack_data_end = offset + len;
+		opts[0] = NET_TCP_NOP_OPT;
+		opts[1] = NET_TCP_NOP_OPT;
+		opts[2] = NET_TCP_SACK_OPT;
+		opts[3] = NET_TCP_SACK_SIZE + NET_TCP_SACK_BLOCK_SIZE;
+		UNALIGNED_PUT(htonl(sack_data_base + SACK_TEST_HOLE + SACK_TEST_MSS),
+			      (uint32_t *)&opts[4]);
+		UNALIGNED_PUT(htonl(sack_data_base + sack_data_end),
+			      (uint32_t *)&opts[8]);
+		reply_opts = opts;
+		reply_opts_len = sizeof(opts);
+		break;
+	case T_DATA_ACK:
+		return;
+	default:
+		zassert_true(false, "%s unexpected state", __func__);
+		return;
+	}
+
+	reply = tester_prepare_tcp_pkt_opts(AF_INET, htons(MY_PORT), th->th_sport,
+					    flags, reply_opts, reply_opts_len,
+					    htons(SACK_TEST_WIN), NULL, 0U);
+	zassert_not_null(reply, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, reply);
+	zassert_equal(ret, 0, "recv data failed (%d)", ret);
+}
+
+/* Test case scenario IPv4
+ *   expect SYN offering SACK,
+ *   send SYN ACK accepting SACK,
+ *   expect ACK,
+ *   expect 5 data segments, drop the second one,
+ *   send duplicate ACKs with SACK blocks for the following ones,
+ *   expect the retransmission of the second segment only,
+ *   send ACK for all the data.
+ */
+ZTEST(net_tcp, test_client_sack_recovery)
+{
+	struct net_context *ctx;
+	struct net_pkt *rst;
+	int ret;
+
+	t_state = T_SYN;
+	test_case_no = TEST_CLIENT_SACK_RECOVERY;
+	seq = ack = 0;
+	sack_data_end = 0U;
+	sack_hole_dropped = false;
+	sack_hole_recovered = false;
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	zassert_equal(ret, 0, "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	ret = net_context_connect(ctx, (struct sockaddr *)&peer_addr_s,
+				  sizeof(struct sockaddr_in), NULL,
+				  K_MSEC(100), NULL);
+	zassert_equal(ret, 0, "Failed to connect to peer");
+
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	sack_conn = ctx->tcp;
+	zassert_true(sack_conn->recv_options.sack_perm_found,
+		     "SACK not negotiated");
+
+	ret = net_context_send(ctx, lorem_ipsum, SACK_TEST_DATA_LEN, NULL,
+			       K_NO_WAIT, NULL);
+	zassert_equal(ret, SACK_TEST_DATA_LEN, "Failed to send data to peer");
+
+	/* Peer will release the semaphore after the retransmission */
+	test_sem_take(K_MSEC(1000), __LINE__);
+
+	zassert_true(sack_hole_recovered,
+		     "Not retransmitted by SACK based loss recovery");
+	zassert_equal(sack_data_end, SACK_TEST_DATA_LEN, "Data missing");
+
+	/* Abort the connection */
+	rst = tester_prepare_tcp_pkt_opts(AF_INET, htons(MY_PORT), htons(PEER_PORT),
+					  RST, NULL, 0, htons(SACK_TEST_WIN),
+					  NULL, 0U);
+	zassert_not_null(rst, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, rst);
+	zassert_equal(ret, 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+}
+
+static void handle_server_sack_blocks_test(struct net_pkt *pkt,
+					   struct tcphdr *th)
+{
+	struct tcp_sack_block block;
+	int count;
+
+	if (t_state != T_DATA_ACK) {
+		handle_server_test(net_pkt_family(pkt), th);
+		return;
+	}
+
+	test_verify_flags(th, ACK);
+	zassert_equal(ntohl(th->th_ack), sack_expected_ack,
+		      "Expected ACK %u but got %u",
+		      sack_expected_ack, ntohl(th->th_ack));
+
+	count = read_sack_block(pkt, th, &block);
+	if (sack_expected_block.left == sack_expected_block.right) {
+		zassert_equal(count, 0, "Unexpected SACK blocks");
+	} else {
+		zassert_equal(count, 1, "Expected a SACK block");
+		zassert_equal(block.left, sack_expected_block.left,
+			      "Invalid SACK block start");
+		zassert_equal(block.right, sack_expected_block.right,
+			      "Invalid SACK block end");
+	}
+
+	test_sem_give();
+}
+
+static void send_sack_test_data(uint32_t offset, size_t len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	seq = sack_data_base + offset;
+	pkt = prepare_data_packet(AF_INET, htons(MY_PORT), htons(PEER_PORT),
+				  &lorem_ipsum[offset], len);
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_equal(ret, 0, "recv data failed (%d)", ret);
+
+	test_sem_take(K_MSEC(100), __LINE__);
+}
+
+/* Test case scenario IPv4
+ *   send SYN offering SACK,
+ *   expect SYN ACK,
+ *   send ACK,
+ *   send out of order data,
+ *   expect duplicate ACK with a SACK block for it,
+ *   send the missing data,
+ *   expect ACK for all the data, without SACK block.
+ */
+ZTEST(net_tcp, test_server_sack_blocks)
+{
+	struct net_context *ctx;
+	struct net_pkt *rst;
+	int ret;
+
+	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT == 0) {
+		ztest_test_skip();
+	}
+
+	t_state = T_SYN;
+	test_case_no = TEST_SERVER_SACK_BLOCKS;
+	seq = ack = 0;
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	zassert_equal(ret, 0, "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	ret = net_context_bind(ctx, (struct sockaddr *)&my_addr_s,
+			       sizeof(struct sockaddr_in));
+	zassert_equal(ret, 0, "Failed to bind net_context");
+
+	ret = net_context_listen(ctx, 1);
+	zassert_equal(ret, 0, "Failed to listen on net_context");
+
+	/* Trigger the peer to send SYN */
+	k_work_reschedule(&test_server, K_NO_WAIT);
+
+	ret = net_context_accept(ctx, test_tcp_accept_cb, K_FOREVER, NULL);
+	zassert_equal(ret, 0, "Failed to set accept on net_context");
+
+	/* test_tcp_accept_cb will release the semaphore after successful
+	 * connection.
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	zassert_true(((struct tcp *)accepted_ctx->tcp)->recv_options.sack_perm_found,
+		     "SACK not negotiated");
+
+	ret = net_context_recv(accepted_ctx, test_tcp_recv_cb, K_NO_WAIT, NULL);
+	zassert_equal(ret, 0, "Failed to recv data from peer");
+
+	t_state = T_DATA_ACK;
+	sack_data_base = seq;
+
+	sack_expected_ack = sack_data_base;
+	sack_expected_block.left = sack_data_base + 10U;
+	sack_expected_block.right = sack_data_base + 20U;
+	send_sack_test_data(10U, 10U);
+
+	sack_expected_ack = sack_data_base + 20U;
+	sack_expected_block.left = sack_expected_block.right;
+	send_sack_test_data(0U, 10U);
+
+	/* Abort the connection */
+	seq = sack_data_base + 20U;
+	rst = prepare_rst_packet(AF_INET, htons(MY_PORT), htons(PEER_PORT));
+	zassert_not_null(rst, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, rst);
+	zassert_equal(ret, 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
+#else
+
+static void handle_client_sack_recovery_test(struct net_pkt *pkt,
+					     struct tcphdr *th)
+{
+}
+
+static void handle_server_sack_blocks_test(struct net_pkt *pkt,
+					   struct tcphdr *th)
+{
+}
+
+#endif /* CONFIG_NET_TCP_SACK */
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
@@ -0,0 +1,484 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <string.h>
+#include <errno.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/random/random.h>
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "ipv4.h"
+#include "connection.h"
+#include "net_private.h"
+#include "tcp_internal.h"
+
+#define ALLOC_TIMEOUT K_MSEC(500)
+
+#define MY_PORT 4242
+#define PEER_PORT 4243
+
+/* Segment size, and payload of the GSO packets: three full segments and
+ * a short one
+ */
+#define SEG_LEN 500
+#define GSO_LEN (3 * SEG_LEN + 100)
+#define GSO_SEGS DIV_ROUND_UP(GSO_LEN, SEG_LEN)
+
+#define SEQ_BASE 0x12345678U
+#define ACK_SEQ 0x87654321U
+#define WND 4096
+
+#define HDRS_LEN (sizeof(struct net_ipv4_hdr) + sizeof(struct net_tcp_hdr))
+#define FRAME_MAX (sizeof(struct net_eth_hdr) + HDRS_LEN + SEG_LEN)
+
+static struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr peer_addr = { { { 192, 0, 2, 2 } } };
+static struct in_addr hw_addr = { { { 192, 0, 2, 3 } } };
+
+struct eth_context {
+	struct net_if *iface;
+	uint8_t mac_addr[6];
+};
+
+static struct eth_context eth_context_sw;
+static struct eth_context eth_context_hw;
+
+static struct net_if *sw_iface;
+static struct net_if *hw_iface;
+
+/* Frames seen by the drivers */
+static struct {
+	uint8_t data[FRAME_MAX];
+	size_t len;
+	uint16_t gso_size;
+} tx_frames[GSO_SEGS];
+static int tx_count;
+
+/* Segments seen by the TCP input */
+static struct {
+	uint32_t seq;
+	uint8_t flags;
+	size_t len;
+	uint16_t gso_size;
+} rx_seg;
+static int rx_count;
+
+static struct net_tcp_gro gro;
+
+static uint8_t pattern(uint32_t seq)
+{
+	return (uint8_t)(seq - SEQ_BASE);
+}
+
+/* Ones' complement sum of the 16 bit words of @a data */
+static uint16_t chksum_add(uint32_t sum, const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i + 1 < len; i += 2) {
+		sum += sys_get_be16(&data[i]);
+	}
+
+	if (len & 1) {
+		sum += data[len - 1] << 8;
+	}
+
+	while (sum >> 16) {
+		sum = (sum & 0xffff) + (sum >> 16);
+	}
+
+	return sum;
+}
+
+static void eth_iface_init(struct net_if *iface)
+{
+	const struct device *dev = net_if_get_device(iface);
+	struct eth_context *context = dev->data;
+
+	context->iface = iface;
+
+	net_if_set_link_addr(iface, context->mac_addr,
+			     sizeof(context->mac_addr),
+			     NET_LINK_ETHERNET);
+
+	ethernet_init(iface);
+}
+
+static int eth_tx(const struct device *dev, struct net_pkt *pkt)
+{
+	size_t len = net_pkt_get_len(pkt);
+
+	zassert_true(tx_count < ARRAY_SIZE(tx_frames), "Too many frames");
+
+	tx_frames[tx_count].len = len;
+	tx_frames[tx_count].gso_size = net_pkt_gso_size(pkt);
+
+	if (len <= FRAME_MAX) {
+		net_pkt_cursor_init(pkt);
+		zassert_ok(net_pkt_read(pkt, tx_frames[tx_count].data, len),
+			   "Cannot read frame");
+	}
+
+	tx_count++;
+
+	return 0;
+}
+
+static enum ethernet_hw_caps eth_sw_caps(const struct device *dev)
+{
+	return 0;
+}
+
+static enum ethernet_hw_caps eth_hw_caps(const struct device *dev)
+{
+	return ETHERNET_HW_TX_TCP_SEG;
+}
+
+static struct ethernet_api api_funcs_sw = {
+	.iface_api.init = eth_iface_init,
+
+	.get_capabilities = eth_sw_caps,
+	.send = eth_tx,
+};
+
+static struct ethernet_api api_funcs_hw = {
+	.iface_api.init = eth_iface_init,
+
+	.get_capabilities = eth_hw_caps,
+	.send = eth_tx,
+};
+
+static int eth_init(const struct device *dev)
+{
+	struct eth_context *context = dev->data;
+
+	/* 00-00-5E-00-53-xx Documentation RFC 7042 */
+	context->mac_addr[0] = 0x00;
+	context->mac_addr[1] = 0x00;
+	context->mac_addr[2] = 0x5E;
+	context->mac_addr[3] = 0x00;
+	context->mac_addr[4] = 0x53;
+	context->mac_addr[5] = sys_rand8_get();
+
+	return 0;
+}
+
+ETH_NET_DEVICE_INIT(eth_gso_sw_test, "eth_gso_sw_test",
+		    eth_init, NULL, &eth_context_sw, NULL,
+		    CONFIG_ETH_INIT_PRIORITY, &api_funcs_sw, NET_ETH_MTU);
+
+ETH_NET_DEVICE_INIT(eth_gso_hw_test, "eth_gso_hw_test",
+		    eth_init, NULL, &eth_context_hw, NULL,
+		    CONFIG_ETH_INIT_PRIORITY, &api_funcs_hw, NET_ETH_MTU);
+
+/* Create a TCP segment sent by us, or received from the peer */
+static struct net_pkt *tcp_pkt_create(struct net_if *iface, bool rx,
+				      uint32_t seq, uint8_t flags, size_t len,
+				      uint16_t gso_size)
+{
+	struct net_tcp_hdr tcp_hdr = { 0 };
+	const struct in_addr *src, *dst;
+	struct net_pkt *pkt;
+
+	if (rx) {
+		pkt = net_pkt_rx_alloc_with_buffer(iface, HDRS_LEN + len, AF_INET,
+						   IPPROTO_TCP, ALLOC_TIMEOUT);
+		src = &peer_addr;
+		dst = &my_addr;
+	} else {
+		pkt = net_pkt_alloc_with_buffer(iface, HDRS_LEN + len, AF_INET,
+						IPPROTO_TCP, ALLOC_TIMEOUT);
+		src = net_if_ipv4_select_src_addr(iface, &peer_addr);
+		dst = &peer_addr;
+	}
+	zassert_not_null(pkt, "Cannot allocate pkt");
+
+	zassert_ok(net_ipv4_create(pkt, src, dst), "Cannot create IPv4 header");
+
+	tcp_hdr.src_port = htons(rx ? PEER_PORT : MY_PORT);
+	tcp_hdr.dst_port = htons(rx ? MY_PORT : PEER_PORT);
+	sys_put_be32(seq, tcp_hdr.seq);
+	sys_put_be32(ACK_SEQ, tcp_hdr.ack);
+	tcp_hdr.offset = (sizeof(tcp_hdr) / 4U) << 4;
+	tcp_hdr.flags = flags;
+	sys_put_be16(WND, tcp_hdr.wnd);
+
+	zassert_ok(net_pkt_write(pkt, &tcp_hdr, sizeof(tcp_hdr)),
+		   "Cannot write TCP header");
+
+	for (size_t i = 0; i < len; i++) {
+		zassert_ok(net_pkt_write_u8(pkt, pattern(seq + i)),
+			   "Cannot write data");
+	}
+
+	net_pkt_set_gso_size(pkt, gso_size);
+
+	net_pkt_cursor_init(pkt);
+	zassert_ok(net_ipv4_finalize(pkt, IPPROTO_TCP), "Cannot finalize");
+	net_pkt_cursor_init(pkt);
+
+	return pkt;
+}
+
+static enum net_verdict tcp_received(struct net_conn *conn,
+				     struct net_pkt *pkt,
+				     union net_ip_header *ip_hdr,
+				     union net_proto_header *proto_hdr,
+				     void *user_data)
+{
+	size_t hdr_len = net_pkt_ip_hdr_len(pkt) + sizeof(struct net_tcp_hdr);
+	uint8_t byte;
+
+	rx_seg.seq = sys_get_be32(proto_hdr->tcp->seq);
+	rx_seg.flags = proto_hdr->tcp->flags;
+	rx_seg.len = net_pkt_get_len(pkt) - hdr_len;
+	rx_seg.gso_size = net_pkt_gso_size(pkt);
+	rx_count++;
+
+	/* The data of the merged segments is in order */
+	net_pkt_cursor_init(pkt);
+	zassert_ok(net_pkt_skip(pkt, hdr_len), "Cannot skip headers");
+
+	for (size_t i = 0; i < rx_seg.len; i++) {
+		zassert_ok(net_pkt_read_u8(pkt, &byte), "Cannot read data");
+		zassert_equal(byte, pattern(rx_seg.seq + i),
+			      "Invalid data at %zu", i);
+	}
+
+	net_pkt_unref(pkt);
+
+	return NET_OK;
+}
+
+/* Check a frame sent for the GSO packet, holding its @a index segment */
+static void check_gso_frame(int index, uint8_t flags)
+{
+	uint8_t *ip = tx_frames[index].data + sizeof(struct net_eth_hdr);
+	uint8_t *tcp = ip + sizeof(struct net_ipv4_hdr);
+	struct net_tcp_hdr *tcp_hdr = (struct net_tcp_hdr *)tcp;
+	uint32_t offset = index * SEG_LEN;
+	size_t len = MIN(SEG_LEN, GSO_LEN - offset);
+	size_t tcp_len = sizeof(struct net_tcp_hdr) + len;
+	uint16_t sum;
+
+	zassert_equal(tx_frames[index].len,
+		      sizeof(struct net_eth_hdr) + HDRS_LEN + len,
+		      "Invalid length of frame %d", index);
+	zassert_equal(tx_frames[index].gso_size, 0U,
+		      "Frame %d still a GSO packet", index);
+	zassert_equal(sys_get_be16(ip + 2), HDRS_LEN + len,
+		      "Invalid IP length of frame %d", index);
+	zassert_equal(chksum_add(0, ip, sizeof(struct net_ipv4_hdr)), 0xffff,
+		      "Invalid IP checksum of frame %d", index);
+
+	/* Pseudo header, then TCP header and data */
+	sum = chksum_add(0, ip + 12, 2 * sizeof(struct in_addr));
+	sum = chksum_add(sum + IPPROTO_TCP + tcp_len, tcp, tcp_len);
+	zassert_equal(sum, 0xffff, "Invalid TCP checksum of frame %d", index);
+
+	zassert_equal(sys_get_be32(tcp_hdr->seq), SEQ_BASE + offset,
+		      "Invalid sequence number of frame %d", index);
+	zassert_equal(tcp_hdr->flags, flags, "Invalid flags of frame %d", index);
+
+	for (size_t i = 0; i < len; i++) {
+		zassert_equal(tcp[sizeof(struct net_tcp_hdr) + i],
+			      pattern(SEQ_BASE + offset + i),
+			      "Invalid data of frame %d at %zu", index, i);
+	}
+}
+
+ZTEST(net_tcp_gso, test_gso_split)
+{
+	struct net_pkt *pkt;
+
+	pkt = tcp_pkt_create(sw_iface, false, SEQ_BASE, FIN | PSH | ACK,
+			     GSO_LEN, SEG_LEN);
+	zassert_ok(net_send_data(pkt), "Cannot send pkt");
+
+	zassert_equal(tx_count, GSO_SEGS, "Expected %d frames, got %d",
+		      GSO_SEGS, tx_count);
+
+	/* Only the last segment ends the data */
+	for (int i = 0; i < GSO_SEGS - 1; i++) {
+		check_gso_frame(i, ACK);
+	}
+	check_gso_frame(GSO_SEGS - 1, FIN | PSH | ACK);
+}
+
+ZTEST(net_tcp_gso, test_gso_hw_tx_tcp_seg)
+{
+	struct net_pkt *pkt;
+
+	pkt = tcp_pkt_create(hw_iface, false, SEQ_BASE, PSH | ACK,
+			     GSO_LEN, SEG_LEN);
+	zassert_ok(net_send_data(pkt), "Cannot send pkt");
+
+	/* The device splits the packet */
+	zassert_equal(tx_count, 1, "Expected 1 frame, got %d", tx_count);
+	zassert_equal(tx_frames[0].len,
+		      sizeof(struct net_eth_hdr) + HDRS_LEN + GSO_LEN,
+		      "Invalid length of frame");
+	zassert_equal(tx_frames[0].gso_size, SEG_LEN, "Segment size not passed");
+}
+
+static void gro_receive(uint32_t seq, uint8_t flags, size_t len)
+{
+	struct net_pkt *pkt = tcp_pkt_create(sw_iface, true, seq, flags, len, 0U);
+
+	zassert_equal(net_tcp_gro_receive(&gro, pkt, false), NET_OK,
+		      "Segment not coalesced");
+}
+
+static void check_rx_seg(uint32_t seq, size_t len, uint16_t gso_size)
+{
+	zassert_equal(rx_seg.seq, seq, "Invalid sequence number");
+	zassert_equal(rx_seg.len, len, "Expected %zu bytes, got %zu", len,
+		      rx_seg.len);
+	zassert_equal(rx_seg.gso_size, gso_size, "Invalid segment size");
+}
+
+ZTEST(net_tcp_gso, test_gro_merge_push)
+{
+	gro_receive(SEQ_BASE, ACK, SEG_LEN);
+	gro_receive(SEQ_BASE + SEG_LEN, ACK, SEG_LEN);
+	zassert_equal(rx_count, 0, "Segments passed up too early");
+
+	/* PSH ends the data sent at once */
+	gro_receive(SEQ_BASE + 2 * SEG_LEN, PSH | ACK, SEG_LEN);
+	zassert_equal(rx_count, 1, "Expected 1 packet, got %d", rx_count);
+	check_rx_seg(SEQ_BASE, 3 * SEG_LEN, SEG_LEN);
+	zassert_equal(rx_seg.flags, PSH | ACK, "PSH not kept");
+	zassert_is_null(gro.pkt, "Packet still held");
+}
+
+ZTEST(net_tcp_gso, test_gro_short_seg)
+{
+	gro_receive(SEQ_BASE, ACK, SEG_LEN);
+
+	/* So does a segment shorter than the first one */
+	gro_receive(SEQ_BASE + SEG_LEN, ACK, SEG_LEN / 2);
+	zassert_equal(rx_count, 1, "Expected 1 packet, got %d", rx_count);
+	check_rx_seg(SEQ_BASE, SEG_LEN + SEG_LEN / 2, SEG_LEN);
+	zassert_equal(rx_seg.flags, ACK, "Invalid flags");
+	zassert_is_null(gro.pkt, "Packet still held");
+}
+
+ZTEST(net_tcp_gso, test_gro_max_segs)
+{
+	uint32_t seq = SEQ_BASE;
+
+	for (int i = 0; i < CONFIG_NET_TCP_GRO_MAX_SEGS; i++) {
+		zassert_equal(rx_count, 0, "Packet passed up after %d segments", i);
+		gro_receive(seq, ACK, SEG_LEN);
+		seq += SEG_LEN;
+	}
+
+	zassert_equal(rx_count, 1, "Expected 1 packet, got %d", rx_count);
+	check_rx_seg(SEQ_BASE, CONFIG_NET_TCP_GRO_MAX_SEGS * SEG_LEN, SEG_LEN);
+
+	/* The next segment starts over */
+	gro_receive(seq, ACK, SEG_LEN);
+	zassert_equal(rx_count, 1, "Segment passed up too early");
+
+	net_tcp_gro_flush(&gro);
+	zassert_equal(rx_count, 2, "Segment not passed up on flush");
+	check_rx_seg(seq, SEG_LEN, 0U);
+}
+
+ZTEST(net_tcp_gso, test_gro_bad_chksum)
+{
+	struct net_pkt *pkt;
+
+	gro_receive(SEQ_BASE, ACK, SEG_LEN);
+
+	/* Corrupt the data of the next segment */
+	pkt = tcp_pkt_create(sw_iface, true, SEQ_BASE + SEG_LEN, ACK, SEG_LEN, 0U);
+	net_pkt_set_overwrite(pkt, true);
+	zassert_ok(net_pkt_skip(pkt, HDRS_LEN), "Cannot skip headers");
+	zassert_ok(net_pkt_write_u8(pkt, ~pattern(SEQ_BASE + SEG_LEN)),
+		   "Cannot write data");
+	net_pkt_cursor_init(pkt);
+
+	/* The first segment is passed up alone, the bad one is held... */
+	zassert_equal(net_tcp_gro_receive(&gro, pkt, false), NET_OK,
+		      "Segment not held");
+	zassert_equal(rx_count, 1, "Expected 1 packet, got %d", rx_count);
+	check_rx_seg(SEQ_BASE, SEG_LEN, 0U);
+	zassert_equal_ptr(gro.pkt, pkt, "Bad segment not held alone");
+
+	/* ...and dropped by the TCP input */
+	net_tcp_gro_flush(&gro);
+	zassert_equal(rx_count, 1, "Bad segment passed up");
+}
+
+static void iface_cb(struct net_if *iface, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	if (net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET)) {
+		return;
+	}
+
+	if (net_if_get_device(iface)->data == &eth_context_sw) {
+		sw_iface = iface;
+	} else if (net_if_get_device(iface)->data == &eth_context_hw) {
+		hw_iface = iface;
+	}
+}
+
+static void *net_tcp_gso_setup(void)
+{
+	struct sockaddr remote = { 0 };
+	struct sockaddr local = { 0 };
+	struct net_conn_handle *handle;
+
+	net_if_foreach(iface_cb, NULL);
+	zassert_not_null(sw_iface, "No interface without TCP segmentation");
+	zassert_not_null(hw_iface, "No interface with TCP segmentation");
+
+	zassert_not_null(net_if_ipv4_addr_add(sw_iface, &my_addr,
+					      NET_ADDR_MANUAL, 0),
+			 "Cannot add IPv4 address");
+	zassert_not_null(net_if_ipv4_addr_add(hw_iface, &hw_addr,
+					      NET_ADDR_MANUAL, 0),
+			 "Cannot add IPv4 address");
+
+	net_if_up(sw_iface);
+	net_if_up(hw_iface);
+
+	remote.sa_family = AF_INET;
+	net_ipaddr_copy(&net_sin(&remote)->sin_addr, &peer_addr);
+	local.sa_family = AF_INET;
+	net_ipaddr_copy(&net_sin(&local)->sin_addr, &my_addr);
+
+	zassert_ok(net_conn_register(IPPROTO_TCP, AF_INET, &remote, &local,
+				     PEER_PORT, MY_PORT, NULL, tcp_received,
+				     NULL, &handle),
+		   "Cannot register TCP connection");
+
+	return NULL;
+}
+
+static void net_tcp_gso_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	tx_count = 0;
+	rx_count = 0;
+	memset(&rx_seg, 0, sizeof(rx_seg));
+	net_tcp_gro_flush(&gro);
+	memset(&gro, 0, sizeof(gro));
+}
+
+ZTEST_SUITE(net_tcp_gso, NULL, net_tcp_gso_setup, net_tcp_gso_before,
+	    NULL, NULL);
@@ -646,6 +646,16 @@ ZTEST(udp_fn_tests, test_udp)
 	TEST_IPV6_OK(ud, &in6addr_peer, &in6addr_my, 12345, 42421);
 	TEST_IPV6_LONG_OK(ud, &in6addr_peer, &in6addr_my, 12345, 42421);
 
+	/* A connected handler takes precedence over a bound one */
+	struct ud *ud_bound = REGISTER(AF_INET6, NULL, &my_addr6, 0, 4244);
+
+	ud = REGISTER(AF_INET6, &peer_addr6, &my_addr6, 1234, 4244);
+	TEST_IPV6_OK(ud, &in6addr_peer, &in6addr_my, 1234, 4244);
+	TEST_IPV6_OK(ud_bound, &in6addr_peer, &in6addr_my, 1235, 4244);
+	UNREGISTER(ud);
+	TEST_IPV6_OK(ud_bound, &in6addr_peer, &in6addr_my, 1234, 4244);
+	UNREGISTER(ud_bound);
+
 	/* Remote addr same as local addr, these two will never match */
 	REGISTER(AF_INET6, &my_addr6, NULL, 1234, 4242);
 	REGISTER(AF_INET, &my_addr4, NULL, 1234, 4242);